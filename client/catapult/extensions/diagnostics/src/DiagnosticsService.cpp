@@ -24,6 +24,8 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
 #include "catapult/plugins/PluginManager.h"
+#include <algorithm>
+#include <iomanip>
 
 namespace catapult { namespace diagnostics {
 
@@ -42,6 +44,52 @@ namespace catapult { namespace diagnostics {
 			});
 		}
 
+		constexpr uint64_t Nanoseconds_Per_Millisecond = 1'000'000;
+
+		void AddProfilerCounters(
+				std::vector<utils::DiagnosticCounter>& counters,
+				const std::string& counterPrefix,
+				const utils::ExecutionProfiler& profiler) {
+			counters.emplace_back(utils::DiagnosticCounterId(counterPrefix + " CALLS"), [&profiler]() {
+				return profiler.totalCount();
+			});
+			counters.emplace_back(utils::DiagnosticCounterId(counterPrefix + " TIME MS"), [&profiler]() {
+				return profiler.totalElapsed() / Nanoseconds_Per_Millisecond;
+			});
+		}
+
+		void LogProfile(std::ostream& out, const std::string& title, const utils::ExecutionProfiler& profiler) {
+			// show the most expensive operations first
+			auto statistics = profiler.statistics();
+			std::stable_sort(statistics.begin(), statistics.end(), [](const auto* pLhs, const auto* pRhs) {
+				return pLhs->totalElapsed() > pRhs->totalElapsed();
+			});
+
+			out << std::endl << "--- " << title << " (calls, total ms, p50 ns, p99 ns, max ns) ---";
+			for (const auto* pStatistics : statistics) {
+				const auto& latencies = pStatistics->latencies();
+				out
+						<< std::endl << std::setw(50) << std::left << pStatistics->name() << std::right
+						<< std::setw(12) << pStatistics->count()
+						<< std::setw(10) << pStatistics->totalElapsed() / Nanoseconds_Per_Millisecond
+						<< std::setw(10) << latencies.percentile(50)
+						<< std::setw(10) << latencies.percentile(99)
+						<< std::setw(10) << latencies.max();
+			}
+		}
+
+		thread::Task CreateProfilingTask(const plugins::PluginManager& pluginManager) {
+			return thread::CreateNamedTask("profiling task", [&pluginManager]() {
+				std::ostringstream table;
+				table << "--- current execution profile ---";
+				LogProfile(table, "validators", *pluginManager.validatorProfiler());
+				LogProfile(table, "observers", *pluginManager.observerProfiler());
+
+				CATAPULT_LOG(info) << table.str();
+				return thread::make_ready_future(thread::TaskResult::Continue);
+			});
+		}
+
 		void AddDiagnosticHandlers(const std::vector<utils::DiagnosticCounter>& counters, extensions::ServiceState& state) {
 			auto& handlers = state.packetHandlers();
 			handlers.setAllowedHosts(state.config().Node.TrustedHosts);
@@ -69,8 +117,18 @@ namespace catapult { namespace diagnostics {
 				auto counters = state.counters();
 				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
 
-				// add task
+				// add profiling counters when profiling is enabled
+				const auto& pluginManager = state.pluginManager();
+				auto isProfilingEnabled = !!pluginManager.validatorProfiler();
+				if (isProfilingEnabled) {
+					AddProfilerCounters(counters, "VAL", *pluginManager.validatorProfiler());
+					AddProfilerCounters(counters, "OBS", *pluginManager.observerProfiler());
+				}
+
+				// add tasks
 				state.tasks().push_back(CreateLoggingTask(counters));
+				if (isProfilingEnabled)
+					state.tasks().push_back(CreateProfilingTask(pluginManager));
 
 				// add packet handlers
 				AddDiagnosticHandlers(counters, state);
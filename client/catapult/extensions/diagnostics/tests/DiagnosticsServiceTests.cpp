@@ -49,6 +49,15 @@ namespace catapult { namespace diagnostics {
 		test::AssertRegisteredTasks(TestContext(), { "logging task" });
 	}
 
+	TEST(TEST_CLASS, ProfilingTaskIsRegisteredWhenNotificationProfilingIsEnabled) {
+		// Arrange:
+		TestContext context;
+		context.testState().pluginManager().enableNotificationProfiling();
+
+		// Act + Assert:
+		test::AssertRegisteredTasks(std::move(context), { "logging task", "profiling task" });
+	}
+
 	TEST(TEST_CLASS, PacketHandlersAreRegistered) {
 		// Arrange:
 		struct HookCapture {
@@ -83,6 +92,32 @@ namespace catapult { namespace diagnostics {
 
 	ADD_HANDLERS_TRUSTED_HOSTS_TESTS(TestContext, ionet::PacketType::Diagnostic_Counters)
 
+	namespace {
+		std::set<std::string> GetCounterNames(TestContext& context, size_t numCounters) {
+			const auto& packetHandlers = context.testState().state().packetHandlers();
+
+			// - process a counters request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Diagnostic_Counters;
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct and contains the expected number of counters
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + numCounters * sizeof(model::DiagnosticCounterValue);
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Counters);
+
+			// - extract the counter names
+			std::set<std::string> counterNames;
+			const auto* pCounterValue = reinterpret_cast<const model::DiagnosticCounterValue*>(test::GetSingleBufferData(handlerContext));
+			for (auto i = 0u; i < numCounters; ++i) {
+				counterNames.insert(utils::DiagnosticCounterId(pCounterValue->Id).name());
+				++pCounterValue;
+			}
+
+			return counterNames;
+		}
+	}
+
 	TEST(TEST_CLASS, CountersAreSourcedFromLocatorAndState) {
 		// Arrange: add counters to different sources
 		constexpr auto Num_Counters = 2u;
@@ -92,27 +127,26 @@ namespace catapult { namespace diagnostics {
 
 		// Act:
 		context.boot();
-		const auto& packetHandlers = context.testState().state().packetHandlers();
+		auto counterNames = GetCounterNames(context, Num_Counters);
 
-		// - process a counters request
-		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
-		pPacket->Type = ionet::PacketType::Diagnostic_Counters;
-		ionet::ServerPacketHandlerContext handlerContext;
-		EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
-
-		// Assert: header is correct and contains the expected number of counters
-		auto expectedPacketSize = sizeof(ionet::PacketHeader) + Num_Counters * sizeof(model::DiagnosticCounterValue);
-		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Counters);
-
-		// - check the counter names
-		std::set<std::string> actualCounterNames;
-		const auto* pCounterValue = reinterpret_cast<const model::DiagnosticCounterValue*>(test::GetSingleBufferData(handlerContext));
-		for (auto i = 0u; i < Num_Counters; ++i) {
-			actualCounterNames.insert(utils::DiagnosticCounterId(pCounterValue->Id).name());
-			++pCounterValue;
-		}
+		// Assert:
+		EXPECT_EQ(Num_Counters, counterNames.size());
+		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), counterNames);
+	}
+
+	TEST(TEST_CLASS, ProfilingCountersAreAddedWhenNotificationProfilingIsEnabled) {
+		// Arrange:
+		constexpr auto Num_Counters = 5u;
+		TestContext context;
+		context.testState().counters().push_back(utils::DiagnosticCounter(utils::DiagnosticCounterId("BETA"), []() { return 1u; }));
+		context.testState().pluginManager().enableNotificationProfiling();
+
+		// Act:
+		context.boot();
+		auto counterNames = GetCounterNames(context, Num_Counters);
 
-		EXPECT_EQ(Num_Counters, actualCounterNames.size());
-		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), actualCounterNames);
+		// Assert:
+		EXPECT_EQ(Num_Counters, counterNames.size());
+		EXPECT_EQ(std::set<std::string>({ "BETA", "VAL CALLS", "VAL TIME MS", "OBS CALLS", "OBS TIME MS" }), counterNames);
 	}
 }}
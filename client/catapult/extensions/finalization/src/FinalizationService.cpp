@@ -151,7 +151,7 @@ namespace catapult { namespace finalization {
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state.config(), state.socketWorkingBufferPool());
 				auto pServiceGroup = state.pool().pushServiceGroup("finalization");
 				auto pWriters = pServiceGroup->pushService(net::CreatePacketWriters, locator.keys().caPublicKey(), connectionSettings);
 
@@ -106,17 +106,24 @@ namespace catapult { namespace harvesting {
 			return view.getAccountImportanceOrDefault(key, height);
 		});
 
+		// vrf proofs only depend on the parent generation hash, so they are calculated at most once per parent
+		if (m_hitCandidatesParentGenerationHash != context.ParentContext.GenerationHash) {
+			m_hitCandidatesParentGenerationHash = context.ParentContext.GenerationHash;
+			m_hitCandidates.clear();
+		}
+
 		auto unlockedAccountsView = m_unlockedAccounts.view();
 		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
 		crypto::VrfProof vrfProof;
 
-		unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
+		unlockedAccountsView.forEach([this, &context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
 			hitContext.Signer = descriptor.signingKeyPair().publicKey();
 
-			vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
-			hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
+			const auto& hitCandidate = findOrCreateHitCandidate(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
+			hitContext.GenerationHash = hitCandidate.GenerationHash;
 			if (hitPredicate(hitContext)) {
 				pHarvesterKeyPair = &descriptor.signingKeyPair();
+				vrfProof = hitCandidate.VrfProof;
 				return false;
 			}
 
@@ -141,4 +148,16 @@ namespace catapult { namespace harvesting {
 
 		return pBlock;
 	}
+
+	const Harvester::HitCandidate& Harvester::findOrCreateHitCandidate(
+			const GenerationHash& parentGenerationHash,
+			const crypto::KeyPair& vrfKeyPair) {
+		auto iter = m_hitCandidates.find(vrfKeyPair.publicKey());
+		if (m_hitCandidates.cend() != iter)
+			return iter->second;
+
+		auto vrfProof = crypto::GenerateVrfProof(parentGenerationHash, vrfKeyPair);
+		auto generationHash = model::CalculateGenerationHash(vrfProof.Gamma);
+		return m_hitCandidates.emplace(vrfKeyPair.publicKey(), HitCandidate{ vrfProof, generationHash }).first->second;
+	}
 }}
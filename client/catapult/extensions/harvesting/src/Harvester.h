@@ -23,9 +23,12 @@
 #include "HarvesterBlockGenerator.h"
 #include "UnlockedAccounts.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/crypto/Vrf.h"
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/Elements.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
 
 namespace catapult { namespace harvesting { struct BlockExecutionHashes; } }
 
@@ -46,13 +49,25 @@ namespace catapult { namespace harvesting {
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
+		/// \note Vrf proofs of unlocked accounts are reused across calls as long as the parent generation hash is unchanged.
 		std::unique_ptr<model::Block> harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp);
 
+	private:
+		struct HitCandidate {
+			crypto::VrfProof VrfProof;
+			catapult::GenerationHash GenerationHash;
+		};
+
+		const HitCandidate& findOrCreateHitCandidate(const GenerationHash& parentGenerationHash, const crypto::KeyPair& vrfKeyPair);
+
 	private:
 		const cache::CatapultCache& m_cache;
 		const model::BlockchainConfiguration m_config;
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+
+		GenerationHash m_hitCandidatesParentGenerationHash;
+		std::unordered_map<Key, HitCandidate, utils::ArrayHasher<Key>> m_hitCandidates;
 	};
 }}
@@ -548,6 +548,86 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region vrf proof reuse
+
+	namespace {
+		bool IsGenerationHashProofValid(const HarvesterContext& context, const model::Block& block) {
+			for (auto i = 0u; i < Num_Accounts; ++i) {
+				if (context.SigningKeyPairs[i].publicKey() != block.SignerPublicKey)
+					continue;
+
+				const auto& vrfProof = block.GenerationHashProof;
+				auto vrfPublicKey = context.VrfKeyPairs[i].publicKey();
+				return Hash512() != crypto::VerifyVrfProof(vrfProof, context.LastBlockElement.GenerationHash, vrfPublicKey);
+			}
+
+			return false;
+		}
+	}
+
+	TEST(TEST_CLASS, HarvestReturnsSameProofWhenParentIsUnchanged) {
+		// Arrange:
+		HarvesterContext context;
+		auto pHarvester = context.CreateHarvester();
+
+		// Act:
+		auto pBlock1 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+		auto pBlock2 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock1);
+		ASSERT_TRUE(!!pBlock2);
+		EXPECT_EQ(pBlock1->SignerPublicKey, pBlock2->SignerPublicKey);
+		EXPECT_EQ(pBlock1->GenerationHashProof.Gamma, pBlock2->GenerationHashProof.Gamma);
+		EXPECT_TRUE(IsGenerationHashProofValid(context, *pBlock2));
+	}
+
+	TEST(TEST_CLASS, HarvestRecalculatesProofWhenParentGenerationHashChanges) {
+		// Arrange:
+		HarvesterContext context;
+		auto pHarvester = context.CreateHarvester();
+		auto pBlock1 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Act:
+		context.LastBlockElement.GenerationHash = test::GenerateRandomByteArray<GenerationHash>();
+		auto pBlock2 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock1);
+		ASSERT_TRUE(!!pBlock2);
+		EXPECT_NE(pBlock1->GenerationHashProof.Gamma, pBlock2->GenerationHashProof.Gamma);
+		EXPECT_TRUE(IsGenerationHashProofValid(context, *pBlock2));
+	}
+
+	TEST(TEST_CLASS, HarvestCalculatesProofForAccountUnlockedAfterPreviousHarvest) {
+		// Arrange: lock all accounts
+		HarvesterContext context;
+		{
+			auto modifier = context.pUnlockedAccounts->modifier();
+			for (const auto& keyPair : context.SigningKeyPairs)
+				modifier.remove(keyPair.publicKey());
+		}
+
+		auto pHarvester = context.CreateHarvester();
+		auto pBlock1 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// - unlock a single account
+		context.pUnlockedAccounts->modifier().add(BlockGeneratorAccountDescriptor(
+				test::CopyKeyPair(context.SigningKeyPairs[2]),
+				test::CopyKeyPair(context.VrfKeyPairs[2])));
+
+		// Act:
+		auto pBlock2 = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock1);
+		ASSERT_TRUE(!!pBlock2);
+		EXPECT_EQ(context.SigningKeyPairs[2].publicKey(), pBlock2->SignerPublicKey);
+		EXPECT_TRUE(IsGenerationHashProofValid(context, *pBlock2));
+	}
+
+	// endregion
+
 	// region block generator delegation
 
 	namespace {
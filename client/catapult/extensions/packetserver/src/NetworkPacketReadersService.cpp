@@ -60,13 +60,14 @@ namespace catapult { namespace packetserver {
 						net::CreatePacketReaders,
 						state.packetHandlers(),
 						locator.keys().caPublicKey(),
-						extensions::GetConnectionSettings(config),
+						extensions::GetConnectionSettings(config, state.socketWorkingBufferPool()),
 						config.Node.MaxIncomingConnectionsPerIdentity);
 				extensions::BootServer(
 						*pServiceGroup,
 						config.Node.Port,
 						Service_Id,
 						config,
+						state.socketWorkingBufferPool(),
 						state.timeSupplier(),
 						state.nodeSubscriber(),
 						*pReaders);
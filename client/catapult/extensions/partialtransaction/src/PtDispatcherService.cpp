@@ -60,6 +60,8 @@ namespace catapult { namespace partialtransaction {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
+			options.MaxConsumerBatchSize = config.TransactionDisruptorMaxBatchSize;
 			return options;
 		}
 
@@ -268,6 +270,7 @@ namespace catapult { namespace partialtransaction {
 
 				auto pDispatcher = dispatcherBuilder.build(*pPtUpdater, CreateNewTransactionSink(locator));
 				RegisterTransactionDispatcherService(pDispatcher, *pPtUpdater, locator, state);
+				extensions::AddDispatcherStatisticsCounters(locator, Service_Name, "PT", pDispatcher->size());
 
 				// extend the lifetimes of pDispatcher and pPtUpdater
 				pServiceGroup->registerService(std::make_shared<DispatcherServiceRegistrar>(pDispatcher, std::move(pPtUpdater)));
@@ -58,6 +58,7 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include <filesystem>
 
 using namespace catapult::consumers;
@@ -87,6 +88,7 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.BlockDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -95,13 +97,15 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
+			options.MaxConsumerBatchSize = config.TransactionDisruptorMaxBatchSize;
 			return options;
 		}
 
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorBatchConsumer>&& disruptorConsumers) {
 			auto& nodeSubscriber = state.nodeSubscriber();
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
@@ -134,7 +138,8 @@ namespace catapult { namespace sync {
 				CATAPULT_LOG(debug) << "enabling auditing to " << auditPath;
 
 				config::CatapultDirectory(auditPath).createAll();
-				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				auto auditConsumer = DisruptorBatchConsumerFromConsumer(CreateAuditConsumer(auditPath.generic_string()));
+				disruptorConsumers.insert(disruptorConsumers.begin(), auditConsumer);
 			}
 
 			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
@@ -150,7 +155,8 @@ namespace catapult { namespace sync {
 
 		BlockchainProcessor CreateSyncProcessor(
 				const model::BlockchainConfiguration& blockchainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::ExecutionConfiguration& executionConfig,
+				thread::IoThreadPool& validatorPool) {
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockchainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockchainConfig, [view](const auto& publicKey, auto height) {
@@ -160,10 +166,14 @@ namespace catapult { namespace sync {
 			return CreateBlockchainProcessor(
 					blockHitPredicateFactory,
 					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockchainConfig));
+					GetReceiptValidationMode(blockchainConfig),
+					validatorPool);
 		}
 
-		BlockchainSyncHandlers CreateBlockchainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockchainSyncHandlers CreateBlockchainSyncHandlers(
+				extensions::ServiceState& state,
+				thread::IoThreadPool& validatorPool,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockchainConfig = state.config().Blockchain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -187,7 +197,10 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockchainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(
+					blockchainConfig,
+					extensions::CreateExecutionConfiguration(pluginManager),
+					validatorPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -219,10 +232,12 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(thread::IoThreadPool& validatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						validatorPool,
+						m_nodeConfig.BlockMinParallelTransactionsHashCount));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
@@ -249,7 +264,7 @@ namespace catapult { namespace sync {
 						m_state.config().Blockchain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
-						CreateBlockchainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockchainSyncHandlers(m_state, validatorPool, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockchainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -262,7 +277,7 @@ namespace catapult { namespace sync {
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						DisruptorBatchConsumersFromConsumers(disruptorConsumers));
 			}
 
 		private:
@@ -323,16 +338,19 @@ namespace catapult { namespace sync {
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
 						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
 						failedTransactionSink));
-				m_consumers.push_back(CreateTransactionBatchSignatureConsumer(
+
+				// signatures from all transaction elements claimed at once are verified together
+				auto disruptorConsumers = DisruptorBatchConsumersFromConsumers(DisruptorConsumersFromTransactionConsumers(m_consumers));
+				disruptorConsumers.push_back(CreateCoalescingTransactionBatchSignatureConsumer(
 						m_state.config().Blockchain.Network.GenerationHashSeed,
 						CreateRandomFiller(),
 						m_state.pluginManager().createNotificationPublisher(),
 						validatorPool,
+						m_nodeConfig.TransactionDisruptorMaxCoalescingDelay,
 						failedTransactionSink));
 
 				const auto& banningConfig = m_nodeConfig.Banning;
-				auto disruptorConsumers = DisruptorConsumersFromTransactionConsumers(m_consumers);
-				disruptorConsumers.push_back(CreateNewTransactionsConsumer(
+				disruptorConsumers.push_back(DisruptorBatchConsumerFromConsumer(CreateNewTransactionsConsumer(
 						banningConfig.MinTransactionFailuresCountForBan,
 						banningConfig.MinTransactionFailuresPercentForBan,
 						[&utUpdater, newTransactionsSink = m_state.hooks().newTransactionsSink()](auto&& transactionInfos) {
@@ -340,7 +358,7 @@ namespace catapult { namespace sync {
 							auto updateResults = utUpdater.update(transactionInfos);
 							newTransactionsSink(chain::SelectValid(std::move(transactionInfos), updateResults));
 							return chain::AggregateUpdateResults(updateResults);
-						}));
+						})));
 
 				return CreateConsumerDispatcher(
 						m_state,
@@ -391,7 +409,20 @@ namespace catapult { namespace sync {
 
 		// endregion
 
-		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
+		chain::UtUpdaterParallelOptions CreateUtUpdaterParallelOptions(thread::IoThreadPool& pool, uint32_t minParallelTransactionsCount) {
+			chain::UtUpdaterParallelOptions options;
+			options.MinParallelTransactionsCount = minParallelTransactionsCount;
+			options.MaxPartitions = pool.numWorkerThreads();
+			options.ProcessPartitions = [&pool](auto numPartitions, const auto& processPartition) {
+				thread::ParallelForPartitionIndexes(pool.ioContext(), numPartitions, processPartition).get();
+			};
+			return options;
+		}
+
+		chain::UtUpdater& CreateAndRegisterUtUpdater(
+				extensions::ServiceLocator& locator,
+				extensions::ServiceState& state,
+				thread::IoThreadPool& validatorPool) {
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
 					state.cache(),
@@ -399,7 +430,8 @@ namespace catapult { namespace sync {
 					extensions::CreateExecutionConfiguration(state.pluginManager()),
 					state.timeSupplier(),
 					extensions::SubscriberToSink(state.transactionStatusSubscriber()),
-					CreateUtUpdaterThrottle(state.config()));
+					CreateUtUpdaterThrottle(state.config()),
+					CreateUtUpdaterParallelOptions(validatorPool, state.config().Node.TransactionMinParallelRebaseCount));
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
@@ -432,6 +464,15 @@ namespace catapult { namespace sync {
 			});
 		}
 
+		void AddUtRebaseCounter(
+				extensions::ServiceLocator& locator,
+				const std::string& counterName,
+				uint64_t chain::UtUpdaterRebaseStatistics::*pStatistic) {
+			locator.registerServiceCounter<chain::UtUpdater>("dispatcher.utUpdater", counterName, [pStatistic](const auto& utUpdater) {
+				return utUpdater.rebaseStatistics().*pStatistic;
+			});
+		}
+
 		class DispatcherServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -446,19 +487,25 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				using RebaseStatistics = chain::UtUpdaterRebaseStatistics;
+				AddUtRebaseCounter(locator, "UT RB ALL", &RebaseStatistics::NumRebases);
+				AddUtRebaseCounter(locator, "UT RB TXES", &RebaseStatistics::NumTransactions);
+				AddUtRebaseCounter(locator, "UT RB ADDED", &RebaseStatistics::NumAddedTransactions);
+				AddUtRebaseCounter(locator, "UT RB MS", &RebaseStatistics::ElapsedMillis);
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// create shared services
 				auto* pValidatorPool = state.pool().pushIsolatedPool("validator");
-				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state);
+				auto& utUpdater = CreateAndRegisterUtUpdater(locator, state, *pValidatorPool);
 
 				// create the block and transaction dispatchers and related services
 				// (notice that the dispatcher service group must be after the validator isolated pool in order to allow proper shutdown)
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(*pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
 				transactionDispatcherBuilder.addHashConsumers();
@@ -469,6 +516,10 @@ namespace catapult { namespace sync {
 
 				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
 				RegisterTransactionDispatcherService(pTransactionDispatcher, *pServiceGroup, locator, state);
+
+				// statistics counters depend on the number of consumers, which is only known after the dispatchers are built
+				extensions::AddDispatcherStatisticsCounters(locator, "dispatcher.block", "BLK", pBlockDispatcher->size());
+				extensions::AddDispatcherStatisticsCounters(locator, "dispatcher.transaction", "TX", pTransactionDispatcher->size());
 			}
 		};
 	}
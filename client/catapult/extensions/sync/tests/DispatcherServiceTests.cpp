@@ -48,7 +48,12 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 10u;
+		constexpr size_t CalculateNumExpectedCounters(size_t numBlockConsumers, size_t numTransactionConsumers) {
+			// each dispatcher has three element latency counters and two counters per consumer
+			return 14u + (3 + 2 * numBlockConsumers) + (3 + 2 * numTransactionConsumers);
+		}
+
+		constexpr auto Num_Expected_Counters = CalculateNumExpectedCounters(7, 5);
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -59,6 +64,9 @@ namespace catapult { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Ut_Rebase_All = "UT RB ALL";
+		constexpr auto Ut_Rebase_Transactions = "UT RB TXES";
+		constexpr auto Ut_Rebase_Added_Transactions = "UT RB ADDED";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -363,6 +371,9 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_All));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_Transactions));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_Added_Transactions));
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -387,7 +398,7 @@ namespace catapult { namespace sync {
 
 		// Assert:
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(CalculateNumExpectedCounters(8, 6), context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
@@ -409,7 +420,7 @@ namespace catapult { namespace sync {
 
 		// Assert:
 		EXPECT_EQ(Num_Expected_Services, context.locator().numServices());
-		EXPECT_EQ(Num_Expected_Counters, context.locator().counters().size());
+		EXPECT_EQ(CalculateNumExpectedCounters(8, 5), context.locator().counters().size());
 		EXPECT_EQ(Num_Expected_Tasks, context.testState().state().tasks().size());
 
 		EXPECT_EQ(8u, GetBlockDispatcherStatus(context.locator()).Size);
@@ -445,6 +456,9 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_All));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_Transactions));
+		EXPECT_EQ(0u, context.counter(Ut_Rebase_Added_Transactions));
 	}
 
 	TEST(TEST_CLASS, TasksAreRegistered) {
@@ -683,6 +697,11 @@ namespace catapult { namespace sync {
 			EXPECT_EQ(1u, stateChangeSubscriber.numStateChanges());
 			EXPECT_EQ(model::ChainScore(99'999'999'999'940), stateChangeSubscriber.lastChainScore());
 
+			// - unconfirmed transactions cache was rebased (without any transactions)
+			EXPECT_EQ(1u, context.counter(Ut_Rebase_All));
+			EXPECT_EQ(0u, context.counter(Ut_Rebase_Transactions));
+			EXPECT_EQ(0u, context.counter(Ut_Rebase_Added_Transactions));
+
 			// - commit step index file was updated
 			AssertCommitStepFileUpdated(context);
 		});
@@ -59,6 +59,13 @@ namespace catapult { namespace importance {
 	/// Creates an importance calculator for the blockchain described by \a config.
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockchainConfiguration& config);
 
+	/// Creates an importance calculator for the blockchain described by \a config that spreads the calculation across
+	/// \a numWorkerThreads threads when there are at least \a minParallelAccountsCount high value accounts.
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockchainConfiguration& config,
+			uint32_t numWorkerThreads,
+			size_t minParallelAccountsCount);
+
 	/// Creates a restore importance calculator.
 	std::unique_ptr<ImportanceCalculator> CreateRestoreImportanceCalculator();
 }}
@@ -25,17 +25,76 @@
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/HeightGrouping.h"
 #include "catapult/state/AccountImportanceSnapshots.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
+#include <thread>
 #include <vector>
 
 namespace catapult { namespace importance {
 
 	namespace {
+		constexpr size_t Default_Min_Parallel_Accounts_Count = 10'000;
+
+		using AccountSummaries = std::vector<AccountSummary>;
+
+		// region AccountSummariesProcessor
+
+		// processes account summaries in contiguous partitions, either inline or across a thread pool
+		class AccountSummariesProcessor {
+		public:
+			AccountSummariesProcessor(AccountSummaries& accountSummaries, thread::IoThreadPool* pPool)
+					: m_accountSummaries(accountSummaries)
+					, m_pPool(pPool)
+			{}
+
+		public:
+			size_t numPartitions() const {
+				return m_pPool ? m_pPool->numWorkerThreads() : 1;
+			}
+
+		public:
+			template<typename TAction>
+			void process(TAction action) {
+				if (!m_pPool) {
+					action(m_accountSummaries.begin(), m_accountSummaries.end(), 0);
+					return;
+				}
+
+				std::vector<std::exception_ptr> exceptions(numPartitions());
+				auto partitionCallback = [action, &exceptions](auto itBegin, auto itEnd, auto, auto partitionIndex) {
+					try {
+						action(itBegin, itEnd, partitionIndex);
+					} catch (...) {
+						exceptions[partitionIndex] = std::current_exception();
+					}
+				};
+				thread::ParallelForPartition(m_pPool->ioContext(), m_accountSummaries, numPartitions(), partitionCallback).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			AccountSummaries& m_accountSummaries;
+			thread::IoThreadPool* m_pPool;
+		};
+
+		// endregion
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
-			explicit PosImportanceCalculator(const model::BlockchainConfiguration& config) : m_config(config)
+			PosImportanceCalculator(
+					const model::BlockchainConfiguration& config,
+					uint32_t numWorkerThreads,
+					size_t minParallelAccountsCount)
+					: m_config(config)
+					, m_numWorkerThreads(numWorkerThreads)
+					, m_minParallelAccountsCount(minParallelAccountsCount)
 			{}
 
 		public:
@@ -46,54 +105,117 @@ namespace catapult { namespace importance {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
 				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				//    lookups can modify the delta, so they are always serial
 				const auto& highValueAccounts = cache.highValueAccounts();
 				const auto& highValueAddresses = highValueAccounts.addresses();
-				std::vector<AccountSummary> accountSummaries;
+				AccountSummaries accountSummaries;
 				accountSummaries.reserve(highValueAddresses.size());
+				for (const auto& address : highValueAddresses)
+					accountSummaries.push_back(AccountSummary(AccountActivitySummary(), cache.find(address).get()));
+
+				// each account summary references a distinct account state, so all remaining steps can be partitioned
+				auto pPool = createPool(accountSummaries.size());
+				AccountSummariesProcessor processor(accountSummaries, pPool.get());
 
 				// 2. calculate sums
-				auto importanceGrouping = m_config.ImportanceGrouping;
-				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
-				}
+				auto context = calculateContext(importanceHeight, processor);
 
 				// 3. calculate importance parts
-				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
-				}
+				auto totalActivityImportance = calculateImportances(context, processor);
 
 				// 4. calculate the final importance
-				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
-					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
-					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
-							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
-				}
+				finalizeImportances(importanceHeight, totalActivityImportance, processor);
 
 				CATAPULT_LOG(debug)
 						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)"
-						<< " at height " << importanceHeight;
+						<< " at height " << importanceHeight << " using " << processor.numPartitions() << " partition(s)";
 
 				// 5. disable collection of activity for the removed accounts
 				cache.processHighValueRemovedAccounts(importanceHeight);
 			}
 
 		private:
+			std::unique_ptr<thread::IoThreadPool> createPool(size_t numAccounts) const {
+				if (m_numWorkerThreads < 2 || numAccounts < m_minParallelAccountsCount)
+					return nullptr;
+
+				// recalculation only happens once per importance grouping, so use a short lived pool instead of keeping idle threads
+				auto pPool = thread::CreateIoThreadPool(m_numWorkerThreads, "importance");
+				pPool->start();
+				return pPool;
+			}
+
+			ImportanceCalculationContext calculateContext(
+					model::ImportanceHeight importanceHeight,
+					AccountSummariesProcessor& processor) const {
+				std::vector<ImportanceCalculationContext> partialContexts(processor.numPartitions());
+				processor.process([this, importanceHeight, &partialContexts](auto itBegin, auto itEnd, auto index) {
+					auto importanceGrouping = m_config.ImportanceGrouping;
+					auto mosaicId = m_config.HarvestingMosaicId;
+					auto& partialContext = partialContexts[index];
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						auto& accountSummary = *iter;
+						const auto& accountState = *accountSummary.pAccountState;
+						const auto& activityBuckets = accountState.ActivityBuckets;
+						accountSummary.ActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
+						auto balance = accountState.Balances.get(mosaicId);
+						partialContext.ActiveHarvestingMosaics = partialContext.ActiveHarvestingMosaics + balance;
+						partialContext.TotalBeneficiaryCount += accountSummary.ActivitySummary.BeneficiaryCount;
+						partialContext.TotalFeesPaid = partialContext.TotalFeesPaid + accountSummary.ActivitySummary.TotalFeesPaid;
+					}
+				});
+
+				// reduce partial sums in partition order
+				ImportanceCalculationContext context;
+				for (const auto& partialContext : partialContexts) {
+					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + partialContext.ActiveHarvestingMosaics;
+					context.TotalBeneficiaryCount += partialContext.TotalBeneficiaryCount;
+					context.TotalFeesPaid = context.TotalFeesPaid + partialContext.TotalFeesPaid;
+				}
+
+				return context;
+			}
+
+			Importance calculateImportances(const ImportanceCalculationContext& context, AccountSummariesProcessor& processor) const {
+				std::vector<Importance> partialActivityImportances(processor.numPartitions());
+				processor.process([this, &context, &partialActivityImportances](auto itBegin, auto itEnd, auto index) {
+					auto& partialActivityImportance = partialActivityImportances[index];
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						CalculateImportances(*iter, context, m_config);
+						partialActivityImportance = partialActivityImportance + iter->ActivityImportance;
+					}
+				});
+
+				// reduce partial sums in partition order
+				Importance totalActivityImportance;
+				for (auto partialActivityImportance : partialActivityImportances)
+					totalActivityImportance = totalActivityImportance + partialActivityImportance;
+
+				return totalActivityImportance;
+			}
+
+			void finalizeImportances(
+					model::ImportanceHeight importanceHeight,
+					Importance totalActivityImportance,
+					AccountSummariesProcessor& processor) const {
+				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
+				auto calculateImportance = [this, totalActivityImportance, targetActivityImportanceRaw](const auto& accountSummary) {
+					return calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
+				};
+				processor.process([importanceHeight, calculateImportance](auto itBegin, auto itEnd, auto) {
+					for (auto iter = itBegin; itEnd != iter; ++iter) {
+						const auto& accountSummary = *iter;
+						auto importance = calculateImportance(accountSummary);
+						auto& accountState = *accountSummary.pAccountState;
+						FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
+						auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
+								? importance
+								: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
+						accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+					}
+				});
+			}
+
 			Importance calculateFinalImportance(
 					const AccountSummary& accountSummary,
 					Importance totalActivityImportance,
@@ -110,10 +232,19 @@ namespace catapult { namespace importance {
 
 		private:
 			const model::BlockchainConfiguration m_config;
+			uint32_t m_numWorkerThreads;
+			size_t m_minParallelAccountsCount;
 		};
 	}
 
 	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(const model::BlockchainConfiguration& config) {
-		return std::make_unique<PosImportanceCalculator>(config);
+		return CreateImportanceCalculator(config, std::thread::hardware_concurrency(), Default_Min_Parallel_Accounts_Count);
+	}
+
+	std::unique_ptr<ImportanceCalculator> CreateImportanceCalculator(
+			const model::BlockchainConfiguration& config,
+			uint32_t numWorkerThreads,
+			size_t minParallelAccountsCount) {
+		return std::make_unique<PosImportanceCalculator>(config, numWorkerThreads, minParallelAccountsCount);
 	}
 }}
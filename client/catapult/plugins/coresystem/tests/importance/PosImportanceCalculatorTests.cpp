@@ -372,6 +372,106 @@ namespace catapult { namespace importance {
 		EXPECT_LT(Importance(), holder.get(Key{ { 2 } }).ImportanceSnapshots.current());
 	}
 
+	// region parallel
+
+	namespace {
+		struct AccountImportanceResult {
+			Importance CurrentImportance;
+			uint64_t RawScore;
+		};
+
+		std::vector<AccountSeed> CreateAccountSeedsWithActivity(const model::BlockchainConfiguration& config) {
+			std::vector<AccountSeed> accountSeeds;
+			for (auto i = 1u; i <= Num_Account_States; ++i) {
+				auto amount = Amount(i * config.MinHarvesterBalance.unwrap());
+				std::vector<state::AccountActivityBuckets::ActivityBucket> buckets;
+				buckets.push_back(CreateActivityBucket(Amount(i * 20), i * 10, Recalculation_Height - model::ImportanceHeight(2)));
+				buckets.push_back(CreateActivityBucket(Amount(i * 180), i * 90, Recalculation_Height - model::ImportanceHeight(1)));
+				accountSeeds.emplace_back(amount, buckets);
+			}
+
+			return accountSeeds;
+		}
+
+		template<typename TTraits>
+		std::vector<AccountImportanceResult> RecalculateAndCollect(std::unique_ptr<ImportanceCalculator>&& pCalculator) {
+			// Arrange:
+			auto config = TTraits::CreateConfiguration();
+			CacheHolder holder(config.MinHarvesterBalance);
+			holder.seedDelta(CreateAccountSeedsWithActivity(config), Recalculation_Height);
+
+			// Act:
+			RecalculateTwice(*pCalculator, Recalculation_Height, holder.delta());
+
+			// Assert:
+			std::vector<AccountImportanceResult> results;
+			for (uint8_t i = 1; i <= Num_Account_States; ++i) {
+				const auto& accountState = holder.get(Key{ { i } });
+				auto rawScore = accountState.ActivityBuckets.get(Recalculation_Height).RawScore;
+				results.push_back({ accountState.ImportanceSnapshots.current(), rawScore });
+			}
+
+			return results;
+		}
+
+		template<typename TTraits>
+		void AssertParallelCalculationMatchesSequentialCalculation(uint32_t numWorkerThreads) {
+			// Arrange:
+			auto config = TTraits::CreateConfiguration();
+
+			// Act:
+			auto expectedResults = RecalculateAndCollect<TTraits>(CreateImportanceCalculator(config, 1, 0));
+			auto results = RecalculateAndCollect<TTraits>(CreateImportanceCalculator(config, numWorkerThreads, 0));
+
+			// Assert:
+			ASSERT_EQ(expectedResults.size(), results.size());
+			for (auto i = 0u; i < results.size(); ++i) {
+				EXPECT_LT(Importance(), results[i].CurrentImportance) << "account " << i;
+				EXPECT_EQ(expectedResults[i].CurrentImportance, results[i].CurrentImportance) << "account " << i;
+				EXPECT_EQ(expectedResults[i].RawScore, results[i].RawScore) << "account " << i;
+			}
+		}
+	}
+
+	ACTIVITY_BASED_TEST(ParallelCalculationMatchesSequentialCalculation) {
+		AssertParallelCalculationMatchesSequentialCalculation<TTraits>(4);
+	}
+
+	ACTIVITY_BASED_TEST(ParallelCalculationMatchesSequentialCalculationWhenThereAreMoreThreadsThanAccounts) {
+		AssertParallelCalculationMatchesSequentialCalculation<TTraits>(2 * Num_Account_States);
+	}
+
+	ACTIVITY_BASED_TEST(ParallelCalculationMatchesSequentialCalculationBelowMinParallelAccountsCount) {
+		// Arrange:
+		auto config = TTraits::CreateConfiguration();
+
+		// Act:
+		auto expectedResults = RecalculateAndCollect<TTraits>(CreateImportanceCalculator(config, 1, 0));
+		auto results = RecalculateAndCollect<TTraits>(CreateImportanceCalculator(config, 4, Num_Account_States + 1));
+
+		// Assert:
+		ASSERT_EQ(expectedResults.size(), results.size());
+		for (auto i = 0u; i < results.size(); ++i)
+			EXPECT_EQ(expectedResults[i].CurrentImportance, results[i].CurrentImportance) << "account " << i;
+	}
+
+	TEST(TEST_CLASS, ParallelCalculationPropagatesExceptions) {
+		// Arrange: add a bucket above the recalculation height
+		auto config = CreateBlockchainConfiguration(10);
+		auto accountSeeds = CreateAccountSeedsWithActivity(config);
+		auto invalidBucketHeight = Recalculation_Height + model::ImportanceHeight(1);
+		accountSeeds[Num_Account_States / 2].Buckets.push_back(CreateActivityBucket(Amount(1), 1, invalidBucketHeight));
+
+		CacheHolder holder(config.MinHarvesterBalance);
+		holder.seedDelta(accountSeeds, Recalculation_Height);
+		auto pCalculator = CreateImportanceCalculator(config, 4, 0);
+
+		// Act + Assert:
+		EXPECT_THROW(Recalculate(*pCalculator, Recalculation_Height, holder.delta()), catapult_invalid_argument);
+	}
+
+	// endregion
+
 	// region pure pos
 
 	TEST(TEST_CLASS, PosGivesAccountsImportanceProportionalToBalance) {
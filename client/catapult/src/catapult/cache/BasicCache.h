@@ -66,6 +66,11 @@ namespace catapult { namespace cache {
 			Commit(m_set, delta, typename TBaseSet::IsOrderedSet());
 		}
 
+		/// Waits until all committed changes have been synced to the underlying storage.
+		void sync() {
+			m_set.sync();
+		}
+
 	private:
 		template<typename TView, typename TSetView>
 		TView createSubView(const TSetView& setView) const {
@@ -46,6 +46,13 @@ namespace catapult { namespace cache {
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
 		{}
 
+	public:
+		/// Waits until all flushed changes have been synced to the database.
+		void sync() {
+			if (deltaset::ConditionalContainerMode::Storage == m_containerMode)
+				database().sync();
+		}
+
 	protected:
 		/// Returns \c true if patricia tree support is enabled.
 		bool hasPatriciaTreeSupport() const {
@@ -26,13 +26,12 @@
 #include "catapult/deltaset/BaseSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 #include "catapult/deltaset/OrderedSet.h"
-#include <unordered_map>
 
 namespace catapult { namespace cache {
 
 	namespace detail {
 		/// Defines cache types for an unordered map based cache.
-		template<typename TElementTraits, typename TDescriptor, typename TValueHasher>
+		template<typename TElementTraits, typename TDescriptor, typename TValueHasher, typename TMapStoragePolicy>
 		struct UnorderedMapAdapter {
 		private:
 			struct DescriptorAdapter {
@@ -60,7 +59,10 @@ namespace catapult { namespace cache {
 			};
 
 			using StorageMapType = CacheContainerView<DescriptorAdapter>;
-			using MemoryMapType = std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>;
+			using MemoryMapType = typename TMapStoragePolicy::template MapType<
+				typename TDescriptor::KeyType,
+				typename TDescriptor::ValueType,
+				TValueHasher>;
 
 			struct Converter {
 				using ValueType = typename TDescriptor::ValueType;
@@ -96,18 +98,28 @@ namespace catapult { namespace cache {
 	}
 
 	/// Defines cache types for an unordered mutable map based cache.
-	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	template<
+			typename TDescriptor,
+			typename TValueHasher = std::hash<typename TDescriptor::KeyType>,
+			typename TMapStoragePolicy = deltaset::UnorderedMapStoragePolicy
+	>
 	using MutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		TValueHasher,
+		TMapStoragePolicy>;
 
 	/// Defines cache types for an unordered immutable map based cache.
-	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	template<
+			typename TDescriptor,
+			typename TValueHasher = std::hash<typename TDescriptor::KeyType>,
+			typename TMapStoragePolicy = deltaset::UnorderedMapStoragePolicy
+	>
 	using ImmutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		TValueHasher,
+		TMapStoragePolicy>;
 
 	namespace detail {
 		/// Defines cache types for an ordered, memory backed set based cache.
@@ -28,6 +28,8 @@
 #include "catapult/model/BlockchainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -88,6 +90,37 @@ namespace catapult { namespace cache {
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
+
+		void UpdateMerkleRootsParallel(
+				const std::vector<std::unique_ptr<SubCacheView>>& subViews,
+				Height height,
+				thread::IoThreadPool& pool) {
+			utils::SlowOperationLogger logger("UpdateMerkleRootsParallel", utils::LogLevel::warning);
+
+			// each sub cache owns an independent merkle tree, so all trees can be updated concurrently
+			std::vector<SubCacheView*> merkleSubViews;
+			for (const auto& pSubView : subViews) {
+				if (pSubView && pSubView->supportsMerkleRoot())
+					merkleSubViews.push_back(pSubView.get());
+			}
+
+			std::vector<std::exception_ptr> exceptions(merkleSubViews.size());
+			auto numPartitions = merkleSubViews.size();
+			thread::ParallelFor(pool.ioContext(), merkleSubViews, numPartitions, [height, &exceptions](auto* pSubView, auto index) {
+				try {
+					pSubView->updateMerkleRoot(height);
+				} catch (...) {
+					exceptions[index] = std::current_exception();
+				}
+
+				return true;
+			}).get();
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
 	}
 
 	// region CatapultCacheView
@@ -158,6 +191,11 @@ namespace catapult { namespace cache {
 		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
 	}
 
+	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height, thread::IoThreadPool& pool) const {
+		UpdateMerkleRootsParallel(m_subViews, height, pool);
+		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+	}
+
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
 		auto merkleRootIndex = 0u;
 		for (const auto& pSubView : m_subViews) {
@@ -334,6 +372,13 @@ namespace catapult { namespace cache {
 		cacheHeightModifier.set(height);
 	}
 
+	void CatapultCache::sync() {
+		for (const auto& pSubCache : m_subCaches) {
+			if (pSubCache)
+				pSubCache->sync();
+		}
+	}
+
 	std::vector<std::unique_ptr<const CacheStorage>> CatapultCache::storages() const {
 		return MapSubCaches<const CacheStorage>(
 				m_subCaches,
@@ -73,6 +73,9 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
 		void commit(Height height);
 
+		/// Waits until all committed changes have been synced to the underlying storage.
+		void sync();
+
 	public:
 		/// Gets the (const) cache storages for all sub caches.
 		std::vector<std::unique_ptr<const CacheStorage>> storages() const;
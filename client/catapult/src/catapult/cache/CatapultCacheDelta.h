@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace cache { class ReadOnlyCatapultCache; }
 	namespace state { struct CatapultState; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -84,6 +85,9 @@ namespace catapult { namespace cache {
 		/// Calculates the cache state hash given \a height.
 		StateHashInfo calculateStateHash(Height height) const;
 
+		/// Calculates the cache state hash given \a height by updating all sub cache merkle roots in parallel using \a pool.
+		StateHashInfo calculateStateHash(Height height, thread::IoThreadPool& pool) const;
+
 		/// Sets the merkle roots for all sub caches (\a subCacheMerkleRoots).
 		void setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots);
 
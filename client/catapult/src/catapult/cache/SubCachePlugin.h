@@ -145,6 +145,9 @@ namespace catapult { namespace cache {
 		/// Commits all pending changes to the underlying storage.
 		virtual void commit() = 0;
 
+		/// Waits until all committed changes have been synced to the underlying storage.
+		virtual void sync() = 0;
+
 	public:
 		/// Gets a const pointer to the underlying cache.
 		virtual const void* get() const = 0;
@@ -71,6 +71,10 @@ namespace catapult { namespace cache {
 			m_pCache->commit();
 		}
 
+		void sync() override {
+			m_pCache->sync();
+		}
+
 	public:
 		const void* get() const override {
 			return m_pCache.get();
@@ -256,7 +256,17 @@ namespace catapult { namespace cache {
 			++m_commitCounter;
 		}
 
+		/// Waits until all committed changes have been synced to the underlying storage.
+		void sync() {
+			m_cache.sync();
+		}
+
 	protected:
+		/// Gets a typed (const) reference to the underlying cache.
+		const TCache& cache() const {
+			return m_cache;
+		}
+
 		/// Gets a typed reference to the underlying cache.
 		TCache& cache() {
 			return m_cache;
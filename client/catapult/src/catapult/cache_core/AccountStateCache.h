@@ -57,10 +57,10 @@ namespace catapult { namespace cache {
 
 		/// Commits all pending changes to the underlying storage.
 		/// \note This hides AccountStateBasicCache::commit.
+		/// \note High value addresses are updated in place so that only sets changed by the delta are replaced.
 		void commit(CacheDeltaType& delta) {
-			auto highValueAccounts = delta.detachHighValueAccounts();
+			delta.detachHighValueAccounts(*m_pHighValueAccounts);
 			AccountStateBasicCache::commit(delta);
-			*m_pHighValueAccounts = std::move(highValueAccounts);
 		}
 
 	private:
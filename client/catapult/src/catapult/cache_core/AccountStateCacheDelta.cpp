@@ -200,6 +200,10 @@ namespace catapult { namespace cache {
 		return m_highValueAccountsUpdater.detachAccounts();
 	}
 
+	void BasicAccountStateCacheDelta::detachHighValueAccounts(HighValueAccounts& highValueAccounts) {
+		m_highValueAccountsUpdater.detachAccounts(highValueAccounts);
+	}
+
 	void BasicAccountStateCacheDelta::prune(Height height) {
 		m_highValueAccountsUpdater.prune(model::CalculateGroupedHeight<Height>(height, m_options.VotingSetGrouping));
 	}
@@ -162,6 +162,10 @@ namespace catapult { namespace cache {
 		/// Detaches high value accounts from this delta.
 		HighValueAccounts detachHighValueAccounts();
 
+		/// Detaches high value accounts from this delta into \a highValueAccounts, which must be the container
+		/// this delta was created around.
+		void detachHighValueAccounts(HighValueAccounts& highValueAccounts);
+
 		/// Prunes the cache at \a height.
 		void prune(Height height);
 
@@ -172,7 +172,11 @@ namespace catapult { namespace cache {
 	// endregion
 
 	public:
-		using PrimaryTypes = MutableUnorderedMapAdapter<AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
+		// account states are looked up and copied frequently during block execution, so use flat map storage
+		using PrimaryTypes = MutableUnorderedMapAdapter<
+			AccountStateCacheDescriptor,
+			utils::ArrayHasher<Address>,
+			deltaset::FlatMapStoragePolicy>;
 		using KeyLookupMapTypes = ImmutableUnorderedMapAdapter<KeyLookupMapTypesDescriptor, utils::ArrayHasher<Key>>;
 
 	public:
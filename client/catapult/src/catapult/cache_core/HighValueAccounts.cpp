@@ -61,6 +61,25 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region CopyOnWriteAddressSet
+
+	bool CopyOnWriteAddressSet::contains(const Address& address) const {
+		const auto& addresses = get();
+		return addresses.cend() != addresses.find(address);
+	}
+
+	void CopyOnWriteAddressSet::insert(const Address& address) {
+		if (!contains(address))
+			modify().insert(address);
+	}
+
+	void CopyOnWriteAddressSet::erase(const Address& address) {
+		if (contains(address))
+			modify().erase(address);
+	}
+
+	// endregion
+
 	// region HighValueAddressesUpdater
 
 	namespace {
@@ -78,8 +97,8 @@ namespace catapult { namespace cache {
 		public:
 			HighValueAddressesUpdater(
 					const model::AddressSet& originalAddresses,
-					model::AddressSet& currentAddresses,
-					model::AddressSet& removedAddresses)
+					CopyOnWriteAddressSet& currentAddresses,
+					CopyOnWriteAddressSet& removedAddresses)
 					: m_original(originalAddresses)
 					, m_current(currentAddresses)
 					, m_removed(removedAddresses)
@@ -107,8 +126,8 @@ namespace catapult { namespace cache {
 
 		private:
 			const model::AddressSet& m_original;
-			model::AddressSet& m_current;
-			model::AddressSet& m_removed;
+			CopyOnWriteAddressSet& m_current;
+			CopyOnWriteAddressSet& m_removed;
 		};
 	}
 
@@ -124,7 +143,7 @@ namespace catapult { namespace cache {
 			using MemorySetType = AccountStateCacheTypes::PrimaryTypes::BaseSetDeltaType::SetType::MemorySetType;
 
 		public:
-			HighValueBalancesUpdater(AddressAccountHistoryMap& accountHistories, Height height)
+			HighValueBalancesUpdater(CopyOnWriteAccountHistoryMap& accountHistories, Height height)
 					: m_accountHistories(accountHistories)
 					, m_height(height)
 			{}
@@ -136,34 +155,60 @@ namespace catapult { namespace cache {
 			}
 
 			void pruneGreater() {
-				for (auto& pair : m_accountHistories)
+				const auto& accountHistories = m_accountHistories.get();
+				auto hasValueAfter = [height = m_height](const auto& pair) { return pair.second.hasValueAfter(height); };
+				if (std::none_of(accountHistories.cbegin(), accountHistories.cend(), hasValueAfter))
+					return;
+
+				for (auto& pair : m_accountHistories.modify())
 					pair.second.pruneGreater(m_height);
 			}
 
 			void prune(Amount minBalance) {
-				utils::map_erase_if(m_accountHistories, [minBalance](const auto& pair) {
-					return !pair.second.anyAtLeast(minBalance);
-				});
+				const auto& accountHistories = m_accountHistories.get();
+				auto isLowValue = [minBalance](const auto& pair) { return !pair.second.anyAtLeast(minBalance); };
+				if (std::none_of(accountHistories.cbegin(), accountHistories.cend(), isLowValue))
+					return;
+
+				utils::map_erase_if(m_accountHistories.modify(), isLowValue);
 			}
 
 		private:
 			void updateOne(const state::AccountState& accountState, const std::pair<Amount, bool>& effectiveBalancePair) {
-				auto accountHistoriesIter = m_accountHistories.find(accountState.Address);
-
-				// if this account has a newly high balance, start tracking it
-				if (m_accountHistories.cend() == accountHistoriesIter && effectiveBalancePair.second)
-					accountHistoriesIter = m_accountHistories.emplace(accountState.Address, state::AccountHistory()).first;
+				const auto& accountHistories = m_accountHistories.get();
+				auto accountHistoriesIter = accountHistories.find(accountState.Address);
+				auto isTracked = accountHistories.cend() != accountHistoriesIter;
+
+				// ignore accounts that are not tracked and do not have a newly high balance
+				if (!isTracked && !effectiveBalancePair.second)
+					return;
+
+				auto vrfPublicKey = accountState.SupplementalPublicKeys.vrf().get();
+				auto votingPublicKeys = accountState.SupplementalPublicKeys.voting().getAll();
+
+				// ignore tracked accounts with unchanged values because adding them would not modify their histories
+				if (isTracked && IsUnchanged(accountHistoriesIter->second, effectiveBalancePair.first, vrfPublicKey, votingPublicKeys))
+					return;
+
+				// start tracking this account if necessary and add tracked values
+				auto& accountHistory = m_accountHistories.modify()[accountState.Address];
+				accountHistory.add(m_height, effectiveBalancePair.first);
+				accountHistory.add(m_height, vrfPublicKey);
+				accountHistory.add(m_height, votingPublicKeys);
+			}
 
-				// if this account is tracked, add tracked values
-				if (m_accountHistories.cend() != accountHistoriesIter) {
-					accountHistoriesIter->second.add(m_height, effectiveBalancePair.first);
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.vrf().get());
-					accountHistoriesIter->second.add(m_height, accountState.SupplementalPublicKeys.voting().getAll());
-				}
+			static bool IsUnchanged(
+					const state::AccountHistory& accountHistory,
+					Amount balance,
+					const Key& vrfPublicKey,
+					const std::vector<model::PinnedVotingKey>& votingPublicKeys) {
+				return accountHistory.balance().get() == balance
+						&& accountHistory.vrfPublicKey().get() == vrfPublicKey
+						&& accountHistory.votingPublicKeys().get() == votingPublicKeys;
 			}
 
 		private:
-			AddressAccountHistoryMap& m_accountHistories;
+			CopyOnWriteAccountHistoryMap& m_accountHistories;
 			Height m_height;
 		};
 	}
@@ -186,15 +231,15 @@ namespace catapult { namespace cache {
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::addresses() const {
-		return m_current;
+		return m_current.get();
 	}
 
 	const model::AddressSet& HighValueAccountsUpdater::removedAddresses() const {
-		return m_removed;
+		return m_removed.get();
 	}
 
 	const AddressAccountHistoryMap& HighValueAccountsUpdater::accountHistories() const {
-		return m_accountHistories;
+		return m_accountHistories.get();
 	}
 
 	void HighValueAccountsUpdater::setHeight(Height height) {
@@ -202,7 +247,7 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::setRemovedAddresses(model::AddressSet&& removedAddresses) {
-		m_removed = std::move(removedAddresses);
+		m_removed.reset(std::move(removedAddresses));
 	}
 
 	void HighValueAccountsUpdater::update(const deltaset::DeltaElements<MemorySetType>& deltas) {
@@ -211,20 +256,20 @@ namespace catapult { namespace cache {
 	}
 
 	void HighValueAccountsUpdater::prune(Height height) {
-		utils::map_erase_if(m_accountHistories, [height, minBalance = m_options.MinVoterBalance](auto& pair) {
+		utils::map_erase_if(m_accountHistories.modify(), [height, minBalance = m_options.MinVoterBalance](auto& pair) {
 			pair.second.pruneLess(height);
 			return !pair.second.anyAtLeast(minBalance);
 		});
 	}
 
 	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
-		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_removed), std::move(m_accountHistories));
-
-		m_current.clear();
-		m_removed.clear();
-		m_accountHistories.clear();
+		return HighValueAccounts(m_current.detach(), m_removed.detach(), m_accountHistories.detach());
+	}
 
-		return accounts;
+	void HighValueAccountsUpdater::detachAccounts(HighValueAccounts& accounts) {
+		m_current.detachInto(accounts.m_addresses);
+		m_removed.detachInto(accounts.m_removedAddresses);
+		m_accountHistories.detachInto(accounts.m_accountHistories);
 	}
 
 	namespace {
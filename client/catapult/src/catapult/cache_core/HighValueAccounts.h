@@ -23,12 +23,15 @@
 #include "AccountStateCacheTypes.h"
 #include "catapult/model/ContainerTypes.h"
 #include "catapult/state/AccountHistory.h"
+#include <optional>
 
 namespace catapult { namespace cache {
 
 	/// Map of addresses to account histories.
 	using AddressAccountHistoryMap = std::unordered_map<Address, state::AccountHistory, utils::ArrayHasher<Address>>;
 
+	class HighValueAccountsUpdater;
+
 	/// High value accounts container.
 	class HighValueAccounts {
 	public:
@@ -62,8 +65,83 @@ namespace catapult { namespace cache {
 		model::AddressSet m_addresses;
 		model::AddressSet m_removedAddresses;
 		AddressAccountHistoryMap m_accountHistories;
+
+		friend class HighValueAccountsUpdater;
+	};
+
+	/// Container that shares an original container until it is first modified.
+	template<typename TContainer>
+	class CopyOnWriteContainer {
+	public:
+		/// Creates a container around \a original.
+		explicit CopyOnWriteContainer(const TContainer& original) : m_pOriginal(&original)
+		{}
+
+	public:
+		/// Gets the current container.
+		const TContainer& get() const {
+			return m_copy ? *m_copy : *m_pOriginal;
+		}
+
+		/// Returns \c true if the original container has been copied.
+		bool isCopied() const {
+			return !!m_copy;
+		}
+
+	public:
+		/// Gets the current container for modification and copies the original container if it has not been copied.
+		TContainer& modify() {
+			if (!m_copy)
+				m_copy = *m_pOriginal;
+
+			return *m_copy;
+		}
+
+		/// Replaces the current container with \a container.
+		void reset(TContainer&& container) {
+			m_copy = std::move(container);
+		}
+
+		/// Moves the copied container into \a container when the original container has been copied.
+		void detachInto(TContainer& container) {
+			if (m_copy)
+				container = std::move(*m_copy);
+
+			m_copy.emplace();
+		}
+
+		/// Moves the current container out of this container and leaves it empty.
+		TContainer detach() {
+			auto container = m_copy ? std::move(*m_copy) : *m_pOriginal;
+			m_copy.emplace();
+			return container;
+		}
+
+	private:
+		const TContainer* m_pOriginal;
+		std::optional<TContainer> m_copy;
 	};
 
+	/// Address set that shares an original set until it is first modified.
+	class CopyOnWriteAddressSet : public CopyOnWriteContainer<model::AddressSet> {
+	public:
+		using CopyOnWriteContainer<model::AddressSet>::CopyOnWriteContainer;
+
+	public:
+		/// Returns \c true if \a address is contained in the current addresses.
+		bool contains(const Address& address) const;
+
+	public:
+		/// Inserts \a address and copies the original set only if \a address is not already contained.
+		void insert(const Address& address);
+
+		/// Erases \a address and copies the original set only if \a address is contained.
+		void erase(const Address& address);
+	};
+
+	/// Account history map that shares an original map until it is first modified.
+	using CopyOnWriteAccountHistoryMap = CopyOnWriteContainer<AddressAccountHistoryMap>;
+
 	/// High value accounts updater.
 	class HighValueAccountsUpdater {
 	private:
@@ -104,6 +182,12 @@ namespace catapult { namespace cache {
 		/// Detaches the underlying data associated with this updater and converts it to a high value accounts container.
 		HighValueAccounts detachAccounts();
 
+		/// Detaches the underlying data associated with this updater into \a accounts, which must be the container
+		/// used to create this updater.
+		/// \note Address sets and account histories are only replaced when they were modified,
+		///       so unchanged containers are never copied.
+		void detachAccounts(HighValueAccounts& accounts);
+
 	private:
 		void updateHarvestingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
 		void updateVotingAccounts(const deltaset::DeltaElements<MemorySetType>& deltas);
@@ -111,9 +195,9 @@ namespace catapult { namespace cache {
 	private:
 		AccountStateCacheTypes::Options m_options;
 		const model::AddressSet& m_original;
-		model::AddressSet m_current;
-		model::AddressSet m_removed;
-		AddressAccountHistoryMap m_accountHistories;
+		CopyOnWriteAddressSet m_current;
+		CopyOnWriteAddressSet m_removed;
+		CopyOnWriteAccountHistoryMap m_accountHistories;
 		Height m_height;
 	};
 }}
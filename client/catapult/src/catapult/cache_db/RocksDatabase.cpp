@@ -23,10 +23,14 @@
 #include "RocksInclude.h"
 #include "RocksPruningFilter.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/PathUtils.h"
 #include "catapult/utils/StackLogger.h"
 #include "catapult/exceptions.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace catapult { namespace cache {
 
@@ -106,6 +110,98 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region WalSyncer
+
+	// Syncs the write ahead log on a background thread, grouping all sync requests made while a sync is in progress.
+	class RocksDatabase::WalSyncer {
+	public:
+		WalSyncer(rocksdb::DB& db, const std::string& databaseDirectory)
+				: m_db(db)
+				, m_databaseDirectory(databaseDirectory)
+				, m_numRequested(0)
+				, m_numSynced(0)
+				, m_keepRunning(true)
+				, m_thread([this]() { run(); })
+		{}
+
+		~WalSyncer() {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_keepRunning = false;
+			}
+
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+	public:
+		// Requests a sync of all writes completed so far.
+		void request() {
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				checkError();
+				++m_numRequested;
+			}
+
+			m_condition.notify_all();
+		}
+
+		// Waits for all requested syncs to complete.
+		void wait() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_numSynced == m_numRequested || !m_errorMessage.empty(); });
+			checkError();
+		}
+
+	private:
+		void run() {
+			std::unique_lock<std::mutex> lock(m_mutex);
+			while (true) {
+				m_condition.wait(lock, [this]() { return !m_keepRunning || m_numSynced != m_numRequested; });
+
+				// pending requests are always synced before shutdown
+				if (m_numSynced == m_numRequested)
+					return;
+
+				// all requests made up to this point (and while syncing) are satisfied by a single sync
+				auto numRequested = m_numRequested;
+				lock.unlock();
+
+				auto directory = m_databaseDirectory + "/";
+				utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::warning);
+				auto status = m_db.SyncWAL();
+
+				lock.lock();
+				if (!status.ok()) {
+					CATAPULT_LOG(error) << "could not sync write ahead log " << status.ToString();
+					m_errorMessage = status.ToString();
+				}
+
+				m_numSynced = numRequested;
+				m_condition.notify_all();
+			}
+		}
+
+		void checkError() const {
+			if (!m_errorMessage.empty())
+				CATAPULT_THROW_RUNTIME_ERROR_1("could not sync write ahead log", m_errorMessage);
+		}
+
+	private:
+		rocksdb::DB& m_db;
+		std::string m_databaseDirectory;
+		uint64_t m_numRequested;
+		uint64_t m_numSynced;
+		bool m_keepRunning;
+		std::string m_errorMessage;
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::thread m_thread;
+	};
+
+	// endregion
+
 	// region RocksDatabase
 
 	namespace {
@@ -126,23 +222,101 @@ namespace catapult { namespace cache {
 			if (config.EnableStatistics)
 				dbOptions.statistics = rocksdb::CreateDBStatistics();
 
+			// only skip list memtables support concurrent writes
+			for (const auto& pair : config.Columns) {
+				if (config::CacheDatabaseMemtableType::Skip_List != pair.second.MemtableType)
+					dbOptions.allow_concurrent_memtable_write = false;
+			}
+
 			return dbOptions;
 		}
 
+		using ColumnConfiguration = config::NodeConfiguration::CacheDatabaseSubConfiguration::ColumnSubConfiguration;
+
+		rocksdb::CompressionType MapToRocksCompression(config::CacheDatabaseCompression compression) {
+			switch (compression) {
+			case config::CacheDatabaseCompression::None:
+				return rocksdb::kNoCompression;
+
+			case config::CacheDatabaseCompression::Lz4:
+				return rocksdb::kLZ4Compression;
+
+			case config::CacheDatabaseCompression::Zstd:
+				return rocksdb::kZSTD;
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unknown cache database compression", utils::to_underlying_type(compression));
+		}
+
+		std::shared_ptr<rocksdb::MemTableRepFactory> CreateMemtableFactory(config::CacheDatabaseMemtableType memtableType) {
+			switch (memtableType) {
+			case config::CacheDatabaseMemtableType::Skip_List:
+				return std::make_shared<rocksdb::SkipListFactory>();
+
+			case config::CacheDatabaseMemtableType::Hash_Skip_List:
+				return std::shared_ptr<rocksdb::MemTableRepFactory>(rocksdb::NewHashSkipListRepFactory());
+
+			case config::CacheDatabaseMemtableType::Vector:
+				return std::make_shared<rocksdb::VectorRepFactory>();
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unknown cache database memtable type", utils::to_underlying_type(memtableType));
+		}
+
+		void ApplyColumnConfiguration(
+				rocksdb::ColumnFamilyOptions& columnFamilyOptions,
+				const ColumnConfiguration& columnConfig,
+				const std::shared_ptr<rocksdb::Cache>& pSharedBlockCache) {
+			rocksdb::BlockBasedTableOptions tableOptions;
+			tableOptions.block_cache = utils::FileSize() != columnConfig.BlockCacheSize
+					? rocksdb::NewLRUCache(columnConfig.BlockCacheSize.bytes())
+					: pSharedBlockCache;
+
+			if (0 != columnConfig.BloomFilterBitsPerKey)
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(columnConfig.BloomFilterBitsPerKey));
+
+			columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+			if (0 != columnConfig.PrefixLength)
+				columnFamilyOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(columnConfig.PrefixLength));
+
+			// clear per level compression set by OptimizeLevelStyleCompaction so that configured compression is used at all levels
+			columnFamilyOptions.compression = MapToRocksCompression(columnConfig.Compression);
+			columnFamilyOptions.compression_per_level.clear();
+
+			columnFamilyOptions.memtable_factory = CreateMemtableFactory(columnConfig.MemtableType);
+		}
+
 		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
 				const config::NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				const std::string& columnFamilyName,
+				const std::shared_ptr<rocksdb::Cache>& pSharedBlockCache,
 				rocksdb::CompactionFilter* pCompactionFilter) {
 			rocksdb::ColumnFamilyOptions columnFamilyOptions;
 			columnFamilyOptions.compaction_filter = pCompactionFilter;
 
-			if (utils::FileSize() != config.BlockCacheSize)
+			auto columnConfigIter = config.Columns.find(columnFamilyName);
+			auto hasColumnConfig = config.Columns.cend() != columnConfigIter;
+
+			if (!hasColumnConfig && utils::FileSize() != config.BlockCacheSize)
 				columnFamilyOptions.OptimizeForPointLookup(config.BlockCacheSize.megabytes());
 
 			if (utils::FileSize() != config.MemtableMemoryBudget)
 				columnFamilyOptions.OptimizeLevelStyleCompaction(config.MemtableMemoryBudget.bytes());
 
+			if (hasColumnConfig)
+				ApplyColumnConfiguration(columnFamilyOptions, columnConfigIter->second, pSharedBlockCache);
+
 			return columnFamilyOptions;
 		}
+
+		std::shared_ptr<rocksdb::Cache> CreateSharedBlockCache(const config::NodeConfiguration::CacheDatabaseSubConfiguration& config) {
+			// configured columns without dedicated block caches share a single block cache
+			// (when BlockCacheSize is zero, a nullptr is returned so that each column gets a default block cache)
+			return !config.Columns.empty() && utils::FileSize() != config.BlockCacheSize
+					? rocksdb::NewLRUCache(config.BlockCacheSize.bytes())
+					: nullptr;
+		}
 	}
 
 	RocksDatabase::RocksDatabase() = default;
@@ -156,10 +330,16 @@ namespace catapult { namespace cache {
 
 		config::CatapultDirectory(m_settings.DatabaseDirectory).createAll();
 
-		auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
+		auto pSharedBlockCache = CreateSharedBlockCache(m_settings.DatabaseConfig);
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames)
+		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames) {
+			auto columnFamilyOptions = CreateColumnFamilyOptions(
+					m_settings.DatabaseConfig,
+					columnFamilyName,
+					pSharedBlockCache,
+					m_pruningFilter.compactionFilter());
 			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+		}
 
 		rocksdb::DB* pDb;
 		auto dbOptions = CreateDatabaseOptions(m_settings.DatabaseConfig);
@@ -167,9 +347,15 @@ namespace catapult { namespace cache {
 		m_pDb.reset(pDb);
 		if (!status.ok())
 			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", m_settings.DatabaseDirectory, status.ToString());
+
+		if (m_settings.DatabaseConfig.EnableAsyncWrites)
+			m_pWalSyncer = std::make_unique<WalSyncer>(*m_pDb, m_settings.DatabaseDirectory);
 	}
 
 	RocksDatabase::~RocksDatabase() {
+		// sync all pending writes before closing the database
+		m_pWalSyncer.reset();
+
 		for (auto* pHandle : m_handles)
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
@@ -244,8 +430,9 @@ namespace catapult { namespace cache {
 		if (0 == m_pWriteBatch->GetDataSize())
 			return;
 
+		// when async writes are enabled, the batch is written without waiting for the write ahead log to be synced
 		rocksdb::WriteOptions writeOptions;
-		writeOptions.sync = true;
+		writeOptions.sync = !m_pWalSyncer;
 
 		auto directory = m_settings.DatabaseDirectory + "/";
 		utils::SlowOperationLogger logger(utils::ExtractDirectoryName(directory.c_str()).pData, utils::LogLevel::warning);
@@ -254,6 +441,14 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_RUNTIME_ERROR_1("could not store batch in db", status.ToString());
 
 		m_pWriteBatch->Clear();
+
+		if (m_pWalSyncer)
+			m_pWalSyncer->request();
+	}
+
+	void RocksDatabase::sync() {
+		if (m_pWalSyncer)
+			m_pWalSyncer->wait();
 	}
 
 	void RocksDatabase::saveIfBatchFull() {
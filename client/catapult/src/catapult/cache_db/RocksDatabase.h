@@ -163,11 +163,18 @@ namespace catapult { namespace cache {
 		size_t prune(size_t columnId, uint64_t boundary);
 
 		/// Finalize batched operations.
+		/// \note When async writes are enabled, finalized operations are visible immediately but are synced to disk later.
 		void flush();
 
+		/// Waits until all finalized operations have been synced to disk.
+		void sync();
+
 	private:
 		void saveIfBatchFull();
 
+	private:
+		class WalSyncer;
+
 	private:
 		const RocksDatabaseSettings m_settings;
 		RocksPruningFilter m_pruningFilter;
@@ -175,6 +182,7 @@ namespace catapult { namespace cache {
 
 		std::unique_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<WalSyncer> m_pWalSyncer;
 	};
 
 	// endregion
@@ -32,11 +32,13 @@ namespace catapult { namespace cache {
 		explicit TransactionData(size_t id)
 				: model::TransactionInfo()
 				, Id(id)
+				, MaxFeeMultiplier()
 		{}
 
 		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
 				: model::TransactionInfo(transactionInfo.copy())
 				, Id(id)
+				, MaxFeeMultiplier(model::CalculateTransactionMaxFeeMultiplier(*pEntity))
 		{}
 
 	public:
@@ -46,6 +48,16 @@ namespace catapult { namespace cache {
 
 	public:
 		size_t Id;
+		BlockFeeMultiplier MaxFeeMultiplier;
+	};
+
+	struct MaxFeeMultiplierComparer {
+	public:
+		bool operator()(const TransactionData* pLhs, const TransactionData* pRhs) const {
+			return pLhs->MaxFeeMultiplier != pRhs->MaxFeeMultiplier
+					? pLhs->MaxFeeMultiplier < pRhs->MaxFeeMultiplier
+					: pLhs->Id < pRhs->Id;
+		}
 	};
 
 	// region MemoryUtCacheView
@@ -54,11 +66,13 @@ namespace catapult { namespace cache {
 			utils::FileSize maxResponseSize,
 			utils::FileSize cacheSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_cacheSize(cacheSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -82,6 +96,38 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		if (MaxFeeMultiplierOrder::Ascending == order) {
+			for (const auto* pData : m_maxFeeMultiplierIndex) {
+				if (!consumer(*pData))
+					return;
+			}
+
+			return;
+		}
+
+		// index is ordered by ascending multiplier, so iterate groups of equal multipliers in reverse
+		// but iterate within each group in order so that older transactions are still preferred
+		auto groupEndIter = m_maxFeeMultiplierIndex.cend();
+		while (m_maxFeeMultiplierIndex.cbegin() != groupEndIter) {
+			auto groupStartIter = std::prev(groupEndIter);
+			auto maxFeeMultiplier = (*groupStartIter)->MaxFeeMultiplier;
+			while (m_maxFeeMultiplierIndex.cbegin() != groupStartIter) {
+				if (maxFeeMultiplier != (*std::prev(groupStartIter))->MaxFeeMultiplier)
+					break;
+
+				--groupStartIter;
+			}
+
+			for (auto iter = groupStartIter; groupEndIter != iter; ++iter) {
+				if (!consumer(**iter))
+					return;
+			}
+
+			groupEndIter = groupStartIter;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -134,6 +180,7 @@ namespace catapult { namespace cache {
 					utils::FileSize& cacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 					IdLookup& idLookup,
 					AccountWeights& weights,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
@@ -141,6 +188,7 @@ namespace catapult { namespace cache {
 					, m_cacheSize(cacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_maxFeeMultiplierIndex(maxFeeMultiplierIndex)
 					, m_idLookup(idLookup)
 					, m_weights(weights)
 					, m_writeLock(std::move(writeLock))
@@ -164,7 +212,8 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_maxFeeMultiplierIndex.insert(&*dataIter);
 
 				m_weights.increment(transactionInfo.pEntity->SignerPublicKey, transactionSize);
 
@@ -186,6 +235,7 @@ namespace catapult { namespace cache {
 				m_weights.decrement(dataIter->pEntity->SignerPublicKey, transactionSize);
 				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() - transactionSize);
 
+				m_maxFeeMultiplierIndex.erase(&*dataIter);
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -207,6 +257,7 @@ namespace catapult { namespace cache {
 					transactionInfosCopy.emplace_back(data.copy());
 
 				m_cacheSize = utils::FileSize();
+				m_maxFeeMultiplierIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_weights.reset();
@@ -218,6 +269,7 @@ namespace catapult { namespace cache {
 			utils::FileSize& m_cacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 			IdLookup& m_idLookup;
 			AccountWeights& m_weights;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
@@ -230,6 +282,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::MaxFeeMultiplierIndex MaxFeeMultiplierIndex;
 		utils::FileSize CacheSize;
 
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
@@ -250,6 +303,7 @@ namespace catapult { namespace cache {
 				m_options.MaxResponseSize,
 				m_pImpl->CacheSize,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				std::move(readLock));
 	}
@@ -261,6 +315,7 @@ namespace catapult { namespace cache {
 				m_pImpl->CacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->MaxFeeMultiplierIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Weights,
 				std::move(writeLock)));
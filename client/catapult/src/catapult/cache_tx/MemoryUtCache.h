@@ -29,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct MaxFeeMultiplierComparer;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -37,6 +42,18 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Internal index of transaction data ordered by max fee multiplier (and arrival) wrapped by MemoryUtCache.
+	using MaxFeeMultiplierIndex = std::set<const TransactionData*, MaxFeeMultiplierComparer>;
+
+	/// Orders in which transactions can be iterated by max fee multiplier.
+	enum class MaxFeeMultiplierOrder {
+		/// Transactions with smallest max fee multipliers are first.
+		Ascending,
+
+		/// Transactions with largest max fee multipliers are first.
+		Descending
+	};
+
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -46,11 +63,13 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), current cache size (\a cacheSize),
-		/// a transaction data container (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// a transaction data container (\a transactionDataContainer), a max fee multiplier index (\a maxFeeMultiplierIndex)
+		/// and an id lookup (\a idLookup) with lock context \a readLock.
 		MemoryUtCacheView(
 				utils::FileSize maxResponseSize,
 				utils::FileSize cacheSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const MaxFeeMultiplierIndex& maxFeeMultiplierIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -67,6 +86,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by max fee multiplier according to \a order
+		/// until all are consumed or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are always ordered from oldest to newest.
+		void forEach(MaxFeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// \note Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -82,6 +106,7 @@ namespace catapult { namespace cache {
 		utils::FileSize m_maxResponseSize;
 		utils::FileSize m_cacheSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const MaxFeeMultiplierIndex& m_maxFeeMultiplierIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
@@ -23,6 +23,40 @@
 
 namespace catapult { namespace cache {
 
+	namespace {
+		using TransactionInfoConsumer = predicate<const model::TransactionInfo&>;
+
+		template<typename TForEach>
+		std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+				size_t cacheSize,
+				uint32_t transactionLimit,
+				const EmbeddedCountRetriever& countRetriever,
+				const predicate<const model::TransactionInfo&>& filter,
+				TForEach forEach) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			transactionInfoPointers.reserve(std::min<size_t>(cacheSize, transactionLimit));
+
+			if (0 != transactionLimit) {
+				uint32_t totalTransactionsCount = 0;
+				forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
+						const auto& transactionInfo) {
+					auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
+					if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
+						return false;
+
+					if (filter(transactionInfo)) {
+						totalTransactionsCount += currentTransactionsCount;
+						transactionInfoPointers.push_back(&transactionInfo);
+					}
+
+					return true;
+				});
+			}
+
+			return transactionInfoPointers;
+		}
+	}
+
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
 			const MemoryUtCacheView& utCacheView,
 			uint32_t transactionLimit,
@@ -35,27 +69,22 @@ namespace catapult { namespace cache {
 			uint32_t transactionLimit,
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter) {
-		std::vector<const model::TransactionInfo*> transactionInfoPointers;
-		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
-
-		if (0 != transactionLimit) {
-			uint32_t totalTransactionsCount = 0;
-			utCacheView.forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
-					const auto& transactionInfo) {
-				auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
-				if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-					return false;
-
-				if (filter(transactionInfo)) {
-					totalTransactionsCount += currentTransactionsCount;
-					transactionInfoPointers.push_back(&transactionInfo);
-				}
-
-				return true;
-			});
-		}
+		auto forEach = [&utCacheView](const TransactionInfoConsumer& consumer) {
+			utCacheView.forEach(consumer);
+		};
+		return GetFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, forEach);
+	}
 
-		return transactionInfoPointers;
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		auto forEach = [&utCacheView, order](const TransactionInfoConsumer& consumer) {
+			utCacheView.forEach(order, consumer);
+		};
+		return GetFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, forEach);
 	}
 
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
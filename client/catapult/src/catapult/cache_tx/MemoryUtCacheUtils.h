@@ -44,6 +44,17 @@ namespace catapult { namespace cache {
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo&>& filter);
 
+	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter when ordered
+	/// by max fee multiplier according to \a order where \a countRetriever returns the total number of transactions contained
+	/// within a top-level transaction.
+	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			MaxFeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter);
+
 	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter after sorting
 	/// by \a sortComparer where \a countRetriever returns the total number of transactions contained within a top-level transaction.
 	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
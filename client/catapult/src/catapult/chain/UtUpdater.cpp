@@ -29,6 +29,10 @@
 #include "catapult/cache_tx/UtCache.h"
 #include "catapult/model/FeeUtils.h"
 #include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/StackTimer.h"
+#include <algorithm>
+#include <atomic>
+#include <optional>
 
 namespace catapult { namespace chain {
 
@@ -63,6 +67,12 @@ namespace catapult { namespace chain {
 		private:
 			const model::TransactionInfo& m_transactionInfo;
 		};
+
+		size_t CountAdded(const std::vector<UtUpdateResult>& updateResults) {
+			return static_cast<size_t>(std::count_if(updateResults.cbegin(), updateResults.cend(), [](const auto& updateResult) {
+				return UtUpdateResult::UpdateType::New == updateResult.Type;
+			}));
+		}
 	}
 
 	class UtUpdater::Impl final {
@@ -74,7 +84,8 @@ namespace catapult { namespace chain {
 				const ExecutionConfiguration& executionConfig,
 				const TimeSupplier& timeSupplier,
 				const FailedTransactionSink& failedTransactionSink,
-				const Throttle& throttle)
+				const Throttle& throttle,
+				const std::optional<UtUpdaterParallelOptions>& parallelOptions)
 				: m_transactionsCache(transactionsCache)
 				, m_detachedCatapultCache(confirmedCatapultCache)
 				, m_minFeeMultiplier(minFeeMultiplier)
@@ -82,6 +93,11 @@ namespace catapult { namespace chain {
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_parallelOptions(parallelOptions)
+				, m_numRebases(0)
+				, m_numLastRebaseTransactions(0)
+				, m_numLastRebaseAddedTransactions(0)
+				, m_lastRebaseElapsedMillis(0)
 		{}
 
 	public:
@@ -113,6 +129,8 @@ namespace catapult { namespace chain {
 						<< "reverted " << utInfos.size() << " transactions";
 			}
 
+			utils::StackTimer stopwatch;
+
 			// 1. lock and clear the UT cache - UT cache must be locked before catapult cache to prevent race condition whereby
 			//    other update overload applies transactions to rebased cache before UT lock is held
 			auto modifier = m_transactionsCache.modifier();
@@ -121,14 +139,35 @@ namespace catapult { namespace chain {
 			// 2. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
-			// 3. add back reverted txes
+			// 3. check reverted and original txes that have not been confirmed for admission (possibly in parallel)
+			auto acceptAll = [](const auto&) { return true; };
+			auto isUnconfirmed = [&confirmedTransactionHashes](const auto& info) {
+				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
+			};
+			auto revertedAdmissionFlags = checkAdmissions(utInfos, TransactionSource::Reverted, acceptAll);
+			auto originalAdmissionFlags = checkAdmissions(originalTransactionInfos, TransactionSource::Existing, isUnconfirmed);
+
+			// 4. add back reverted txes
 			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
-			apply(applyState, utInfos, TransactionSource::Reverted);
+			auto revertedResults = apply(applyState, utInfos, TransactionSource::Reverted, acceptAll, revertedAdmissionFlags);
+
+			// 5. add back original txes that have not been confirmed
+			auto originalResults = apply(
+					applyState,
+					originalTransactionInfos,
+					TransactionSource::Existing,
+					isUnconfirmed,
+					originalAdmissionFlags);
+
+			// 6. update rebase statistics
+			++m_numRebases;
+			m_numLastRebaseTransactions = utInfos.size() + originalTransactionInfos.size();
+			m_numLastRebaseAddedTransactions = CountAdded(revertedResults) + CountAdded(originalResults);
+			m_lastRebaseElapsedMillis = stopwatch.millis();
+		}
 
-			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
-				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+		UtUpdaterRebaseStatistics rebaseStatistics() const {
+			return { m_numRebases, m_numLastRebaseTransactions, m_numLastRebaseAddedTransactions, m_lastRebaseElapsedMillis };
 		}
 
 	private:
@@ -136,14 +175,15 @@ namespace catapult { namespace chain {
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource) {
-			return apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
+			return apply(applyState, utInfos, transactionSource, [](const auto&) { return true; }, {});
 		}
 
 		std::vector<UtUpdateResult> apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				const std::vector<uint8_t>& admissionFlags) {
 			std::vector<UtUpdateResult> updateResults;
 			updateResults.reserve(utInfos.size());
 
@@ -156,24 +196,13 @@ namespace catapult { namespace chain {
 			auto observerContext = contextBuilder.buildObserverContext();
 
 			size_t numRejectedTransactions = 0;
-			for (const auto& utInfo : utInfos) {
+			for (auto i = 0u; i < utInfos.size(); ++i) {
+				const auto& utInfo = utInfos[i];
 				const auto& entity = *utInfo.pEntity;
 				const auto& entityHash = utInfo.EntityHash;
 
-				if (!filter(utInfo)) {
-					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
-					continue;
-				}
-
-				auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
-				if (entity.MaxFee < minTransactionFee) {
-					// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
-					if (TransactionSource::New == transactionSource) {
-						CATAPULT_LOG(debug)
-								<< "dropping transaction " << TransactionInfoFormatter(utInfo) << " with max fee " << entity.MaxFee
-								<< " because min fee is " << minTransactionFee;
-					}
-
+				auto isAdmitted = admissionFlags.empty() ? isAdmissible(utInfo, transactionSource, filter) : !!admissionFlags[i];
+				if (!isAdmitted) {
 					updateResults.push_back({ UtUpdateResult::UpdateType::Neutral });
 					continue;
 				}
@@ -195,8 +224,7 @@ namespace catapult { namespace chain {
 				const auto& observer = *m_executionConfig.pObserver;
 				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
 				sub.enableUndo();
-				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
+				m_executionConfig.pNotificationPublisher->publish(model::WeakEntityInfo(entity, entityHash), sub);
 				if (!IsValidationResultSuccess(sub.result())) {
 					CATAPULT_LOG(trace) << "dropping transaction " << TransactionInfoFormatter(utInfo) << ": " << sub.result();
 					++numRejectedTransactions;
@@ -220,6 +248,52 @@ namespace catapult { namespace chain {
 			return updateResults;
 		}
 
+		bool isAdmissible(
+				const model::TransactionInfo& utInfo,
+				TransactionSource transactionSource,
+				const predicate<const model::TransactionInfo&>& filter) const {
+			if (!filter(utInfo))
+				return false;
+
+			const auto& entity = *utInfo.pEntity;
+			auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
+			if (entity.MaxFee < minTransactionFee) {
+				// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
+				if (TransactionSource::New == transactionSource) {
+					CATAPULT_LOG(debug)
+							<< "dropping transaction " << TransactionInfoFormatter(utInfo) << " with max fee " << entity.MaxFee
+							<< " because min fee is " << minTransactionFee;
+				}
+
+				return false;
+			}
+
+			return true;
+		}
+
+		std::vector<uint8_t> checkAdmissions(
+				const std::vector<model::TransactionInfo>& utInfos,
+				TransactionSource transactionSource,
+				const predicate<const model::TransactionInfo&>& filter) const {
+			std::vector<uint8_t> admissionFlags;
+			if (!m_parallelOptions || utInfos.size() < m_parallelOptions->MinParallelTransactionsCount)
+				return admissionFlags;
+
+			// admission checks do not depend on the cache state, so they can be run in parallel up front
+			// (notice that publishing stays sequential because notifications can reference storage owned by the publisher)
+			admissionFlags.resize(utInfos.size());
+			auto numPartitions = std::max<size_t>(1, std::min(m_parallelOptions->MaxPartitions, utInfos.size()));
+			auto checkPartition = [this, &utInfos, transactionSource, &filter, &admissionFlags, numPartitions](auto partitionIndex) {
+				auto startIndex = utInfos.size() * partitionIndex / numPartitions;
+				auto endIndex = utInfos.size() * (partitionIndex + 1) / numPartitions;
+				for (auto i = startIndex; i < endIndex; ++i)
+					admissionFlags[i] = isAdmissible(utInfos[i], transactionSource, filter) ? 1 : 0;
+			};
+			m_parallelOptions->ProcessPartitions(numPartitions, checkPartition);
+
+			return admissionFlags;
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
@@ -241,6 +315,12 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		std::optional<UtUpdaterParallelOptions> m_parallelOptions;
+
+		std::atomic<uint64_t> m_numRebases;
+		std::atomic<uint64_t> m_numLastRebaseTransactions;
+		std::atomic<uint64_t> m_numLastRebaseAddedTransactions;
+		std::atomic<uint64_t> m_lastRebaseElapsedMillis;
 	};
 
 	UtUpdater::UtUpdater(
@@ -258,7 +338,28 @@ namespace catapult { namespace chain {
 					executionConfig,
 					timeSupplier,
 					failedTransactionSink,
-					throttle))
+					throttle,
+					std::nullopt))
+	{}
+
+	UtUpdater::UtUpdater(
+			cache::UtCache& transactionsCache,
+			const cache::CatapultCache& confirmedCatapultCache,
+			BlockFeeMultiplier minFeeMultiplier,
+			const ExecutionConfiguration& executionConfig,
+			const TimeSupplier& timeSupplier,
+			const FailedTransactionSink& failedTransactionSink,
+			const Throttle& throttle,
+			const UtUpdaterParallelOptions& parallelOptions)
+			: m_pImpl(std::make_unique<Impl>(
+					transactionsCache,
+					confirmedCatapultCache,
+					minFeeMultiplier,
+					executionConfig,
+					timeSupplier,
+					failedTransactionSink,
+					throttle,
+					parallelOptions))
 	{}
 
 	UtUpdater::~UtUpdater() = default;
@@ -270,4 +371,8 @@ namespace catapult { namespace chain {
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
 		m_pImpl->update(confirmedTransactionHashes, utInfos);
 	}
+
+	UtUpdaterRebaseStatistics UtUpdater::rebaseStatistics() const {
+		return m_pImpl->rebaseStatistics();
+	}
 }}
@@ -58,6 +58,34 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	/// Options for checking transactions for admission in parallel when an unconfirmed transactions cache is rebased.
+	struct UtUpdaterParallelOptions {
+		/// Minimum number of transactions required for transactions to be checked in parallel.
+		size_t MinParallelTransactionsCount;
+
+		/// Maximum number of partitions that are checked in parallel.
+		size_t MaxPartitions;
+
+		/// Calls the supplied function once for each partition index less than the specified number of partitions
+		/// (possibly concurrently) and returns after all partitions have been processed.
+		consumer<size_t, const consumer<size_t>&> ProcessPartitions;
+	};
+
+	/// Statistics about rebases of an unconfirmed transactions cache.
+	struct UtUpdaterRebaseStatistics {
+		/// Total number of rebases.
+		uint64_t NumRebases;
+
+		/// Number of transactions (reverted and original) considered during the most recent rebase.
+		uint64_t NumTransactions;
+
+		/// Number of transactions added back to the cache during the most recent rebase.
+		uint64_t NumAddedTransactions;
+
+		/// Elapsed time (in milliseconds) of the most recent rebase.
+		uint64_t ElapsedMillis;
+	};
+
 	/// Provides batch updating of an unconfirmed transactions cache.
 	class UtUpdater {
 	public:
@@ -106,6 +134,22 @@ namespace catapult { namespace chain {
 				const FailedTransactionSink& failedTransactionSink,
 				const Throttle& throttle);
 
+		/// Creates an updater around \a transactionsCache with execution configuration (\a executionConfig),
+		/// current time supplier (\a timeSupplier) and failed transaction sink (\a failedTransactionSink).
+		/// \a confirmedCatapultCache is the real (confirmed) catapult cache.
+		/// \a throttle allows throttling (rejection) of transactions.
+		/// \a minFeeMultiplier is the minimum fee multiplier of transactions allowed in the cache.
+		/// \a parallelOptions configure the parallel admission checks of transactions that are reapplied after a rebase.
+		UtUpdater(
+				cache::UtCache& transactionsCache,
+				const cache::CatapultCache& confirmedCatapultCache,
+				BlockFeeMultiplier minFeeMultiplier,
+				const ExecutionConfiguration& executionConfig,
+				const TimeSupplier& timeSupplier,
+				const FailedTransactionSink& failedTransactionSink,
+				const Throttle& throttle,
+				const UtUpdaterParallelOptions& parallelOptions);
+
 		/// Destroys the updater.
 		~UtUpdater();
 
@@ -117,6 +161,9 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Gets the statistics about rebases performed by this updater.
+		UtUpdaterRebaseStatistics rebaseStatistics() const;
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
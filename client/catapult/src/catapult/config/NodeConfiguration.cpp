@@ -22,9 +22,68 @@
 #include "NodeConfiguration.h"
 #include "catapult/utils/ConfigurationBag.h"
 #include "catapult/utils/ConfigurationUtils.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
 
 namespace catapult { namespace config {
 
+	// region enum parsers
+
+	namespace {
+		const std::array<std::pair<const char*, CacheDatabaseCompression>, 3> String_To_Cache_Database_Compression_Pairs{{
+			{ "none", CacheDatabaseCompression::None },
+			{ "lz4", CacheDatabaseCompression::Lz4 },
+			{ "zstd", CacheDatabaseCompression::Zstd }
+		}};
+
+		const std::array<std::pair<const char*, CacheDatabaseMemtableType>, 3> String_To_Cache_Database_Memtable_Type_Pairs{{
+			{ "skip-list", CacheDatabaseMemtableType::Skip_List },
+			{ "hash-skip-list", CacheDatabaseMemtableType::Hash_Skip_List },
+			{ "vector", CacheDatabaseMemtableType::Vector }
+		}};
+	}
+
+	bool TryParseValue(const std::string& str, CacheDatabaseCompression& compression) {
+		return utils::TryParseEnumValue(String_To_Cache_Database_Compression_Pairs, str, compression);
+	}
+
+	bool TryParseValue(const std::string& str, CacheDatabaseMemtableType& memtableType) {
+		return utils::TryParseEnumValue(String_To_Cache_Database_Memtable_Type_Pairs, str, memtableType);
+	}
+
+	// endregion
+
+	namespace {
+		constexpr auto Cache_Database_Column_Section_Prefix = "cache_database:";
+
+		size_t LoadCacheDatabaseColumns(
+				const utils::ConfigurationBag& bag,
+				std::unordered_map<std::string, NodeConfiguration::CacheDatabaseSubConfiguration::ColumnSubConfiguration>& columns) {
+			std::string prefix(Cache_Database_Column_Section_Prefix);
+
+			size_t numColumnProperties = 0;
+			for (const auto& section : bag.sections()) {
+				if (section.size() <= prefix.size() || 0 != section.find(prefix))
+					continue;
+
+				auto& columnConfig = columns[section.substr(prefix.size())];
+
+#define LOAD_CACHE_DATABASE_COLUMN_PROPERTY(NAME) utils::LoadIniProperty(bag, section.c_str(), #NAME, columnConfig.NAME)
+
+				LOAD_CACHE_DATABASE_COLUMN_PROPERTY(BlockCacheSize);
+				LOAD_CACHE_DATABASE_COLUMN_PROPERTY(BloomFilterBitsPerKey);
+				LOAD_CACHE_DATABASE_COLUMN_PROPERTY(PrefixLength);
+				LOAD_CACHE_DATABASE_COLUMN_PROPERTY(Compression);
+				LOAD_CACHE_DATABASE_COLUMN_PROPERTY(MemtableType);
+
+#undef LOAD_CACHE_DATABASE_COLUMN_PROPERTY
+
+				numColumnProperties += 5;
+			}
+
+			return numColumnProperties;
+		}
+	}
+
 #define LOAD_PROPERTY(SECTION, NAME) utils::LoadIniProperty(bag, SECTION, #NAME, config.NAME)
 
 	NodeConfiguration NodeConfiguration::Uninitialized() {
@@ -45,6 +104,9 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(BlockStorageCacheSize);
+		LOAD_NODE_PROPERTY(EnableMemoryMappedBlockStorage);
+		LOAD_NODE_PROPERTY(FileSpoolingMaxSegmentSize);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -69,18 +131,25 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
+		LOAD_NODE_PROPERTY(SocketWorkingBufferPoolSize);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(BlockDisruptorMaxMemorySize);
 		LOAD_NODE_PROPERTY(BlockElementTraceInterval);
+		LOAD_NODE_PROPERTY(BlockMinParallelTransactionsHashCount);
 
 		LOAD_NODE_PROPERTY(TransactionDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(TransactionDisruptorMaxMemorySize);
+		LOAD_NODE_PROPERTY(TransactionDisruptorMaxBatchSize);
+		LOAD_NODE_PROPERTY(TransactionDisruptorMaxCoalescingDelay);
 		LOAD_NODE_PROPERTY(TransactionElementTraceInterval);
+		LOAD_NODE_PROPERTY(TransactionMinParallelRebaseCount);
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
+		LOAD_NODE_PROPERTY(EnableNotificationProfiling);
+		LOAD_NODE_PROPERTY(DispatcherWaitStrategy);
 
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
@@ -103,6 +172,7 @@ namespace catapult { namespace config {
 		LOAD_CACHE_DATABASE_PROPERTY(MemtableMemoryBudget);
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
+		LOAD_CACHE_DATABASE_PROPERTY(EnableAsyncWrites);
 
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
@@ -150,7 +220,9 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 7 + 4 + 4 + 5 + 9);
+		auto numColumnProperties = LoadCacheDatabaseColumns(bag, config.CacheDatabase.Columns);
+
+		utils::VerifyBagSizeExact(bag, 50 + 8 + 4 + 4 + 5 + 9 + numColumnProperties);
 		return config;
 	}
 
@@ -20,17 +20,50 @@
 **/
 
 #pragma once
+#include "catapult/disruptor/DisruptorWaitStrategy.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/ionet/NodeVersion.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
 #include "catapult/utils/FileSize.h"
 #include "catapult/utils/TimeSpan.h"
+#include <unordered_map>
 #include <unordered_set>
 
 namespace catapult { namespace utils { class ConfigurationBag; } }
 
 namespace catapult { namespace config {
 
+	/// Compression used by a cache database column.
+	enum class CacheDatabaseCompression {
+		/// No compression.
+		None,
+
+		/// LZ4 compression.
+		Lz4,
+
+		/// ZSTD compression.
+		Zstd
+	};
+
+	/// Tries to parse \a str into a cache database column \a compression.
+	bool TryParseValue(const std::string& str, CacheDatabaseCompression& compression);
+
+	/// Memtable type used by a cache database column.
+	enum class CacheDatabaseMemtableType {
+		/// Skip list.
+		Skip_List,
+
+		/// Hash skip list.
+		/// \note This requires a nonzero prefix length.
+		Hash_Skip_List,
+
+		/// Vector, which is fast for bulk loading but slow for lookups.
+		Vector
+	};
+
+	/// Tries to parse \a str into a cache database column \a memtableType.
+	bool TryParseValue(const std::string& str, CacheDatabaseMemtableType& memtableType);
+
 	/// Node configuration settings.
 	struct NodeConfiguration {
 	public:
@@ -57,6 +90,16 @@ namespace catapult { namespace config {
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// Maximum size of recently loaded blocks and block statements cached by the block storage cache.
+		utils::FileSize BlockStorageCacheSize;
+
+		/// \c true if blocks should be read from memory mapped block storage files.
+		bool EnableMemoryMappedBlockStorage;
+
+		/// Maximum size of a segment file used by file spooling queues.
+		/// \note \c 0 will store each spooled message in a separate file.
+		utils::FileSize FileSpoolingMaxSegmentSize;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -113,6 +156,10 @@ namespace catapult { namespace config {
 		/// \note \c 0 will disable memory reclamation.
 		uint32_t SocketWorkingBufferSensitivity;
 
+		/// Maximum size of released socket working buffers retained for reuse by other sockets.
+		/// \note \c 0 will disable socket working buffer pooling.
+		utils::FileSize SocketWorkingBufferPoolSize;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -125,21 +172,39 @@ namespace catapult { namespace config {
 		/// Multiple of elements at which a block element should be traced through queue and completion.
 		uint32_t BlockElementTraceInterval;
 
+		/// Minimum number of transactions in a block for its transactions hash to be calculated in parallel.
+		uint32_t BlockMinParallelTransactionsHashCount;
+
 		/// Number of slots in the transaction disruptor circular buffer.
 		uint32_t TransactionDisruptorSlotCount;
 
 		/// Maximum memory of all elements in the transaction disruptor circular buffer.
 		utils::FileSize TransactionDisruptorMaxMemorySize;
 
+		/// Maximum number of transaction elements a consumer can claim and process at once.
+		uint32_t TransactionDisruptorMaxBatchSize;
+
+		/// Maximum amount of time the transaction signature consumer waits for a full batch of elements.
+		utils::TimeSpan TransactionDisruptorMaxCoalescingDelay;
+
 		/// Multiple of elements at which a transaction element should be traced through queue and completion.
 		uint32_t TransactionElementTraceInterval;
 
+		/// Minimum number of transactions for unconfirmed transactions to be checked for admission in parallel when they are rebased.
+		uint32_t TransactionMinParallelRebaseCount;
+
 		/// \c true if the process should terminate when any dispatcher is full.
 		bool EnableDispatcherAbortWhenFull;
 
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// \c true if execution statistics should be collected for all validators and observers.
+		bool EnableNotificationProfiling;
+
+		/// Strategy used by idle dispatcher consumers to wait for new elements.
+		disruptor::DisruptorWaitStrategy DispatcherWaitStrategy;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -183,6 +248,36 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// \c true if batched writes should not wait for the write ahead log to be synced.
+			/// \note When enabled, syncs are group committed by a background thread, so the most recent writes can be lost
+			///       on power failure (but not on process failure).
+			bool EnableAsyncWrites;
+
+			/// Cache database column configuration.
+			struct ColumnSubConfiguration {
+				/// Size of the block cache dedicated to the column.
+				/// \note When zero, the column shares a block cache (sized by BlockCacheSize) with other configured columns.
+				utils::FileSize BlockCacheSize;
+
+				/// Number of bloom filter bits per key (zero disables bloom filters).
+				uint32_t BloomFilterBitsPerKey;
+
+				/// Length of the fixed key prefix used by prefix bloom filters and hash memtables (zero disables prefixes).
+				uint32_t PrefixLength;
+
+				/// Compression type.
+				CacheDatabaseCompression Compression;
+
+				/// Memtable type.
+				CacheDatabaseMemtableType MemtableType;
+			};
+
+			/// Column configurations keyed by column identifier.
+			/// \note In node configuration, identifiers are composed of the cache and column names separated by a period
+			///       (e.g. AccountStateCache.default). In cache configuration, identifiers are column names.
+			///       Columns without configurations use default options.
+			std::unordered_map<std::string, ColumnSubConfiguration> Columns;
 		};
 
 	public:
@@ -89,6 +89,15 @@ namespace catapult { namespace config {
 				out << "MaxWriteBatchSize (" << maxWriteBatchSize << ") must be unset or at least 100KB";
 				CATAPULT_THROW_VALIDATION_ERROR(out.str().c_str());
 			}
+
+			for (const auto& pair : config.CacheDatabase.Columns) {
+				const auto& columnConfig = pair.second;
+				if (CacheDatabaseMemtableType::Hash_Skip_List == columnConfig.MemtableType && 0 == columnConfig.PrefixLength) {
+					std::ostringstream out;
+					out << "cache database column (" << pair.first << ") with hash-skip-list memtable must have nonzero PrefixLength";
+					CATAPULT_THROW_VALIDATION_ERROR(out.str().c_str());
+				}
+			}
 		}
 	}
 
@@ -79,19 +79,64 @@ namespace catapult { namespace consumers {
 			std::vector<crypto::SignatureInput> m_inputs;
 		};
 
+		void ExtractAllSignatureNotifications(
+				const model::NotificationPublisher& publisher,
+				const model::WeakEntityInfos& entityInfos,
+				SignatureCapturingNotificationSubscriber& sub) {
+			for (const auto& entityInfo : entityInfos) {
+				publisher.publish(entityInfo, sub);
+				sub.next();
+			}
+		}
+
 		std::unique_ptr<SignatureCapturingNotificationSubscriber> ExtractAllSignatureNotifications(
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
 				const model::WeakEntityInfos& entityInfos) {
 			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
-			for (const auto& entityInfo : entityInfos) {
-				publisher.publish(entityInfo, *pSub);
-				pSub->next();
-			}
+			ExtractAllSignatureNotifications(publisher, entityInfos, *pSub);
+			return pSub;
+		}
+
+		std::unique_ptr<SignatureCapturingNotificationSubscriber> ExtractAllSignatureNotifications(
+				const GenerationHashSeed& generationHashSeed,
+				const model::NotificationPublisher& publisher,
+				const std::vector<model::WeakEntityInfos>& entityInfosGroups) {
+			// entity indexes are assigned across all groups because a single subscriber is shared by all of them
+			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
+			for (const auto& entityInfos : entityInfosGroups)
+				ExtractAllSignatureNotifications(publisher, entityInfos, *pSub);
 
 			return pSub;
 		}
 
+		std::vector<validators::ValidationResult> VerifyAllSignatures(
+				const crypto::RandomFiller& randomFiller,
+				thread::IoThreadPool& pool,
+				const std::vector<crypto::SignatureInput>& inputs) {
+			// process signatures in batches
+			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
+			//       which would lead to a write data race (of same data) from multiple threads
+			std::vector<validators::ValidationResult> notificationResults(inputs.size(), validators::ValidationResult::Success);
+			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				auto partitionResultsPair = VerifyMulti(randomFiller, &*itBegin, count);
+				if (partitionResultsPair.second)
+					return;
+
+				auto index = startIndex;
+				for (auto result : partitionResultsPair.first) {
+					if (!result)
+						notificationResults[index] = Failure_Consumer_Batch_Signature_Not_Verifiable;
+
+					++index;
+				}
+			};
+
+			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			return notificationResults;
+		}
+
 		std::vector<validators::ValidationResult> MapNotificationResultsToEntityResults(
 				size_t numEntities,
 				const std::vector<size_t>& notificationToEntityIndexMap,
@@ -141,28 +186,42 @@ namespace catapult { namespace consumers {
 			// find all signature notifications
 			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
 
-			// process signatures in batches
-			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
-			//       which would lead to a write data race (of same data) from multiple threads
-			std::vector<validators::ValidationResult> notificationResults(pSub->inputs().size(), validators::ValidationResult::Success);
-			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
-				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
-				auto partitionResultsPair = VerifyMulti(randomFiller, &*itBegin, count);
-				if (partitionResultsPair.second)
-					return;
-
-				auto index = startIndex;
-				for (auto result : partitionResultsPair.first) {
-					if (!result)
-						notificationResults[index] = Failure_Consumer_Batch_Signature_Not_Verifiable;
+			auto notificationResults = VerifyAllSignatures(randomFiller, pool, pSub->inputs());
+			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
+		});
+	}
 
-					++index;
-				}
-			};
+	disruptor::DisruptorBatchConsumer CreateCoalescingTransactionBatchSignatureConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const crypto::RandomFiller& randomFiller,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool,
+			const utils::TimeSpan& maxCoalescingDelay,
+			const chain::FailedTransactionSink& failedTransactionSink) {
+		auto process = [&pool, generationHashSeed, randomFiller, pPublisher](const auto& entityInfosGroups) {
+			// find all signature notifications across all inputs and verify them together
+			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfosGroups);
+			auto notificationResults = VerifyAllSignatures(randomFiller, pool, pSub->inputs());
+
+			// failures are reported per signature, so map them back to the entities (and inputs) that contain them
+			size_t numEntities = 0;
+			for (const auto& entityInfos : entityInfosGroups)
+				numEntities += entityInfos.size();
+
+			const auto& notificationToEntityIndexMap = pSub->notificationToEntityIndexMap();
+			auto entityResults = MapNotificationResultsToEntityResults(numEntities, notificationToEntityIndexMap, notificationResults);
+
+			std::vector<std::vector<validators::ValidationResult>> resultsGroups;
+			auto entityResultsIter = entityResults.cbegin();
+			for (const auto& entityInfos : entityInfosGroups) {
+				auto entityResultsEndIter = entityResultsIter + static_cast<ptrdiff_t>(entityInfos.size());
+				resultsGroups.emplace_back(entityResultsIter, entityResultsEndIter);
+				entityResultsIter = entityResultsEndIter;
+			}
 
-			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
+			return resultsGroups;
+		};
 
-			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
-		});
+		return MakeTransactionValidationBatchConsumer(failedTransactionSink, maxCoalescingDelay, process);
 	}
 }}
@@ -323,6 +323,10 @@ namespace catapult { namespace consumers {
 
 				logger.addSubOperation("commit changes to the primary blockchain storage");
 				storageModifier.commit();
+
+				// wait for cache database changes to be durable before allowing the committed state to replace the previous state
+				logger.addSubOperation("sync changes to the cache database");
+				m_cache.sync();
 				m_handlers.CommitStep(CommitOperationStep::All_Updated);
 
 				// 5. update the unconfirmed transactions
@@ -25,17 +25,32 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <optional>
 
 namespace catapult { namespace consumers {
 
 	namespace {
+		crypto::MerkleHashParallelOptions CreateMerkleHashParallelOptions(thread::IoThreadPool& pool, uint32_t minParallelLeafCount) {
+			crypto::MerkleHashParallelOptions options;
+			options.MinParallelLeafCount = minParallelLeafCount;
+			options.MaxPartitions = pool.numWorkerThreads();
+			options.ProcessPartitions = [&pool](auto numPartitions, const auto& processPartition) {
+				thread::ParallelForPartitionIndexes(pool.ioContext(), numPartitions, processPartition).get();
+			};
+			return options;
+		}
+
 		class BlockHashCalculatorConsumer {
 		public:
 			BlockHashCalculatorConsumer(
 					const GenerationHashSeed& generationHashSeed,
-					const model::TransactionRegistry& transactionRegistry)
+					const model::TransactionRegistry& transactionRegistry,
+					const std::optional<crypto::MerkleHashParallelOptions>& merkleHashParallelOptions)
 					: m_generationHashSeed(generationHashSeed)
 					, m_transactionRegistry(transactionRegistry)
+					, m_merkleHashParallelOptions(merkleHashParallelOptions)
 			{}
 
 		public:
@@ -43,20 +58,25 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// reuse a single hash builder for all transactions in all blocks
+				crypto::Sha3_256_Builder hashBuilder;
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
 					crypto::MerkleHashBuilder transactionsHashBuilder;
 					for (const auto& transaction : element.Block.Transactions()) {
 						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
+						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement, hashBuilder);
 						element.Transactions.push_back(transactionElement);
 
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
 					}
 
 					Hash256 transactionsHash;
-					transactionsHashBuilder.final(transactionsHash);
+					if (m_merkleHashParallelOptions)
+						transactionsHashBuilder.final(transactionsHash, *m_merkleHashParallelOptions);
+					else
+						transactionsHashBuilder.final(transactionsHash);
 					if (element.Block.TransactionsHash != transactionsHash)
 						return Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch);
 
@@ -69,13 +89,23 @@ namespace catapult { namespace consumers {
 		private:
 			GenerationHashSeed m_generationHashSeed;
 			const model::TransactionRegistry& m_transactionRegistry;
+			std::optional<crypto::MerkleHashParallelOptions> m_merkleHashParallelOptions;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, std::nullopt);
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			uint32_t minParallelTransactionsHashCount) {
+		auto merkleHashParallelOptions = CreateMerkleHashParallelOptions(pool, minParallelTransactionsHashCount);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, merkleHashParallelOptions);
 	}
 
 	namespace {
@@ -93,8 +123,10 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// reuse a single hash builder for all transactions
+				crypto::Sha3_256_Builder hashBuilder;
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element);
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element, hashBuilder);
 
 				return Continue();
 			}
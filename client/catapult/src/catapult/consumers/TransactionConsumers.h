@@ -62,6 +62,18 @@ namespace catapult { namespace consumers {
 			thread::IoThreadPool& pool,
 			const chain::FailedTransactionSink& failedTransactionSink);
 
+	/// Creates a batch consumer that runs batch signature validation using \a pPublisher and \a pool for the network with the
+	/// specified generation hash seed (\a generationHashSeed) and calls \a failedTransactionSink for each failure.
+	/// Signatures from all inputs in a batch are verified together; the batch consumer waits at most \a maxCoalescingDelay
+	/// for a full batch. \a randomFiller is used to generate random bytes.
+	disruptor::DisruptorBatchConsumer CreateCoalescingTransactionBatchSignatureConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const crypto::RandomFiller& randomFiller,
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool,
+			const utils::TimeSpan& maxCoalescingDelay,
+			const chain::FailedTransactionSink& failedTransactionSink);
+
 	/// Prototype for a function that is called with new transactions.
 	using NewTransactionsProcessor = std::function<chain::BatchUpdateResult (TransactionInfos&&)>;
 
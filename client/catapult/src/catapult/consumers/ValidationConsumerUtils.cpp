@@ -26,19 +26,56 @@
 namespace catapult { namespace consumers {
 
 	namespace {
+		ConsumerResult ToConsumerResult(validators::ValidationResult result) {
+			if (IsValidationResultSuccess(result))
+				return Continue();
+
+			CATAPULT_LOG_LEVEL(validators::MapToLogLevel(result)) << "validation consumer failed: " << result;
+			return Abort(result, disruptor::ConsumerResultSeverity::Fatal);
+		}
+
 		template<typename TExtractAndProcess>
 		auto MakeValidationConsumer(TExtractAndProcess extractAndProcess) {
 			return [extractAndProcess](auto& elements) {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				auto result = extractAndProcess(elements);
+				return ToConsumerResult(extractAndProcess(elements));
+			};
+		}
+
+		validators::ValidationResult ProcessTransactionValidationResults(
+				TransactionElements& elements,
+				const std::vector<size_t>& entityInfoElementIndexes,
+				const std::vector<validators::ValidationResult>& results,
+				const chain::FailedTransactionSink& failedTransactionSink) {
+			auto numSkippedElements = 0u;
+			auto aggregateResult = validators::ValidationResult::Success;
+			for (auto i = 0u; i < results.size(); ++i) {
+				auto result = results[i];
+				validators::AggregateValidationResult(aggregateResult, result);
 				if (IsValidationResultSuccess(result))
-					return Continue();
+					continue;
 
-				CATAPULT_LOG_LEVEL(validators::MapToLogLevel(result)) << "validation consumer failed: " << result;
-				return Abort(result, disruptor::ConsumerResultSeverity::Fatal);
-			};
+				// notice that ExtractEntityInfos ignores skipped elements, so finding the index in elements for a
+				// corresponding entityInfo requires an additional hop through entityInfoElementIndexes
+				auto& element = elements[entityInfoElementIndexes[i]];
+				element.ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+				++numSkippedElements;
+
+				// only forward failure (not neutral) results
+				if (IsValidationResultFailure(result)) {
+					element.ResultSeverity = disruptor::ConsumerResultSeverity::Failure;
+					failedTransactionSink(element.Transaction, element.EntityHash, result);
+				}
+			}
+
+			// abort if an element failed
+			if (0 == numSkippedElements)
+				return validators::ValidationResult::Success;
+
+			CATAPULT_LOG(trace) << "all " << numSkippedElements << " transaction(s) skipped in Transaction validation consumer";
+			return aggregateResult;
 		}
 	}
 
@@ -62,34 +99,42 @@ namespace catapult { namespace consumers {
 			ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes);
 
 			auto results = process(entityInfos);
+			return ProcessTransactionValidationResults(elements, entityInfoElementIndexes, results, failedTransactionSink);
+		});
+	}
 
-			auto numSkippedElements = 0u;
-			auto aggregateResult = validators::ValidationResult::Success;
-			for (auto i = 0u; i < results.size(); ++i) {
-				auto result = results[i];
-				validators::AggregateValidationResult(aggregateResult, result);
-				if (IsValidationResultSuccess(result))
-					continue;
+	disruptor::DisruptorBatchConsumer MakeTransactionValidationBatchConsumer(
+			const chain::FailedTransactionSink& failedTransactionSink,
+			const utils::TimeSpan& maxCoalescingDelay,
+			const std::function<std::vector<std::vector<validators::ValidationResult>> (std::vector<model::WeakEntityInfos>&)>& process) {
+		auto batchConsumer = [failedTransactionSink, process](const auto& inputs) {
+			std::vector<model::WeakEntityInfos> entityInfosGroups(inputs.size());
+			std::vector<std::vector<size_t>> entityInfoElementIndexesGroups(inputs.size());
+			for (auto i = 0u; i < inputs.size(); ++i)
+				ExtractEntityInfos(inputs[i]->transactions(), entityInfosGroups[i], entityInfoElementIndexesGroups[i]);
 
-				// notice that ExtractEntityInfos ignores skipped elements, so finding the index in elements for a
-				// corresponding entityInfo requires an additional hop through entityInfoElementIndexes
-				auto& element = elements[entityInfoElementIndexes[i]];
-				element.ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
-				++numSkippedElements;
+			auto resultsGroups = process(entityInfosGroups);
 
-				// only forward failure (not neutral) results
-				if (IsValidationResultFailure(result)) {
-					element.ResultSeverity = disruptor::ConsumerResultSeverity::Failure;
-					failedTransactionSink(element.Transaction, element.EntityHash, result);
+			std::vector<ConsumerResult> consumerResults;
+			consumerResults.reserve(inputs.size());
+			for (auto i = 0u; i < inputs.size(); ++i) {
+				auto& elements = inputs[i]->transactions();
+				if (elements.empty()) {
+					consumerResults.push_back(Abort(Failure_Consumer_Empty_Input));
+					continue;
 				}
+
+				auto result = ProcessTransactionValidationResults(
+						elements,
+						entityInfoElementIndexesGroups[i],
+						resultsGroups[i],
+						failedTransactionSink);
+				consumerResults.push_back(ToConsumerResult(result));
 			}
 
-			// abort if an element failed
-			if (0 == numSkippedElements)
-				return validators::ValidationResult::Success;
+			return consumerResults;
+		};
 
-			CATAPULT_LOG(trace) << "all " << numSkippedElements << " transaction(s) skipped in Transaction validation consumer";
-			return aggregateResult;
-		});
+		return disruptor::DisruptorBatchConsumer(batchConsumer, maxCoalescingDelay);
 	}
 }}
@@ -39,4 +39,13 @@ namespace catapult { namespace consumers {
 	disruptor::TransactionConsumer MakeTransactionValidationConsumer(
 			const chain::FailedTransactionSink& failedTransactionSink,
 			const std::function<std::vector<validators::ValidationResult> (model::WeakEntityInfos&)>& process);
+
+	/// Makes a transaction validation batch consumer that forwards entity infos of all inputs in a batch to \a process
+	/// for validation in a single call. Each input's results are attributed to that input's elements.
+	/// Each failure is forwarded to \a failedTransactionSink.
+	/// Consumer will wait at most \a maxCoalescingDelay for a full batch of inputs.
+	disruptor::DisruptorBatchConsumer MakeTransactionValidationBatchConsumer(
+			const chain::FailedTransactionSink& failedTransactionSink,
+			const utils::TimeSpan& maxCoalescingDelay,
+			const std::function<std::vector<std::vector<validators::ValidationResult>> (std::vector<model::WeakEntityInfos>&)>& process);
 }}
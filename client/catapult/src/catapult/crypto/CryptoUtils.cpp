@@ -208,6 +208,7 @@ namespace catapult { namespace crypto {
 			};
 
 			// scalar multiplication
+			// (doubling does not use the extended t coordinate, so it is only calculated when the next operation is an addition)
 			ge25519_p1p1 R;
 			ge25519 G;
 			SetZero(H);
@@ -215,14 +216,17 @@ namespace catapult { namespace crypto {
 				if (0 != q[i]) {
 					auto signbit = static_cast<uint8_t>((q[i] & 0xFF) >> 7);
 					ge25519_pnielsadd_p1p1(&R, &H, &precomputedTable[abs(q[i]) - 1], signbit);
-					ge25519_p1p1_to_full(&H, &R);
+					ge25519_p1p1_to_partial(&H, &R);
 				}
 
 				if (0 != i) {
-					ge25519_double(&G, &H);
-					ge25519_double(&H, &G);
-					ge25519_double(&G, &H);
-					ge25519_double(&H, &G);
+					ge25519_double_partial(&G, &H);
+					ge25519_double_partial(&H, &G);
+					ge25519_double_partial(&G, &H);
+					if (0 != q[i - 1])
+						ge25519_double(&H, &G);
+					else
+						ge25519_double_partial(&H, &G);
 				}
 			}
 		}
@@ -42,14 +42,19 @@ namespace catapult { namespace crypto {
 
 	namespace {
 		template<typename THash>
-		void HashSingleBuffer(const EVP_MD* pMessageDigest, const RawBuffer& dataBuffer, THash& hash) {
+		void HashBuffer(OpensslDigestContext& context, const EVP_MD* pMessageDigest, const RawBuffer& dataBuffer, THash& hash) {
 			auto outputSize = static_cast<unsigned int>(hash.size());
 
-			OpensslDigestContext context;
 			context.dispatch(EVP_DigestInit_ex, pMessageDigest, nullptr);
 			context.dispatch(EVP_DigestUpdate, dataBuffer.pData, dataBuffer.Size);
 			context.dispatch(EVP_DigestFinal_ex, hash.data(), &outputSize);
 		}
+
+		template<typename THash>
+		void HashSingleBuffer(const EVP_MD* pMessageDigest, const RawBuffer& dataBuffer, THash& hash) {
+			OpensslDigestContext context;
+			HashBuffer(context, pMessageDigest, dataBuffer, hash);
+		}
 	}
 
 	void Ripemd160(const RawBuffer& dataBuffer, Hash160& hash) {
@@ -80,6 +85,14 @@ namespace catapult { namespace crypto {
 		HashSingleBuffer(EVP_sha3_256(), dataBuffer, hash);
 	}
 
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes) {
+		// reinitializing a context with the same digest reuses its digest state instead of reallocating it
+		OpensslDigestContext context;
+		const auto* pMessageDigest = EVP_sha3_256();
+		for (auto i = 0u; i < count; ++i)
+			HashBuffer(context, pMessageDigest, pDataBuffers[i], pHashes[i]);
+	}
+
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output) {
 		unsigned int outputSize = 0;
 		HMAC(EVP_sha256(), key.pData, static_cast<int>(key.Size), input.pData, input.Size, output.data(), &outputSize);
@@ -142,6 +155,11 @@ namespace catapult { namespace crypto {
 		m_context.dispatch(EVP_DigestFinal_ex, output.data(), &outputSize);
 	}
 
+	template<typename TModeTag, typename THashTag>
+	void HashBuilderT<TModeTag, THashTag>::reset() {
+		m_context.dispatch(EVP_DigestInit_ex, GetMessageDigest(TModeTag(), THashTag()), nullptr);
+	}
+
 	template class HashBuilderT<Sha2ModeTag, Hash512_tag>;
 	template class HashBuilderT<Sha3ModeTag, Hash256_tag>;
 	template class HashBuilderT<Sha3ModeTag, GenerationHash_tag>;
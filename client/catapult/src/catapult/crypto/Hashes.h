@@ -45,6 +45,10 @@ namespace catapult { namespace crypto {
 	/// Calculates the 256-bit SHA3 hash of \a dataBuffer into \a hash.
 	void Sha3_256(const RawBuffer& dataBuffer, Hash256& hash);
 
+	/// Calculates the 256-bit SHA3 hashes of \a count independent data buffers (\a pDataBuffers) into \a pHashes.
+	/// \note Buffers are hashed in order, so a hash can overwrite the memory of any buffer that has already been hashed.
+	void Sha3_256Multi(const RawBuffer* pDataBuffers, size_t count, Hash256* pHashes);
+
 	/// Calculates the sha256 HMAC of \a input with \a key, producing \a output.
 	void Hmac_Sha256(const RawBuffer& key, const RawBuffer& input, Hash256& output);
 
@@ -84,6 +88,10 @@ namespace catapult { namespace crypto {
 		/// Finalize hash calculation. Returns result in \a output.
 		void final(OutputType& output);
 
+		/// Resets the builder so that it can be reused to calculate a new hash.
+		/// \note This is cheaper than creating a new builder because the digest state is not reallocated.
+		void reset();
+
 	private:
 		OpensslDigestContext m_context;
 	};
@@ -22,10 +22,45 @@
 #include "MerkleHashBuilder.h"
 #include "Hashes.h"
 #include "catapult/functions.h"
+#include <algorithm>
 
 namespace catapult { namespace crypto {
 
 	namespace {
+		// hashes a single tree level (\a pHashes) in place and returns the number of hashes in the next level
+		size_t HashLevel(
+				Hash256* pHashes,
+				size_t numHashes,
+				std::vector<RawBuffer>& pairBuffers,
+				const consumer<const Hash256*, size_t>& hashConsumer) {
+			// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
+			// pushed into the vector because nodes with same depth should be consecutive entries in the vector
+			if (1 == numHashes % 2)
+				hashConsumer(&pHashes[numHashes - 1], 1);
+
+			// hash all complete pairs at once; each parent hash only overwrites hashes that have already been consumed
+			auto numPairs = numHashes / 2;
+			pairBuffers.clear();
+			for (auto i = 0u; i < numPairs; ++i)
+				pairBuffers.push_back({ pHashes[2 * i].data(), 2 * Hash256::Size });
+
+			Sha3_256Multi(pairBuffers.data(), numPairs, pHashes);
+			hashConsumer(pHashes, numPairs);
+
+			if (1 == numHashes % 2) {
+				// if there is an odd number of hashes, duplicate the last one
+				const auto& lastHash = pHashes[numHashes - 1];
+				Sha3_256_Builder builder;
+				builder.update(lastHash);
+				builder.update(lastHash);
+				builder.final(pHashes[numPairs]);
+				hashConsumer(&pHashes[numPairs], 1);
+				++numPairs;
+			}
+
+			return numPairs;
+		}
+
 		Hash256 Final(std::vector<Hash256>& hashes, const consumer<const Hash256*, size_t>& hashConsumer) {
 			if (hashes.empty()) {
 				Hash256 hash{};
@@ -36,34 +71,23 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
-			while (numRemainingHashes > 1) {
-				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
-				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
-				if (1 == numRemainingHashes % 2)
-					hashConsumer(&hashes[numRemainingHashes - 1], 1);
-
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
-
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
-				}
-
-				numRemainingHashes /= 2;
-			}
+
+			std::vector<RawBuffer> pairBuffers;
+			pairBuffers.reserve(numRemainingHashes / 2);
+			while (numRemainingHashes > 1)
+				numRemainingHashes = HashLevel(hashes.data(), numRemainingHashes, pairBuffers, hashConsumer);
 
 			return hashes[0];
 		}
+
+		size_t CalculateSubtreeHeight(size_t numLeaves, size_t maxPartitions) {
+			// find the smallest subtree height that splits the leaves into at most maxPartitions subtrees
+			size_t height = 0;
+			while ((numLeaves + (static_cast<size_t>(1) << height) - 1) >> height > maxPartitions)
+				++height;
+
+			return height;
+		}
 	}
 
 	MerkleHashBuilder::MerkleHashBuilder(size_t capacity) {
@@ -79,6 +103,37 @@ namespace catapult { namespace crypto {
 		hash = Final(m_hashes, [](const auto*, auto) {});
 	}
 
+	void MerkleHashBuilder::final(Hash256& hash, const MerkleHashParallelOptions& options) {
+		auto numLeaves = m_hashes.size();
+		if (numLeaves < std::max<size_t>(2, options.MinParallelLeafCount) || options.MaxPartitions < 2) {
+			final(hash);
+			return;
+		}
+
+		// split the leaves into subtrees of equal (power of two) size that can be hashed independently; at every level,
+		// only the last subtree can have an odd number of hashes, so its padding matches the padding of the complete tree
+		auto subtreeHeight = CalculateSubtreeHeight(numLeaves, options.MaxPartitions);
+		auto subtreeSize = static_cast<size_t>(1) << subtreeHeight;
+		auto numPartitions = (numLeaves + subtreeSize - 1) / subtreeSize;
+		options.ProcessPartitions(numPartitions, [this, numLeaves, subtreeHeight, subtreeSize](auto partitionIndex) {
+			auto* pHashes = &m_hashes[partitionIndex * subtreeSize];
+			auto numRemainingHashes = std::min(subtreeSize, numLeaves - partitionIndex * subtreeSize);
+
+			std::vector<RawBuffer> pairBuffers;
+			pairBuffers.reserve(numRemainingHashes / 2);
+			for (auto i = 0u; i < subtreeHeight; ++i)
+				numRemainingHashes = HashLevel(pHashes, numRemainingHashes, pairBuffers, [](const auto*, auto) {});
+		});
+
+		// build the merkle root from the subtree roots
+		std::vector<Hash256> subtreeHashes;
+		subtreeHashes.reserve(numPartitions);
+		for (auto i = 0u; i < numPartitions; ++i)
+			subtreeHashes.push_back(m_hashes[i * subtreeSize]);
+
+		hash = Final(subtreeHashes, [](const auto*, auto) {});
+	}
+
 	void MerkleHashBuilder::final(std::vector<Hash256>& tree) {
 		// build the complete merkle tree
 		tree.reserve(TreeSize(m_hashes.size()));
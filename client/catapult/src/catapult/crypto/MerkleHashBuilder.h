@@ -20,11 +20,25 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <vector>
 
 namespace catapult { namespace crypto {
 
+	/// Options for calculating a merkle hash in parallel.
+	struct MerkleHashParallelOptions {
+		/// Minimum number of leaves required for subtrees to be hashed in parallel.
+		size_t MinParallelLeafCount;
+
+		/// Maximum number of subtrees that are hashed in parallel.
+		size_t MaxPartitions;
+
+		/// Calls the supplied function once for each partition index less than the specified number of partitions
+		/// (possibly concurrently) and returns after all partitions have been processed.
+		consumer<size_t, const consumer<size_t>&> ProcessPartitions;
+	};
+
 	/// Builder for creating a merkle hash.
 	class MerkleHashBuilder {
 	public:
@@ -38,6 +52,10 @@ namespace catapult { namespace crypto {
 		/// Finalizes the merkle hash into \a hash.
 		void final(Hash256& hash);
 
+		/// Finalizes the merkle hash into \a hash, hashing independent subtrees in parallel according to \a options.
+		/// \note The calculated hash is identical to the one calculated by the single threaded overload.
+		void final(Hash256& hash, const MerkleHashParallelOptions& options);
+
 		/// Finalizes the complete merkle tree into \a tree.
 		void final(std::vector<Hash256>& tree);
 
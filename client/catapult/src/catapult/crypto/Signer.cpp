@@ -207,7 +207,8 @@ namespace catapult { namespace crypto {
 		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
 			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				const auto& signatureInput = pSignatureInputs[offset + i];
+				valid[offset + i] = Verify(signatureInput.PublicKey, signatureInput.Buffers, signatureInput.Signature);
 				aggregateResult &= valid[offset + i];
 			}
 
@@ -20,7 +20,9 @@
 **/
 
 #pragma once
+#include "FlatMap.h"
 #include <memory>
+#include <unordered_map>
 
 namespace catapult { namespace deltaset {
 
@@ -200,4 +202,22 @@ namespace catapult { namespace deltaset {
 	};
 
 	// endregion
+
+	// region map storage policies
+
+	// map storage policies select the hashed memory container used by map based sets and their deltas
+
+	/// Map storage policy that uses node based stl unordered maps.
+	struct UnorderedMapStoragePolicy {
+		template<typename TKey, typename TValue, typename THasher>
+		using MapType = std::unordered_map<TKey, TValue, THasher>;
+	};
+
+	/// Map storage policy that uses open addressing flat maps.
+	struct FlatMapStoragePolicy {
+		template<typename TKey, typename TValue, typename THasher>
+		using MapType = FlatMap<TKey, TValue, THasher>;
+	};
+
+	// endregion
 }}
@@ -351,9 +351,20 @@ namespace catapult { namespace deltaset {
 		};
 
 		// for hashed containers, use unordered_map because hasher is specified
+		template<typename T, typename TMemorySet>
+		struct HashedKeyGenerationIdMap {
+			using Type = std::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
+		};
+
+		// for hashed containers with elements stored in a flat map, use flat map too
+		template<typename T, typename ...TArgs>
+		struct HashedKeyGenerationIdMap<T, FlatMap<TArgs...>> {
+			using Type = FlatMap<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
+		};
+
 		template<typename T>
 		struct KeyGenerationIdMap<T, utils::traits::is_type_expression_t<typename T::hasher>> {
-			using Type = std::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
+			using Type = typename HashedKeyGenerationIdMap<T, MemorySetType>::Type;
 		};
 
 	private:
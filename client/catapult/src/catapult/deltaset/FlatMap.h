@@ -0,0 +1,557 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/IntegerMath.h"
+#include "catapult/utils/traits/StlTraits.h"
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace catapult { namespace deltaset {
+
+	/// Open addressing hash map that is a drop-in replacement for std::unordered_map in base sets.
+	/// \note Slots are stored contiguously and probed linearly; entries are stored in geometrically growing chunks,
+	///       so references and iterators to elements remain valid until the elements are erased.
+	template<typename TKey, typename TValue, typename THasher = std::hash<TKey>, typename TKeyEqual = std::equal_to<TKey>>
+	class FlatMap {
+	public:
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<const TKey, TValue>;
+		using size_type = size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+
+	private:
+		static constexpr auto Empty_Entry_Index = std::numeric_limits<uint32_t>::max();
+		static constexpr auto End_Entry_Index = std::numeric_limits<size_t>::max();
+		static constexpr size_t Min_Num_Slots = 16;
+		static constexpr size_t First_Chunk_Size = 8;
+
+		struct Slot {
+			uint32_t EntryIndex;
+			uint32_t HashTag;
+		};
+
+		struct Entry {
+		public:
+			Entry()
+			{}
+
+			~Entry()
+			{}
+
+		public:
+			union {
+				value_type Value;
+			};
+		};
+
+	private:
+		template<typename TMap, typename TElement>
+		class IteratorT {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = TElement;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			IteratorT() : IteratorT(nullptr, End_Entry_Index)
+			{}
+
+			/// Creates an iterator around \a pMap pointing to the entry at \a entryIndex.
+			IteratorT(TMap* pMap, size_t entryIndex)
+					: m_pMap(pMap)
+					, m_entryIndex(entryIndex)
+			{}
+
+			/// Creates a const iterator from a mutable iterator (\a iter).
+			template<typename TMap2, typename TElement2, typename X = std::enable_if_t<!std::is_same_v<TMap, TMap2>>>
+			IteratorT(const IteratorT<TMap2, TElement2>& iter)
+					: m_pMap(iter.m_pMap)
+					, m_entryIndex(iter.m_entryIndex)
+			{}
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const IteratorT& rhs) const {
+				return m_entryIndex == rhs.m_entryIndex && (End_Entry_Index == m_entryIndex || m_pMap == rhs.m_pMap);
+			}
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const IteratorT& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next element.
+			IteratorT& operator++() {
+				m_entryIndex = m_pMap->nextEntryIndex(m_entryIndex + 1);
+				return *this;
+			}
+
+			/// Advances the iterator to the next element.
+			IteratorT operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		public:
+			/// Gets a reference to the current element.
+			reference operator*() const {
+				return m_pMap->entry(m_entryIndex).Value;
+			}
+
+			/// Gets a pointer to the current element.
+			pointer operator->() const {
+				return &m_pMap->entry(m_entryIndex).Value;
+			}
+
+		private:
+			TMap* m_pMap;
+			size_t m_entryIndex;
+
+			template<typename TMap2, typename TElement2>
+			friend class IteratorT;
+
+			friend class FlatMap;
+		};
+
+	public:
+		using iterator = IteratorT<FlatMap, value_type>;
+		using const_iterator = IteratorT<const FlatMap, const value_type>;
+
+	public:
+		/// Creates an empty map.
+		FlatMap() : m_size(0)
+		{}
+
+		/// Creates a map around \a values.
+		FlatMap(std::initializer_list<value_type> values) : FlatMap() {
+			reserve(values.size());
+			insert(values.begin(), values.end());
+		}
+
+		/// Copy constructs a map from \a rhs.
+		FlatMap(const FlatMap& rhs) : FlatMap() {
+			reserve(rhs.size());
+			insert(rhs.cbegin(), rhs.cend());
+		}
+
+		/// Move constructs a map from \a rhs.
+		FlatMap(FlatMap&& rhs) noexcept : FlatMap() {
+			swap(rhs);
+		}
+
+		/// Destroys the map.
+		~FlatMap() {
+			destroyAll();
+		}
+
+	public:
+		/// Assigns \a rhs to this map.
+		FlatMap& operator=(const FlatMap& rhs) {
+			if (this != &rhs) {
+				auto copy = rhs;
+				swap(copy);
+			}
+
+			return *this;
+		}
+
+		/// Move assigns \a rhs to this map.
+		FlatMap& operator=(FlatMap&& rhs) noexcept {
+			if (this != &rhs) {
+				clear();
+				swap(rhs);
+			}
+
+			return *this;
+		}
+
+	public:
+		/// Gets a value indicating whether or not this map is empty.
+		bool empty() const {
+			return 0 == m_size;
+		}
+
+		/// Gets the size of this map.
+		size_t size() const {
+			return m_size;
+		}
+
+	public:
+		/// Gets an iterator to the first element of this map.
+		iterator begin() {
+			return iterator(this, nextEntryIndex(0));
+		}
+
+		/// Gets an iterator to the element following the last element of this map.
+		iterator end() {
+			return iterator(this, End_Entry_Index);
+		}
+
+		/// Gets a const iterator to the first element of this map.
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		/// Gets a const iterator to the element following the last element of this map.
+		const_iterator end() const {
+			return cend();
+		}
+
+		/// Gets a const iterator to the first element of this map.
+		const_iterator cbegin() const {
+			return const_iterator(this, nextEntryIndex(0));
+		}
+
+		/// Gets a const iterator to the element following the last element of this map.
+		const_iterator cend() const {
+			return const_iterator(this, End_Entry_Index);
+		}
+
+	public:
+		/// Searches for \a key in this map.
+		iterator find(const TKey& key) {
+			return iterator(this, findEntryIndex(key));
+		}
+
+		/// Searches for \a key in this map.
+		const_iterator find(const TKey& key) const {
+			return const_iterator(this, findEntryIndex(key));
+		}
+
+		/// Gets a reference to the value associated with \a key and inserts a default value if \a key is not contained.
+		TValue& operator[](const TKey& key) {
+			auto entryIndex = findEntryIndex(key);
+			if (End_Entry_Index != entryIndex)
+				return entry(entryIndex).Value.second;
+
+			return emplace(std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>()).first->second;
+		}
+
+		/// Gets the number of elements matching \a key.
+		size_t count(const TKey& key) const {
+			return End_Entry_Index == findEntryIndex(key) ? 0 : 1;
+		}
+
+	public:
+		/// Inserts \a value into this map if its key is not already contained.
+		std::pair<iterator, bool> insert(const value_type& value) {
+			auto entryIndex = findEntryIndex(value.first);
+			return End_Entry_Index != entryIndex ? std::make_pair(iterator(this, entryIndex), false) : emplace(value);
+		}
+
+		/// Inserts \a value into this map if its key is not already contained.
+		template<typename TPair, typename X = std::enable_if_t<std::is_constructible_v<value_type, TPair&&>>>
+		std::pair<iterator, bool> insert(TPair&& value) {
+			return emplace(std::forward<TPair>(value));
+		}
+
+		/// Inserts \a value into this map if its key is not already contained.
+		/// \note The hint is ignored.
+		iterator insert(const_iterator, const value_type& value) {
+			return insert(value).first;
+		}
+
+		/// Inserts all elements in the range [\a first, \a last) into this map.
+		template<typename TIterator>
+		void insert(TIterator first, TIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		/// Creates an element around the passed arguments (\a args) and inserts it into this map
+		/// if its key is not already contained.
+		template<typename... TArgs>
+		std::pair<iterator, bool> emplace(TArgs&&... args) {
+			if ((m_size + 1) * 4 > m_slots.size() * 3)
+				rehash(CalculateNumSlots(m_size + 1));
+
+			// construct the element in place before lookup in order to avoid an intermediate copy
+			auto entryIndex = allocateEntry();
+			value_type* pValue;
+			try {
+				pValue = new (&entry(entryIndex).Value) value_type(std::forward<TArgs>(args)...);
+			} catch (...) {
+				// return the entry so that a throwing constructor does not leak it
+				freeEntry(entryIndex);
+				throw;
+			}
+
+			auto hashTag = ToHashTag(THasher()(pValue->first));
+			auto existingEntryIndex = findEntryIndex(pValue->first, hashTag);
+			if (End_Entry_Index != existingEntryIndex) {
+				pValue->~value_type();
+				freeEntry(entryIndex);
+				return std::make_pair(iterator(this, existingEntryIndex), false);
+			}
+
+			m_entryStates[entryIndex] = true;
+			++m_size;
+
+			insertSlot(Slot{ static_cast<uint32_t>(entryIndex), hashTag });
+			return std::make_pair(iterator(this, entryIndex), true);
+		}
+
+		/// Reserves space for at least \a count elements.
+		void reserve(size_t count) {
+			auto numSlots = CalculateNumSlots(count);
+			if (numSlots > m_slots.size())
+				rehash(numSlots);
+		}
+
+	public:
+		/// Erases the element with \a key and returns the number of erased elements.
+		size_t erase(const TKey& key) {
+			auto slotIndex = findSlotIndex(key);
+			if (End_Entry_Index == slotIndex)
+				return 0;
+
+			eraseAt(slotIndex);
+			return 1;
+		}
+
+		/// Erases the element pointed to by \a iter and returns an iterator to the following element.
+		iterator erase(const_iterator iter) {
+			auto entryIndex = iter.m_entryIndex;
+			eraseAt(findSlotIndex(entry(entryIndex).Value.first));
+			return iterator(this, nextEntryIndex(entryIndex + 1));
+		}
+
+		/// Erases all elements in this map.
+		/// \note Allocated slots and entry chunks are retained for reuse.
+		void clear() {
+			destroyAll();
+
+			for (auto& slot : m_slots)
+				slot = Slot{ Empty_Entry_Index, 0 };
+
+			m_freeEntryIndexes.clear();
+			m_entryStates.clear();
+			m_size = 0;
+		}
+
+		/// Swaps the contents of this map with \a rhs.
+		void swap(FlatMap& rhs) noexcept {
+			std::swap(m_slots, rhs.m_slots);
+			std::swap(m_chunks, rhs.m_chunks);
+			std::swap(m_entryStates, rhs.m_entryStates);
+			std::swap(m_freeEntryIndexes, rhs.m_freeEntryIndexes);
+			std::swap(m_size, rhs.m_size);
+		}
+
+	public:
+		/// Returns \c true if this map is equal to \a rhs.
+		bool operator==(const FlatMap& rhs) const {
+			if (m_size != rhs.m_size)
+				return false;
+
+			for (const auto& value : *this) {
+				auto iter = rhs.find(value.first);
+				if (rhs.cend() == iter || !(iter->second == value.second))
+					return false;
+			}
+
+			return true;
+		}
+
+		/// Returns \c true if this map is not equal to \a rhs.
+		bool operator!=(const FlatMap& rhs) const {
+			return !(*this == rhs);
+		}
+
+	private:
+		static size_t CalculateNumSlots(size_t count) {
+			// keep load factor at or below 3/4
+			auto numSlots = Min_Num_Slots;
+			while (numSlots * 3 < count * 4)
+				numSlots *= 2;
+
+			return numSlots;
+		}
+
+		static uint32_t ToHashTag(size_t hash) {
+			// mix all hash bits into the tag because slots are selected by its low bits
+			return static_cast<uint32_t>((static_cast<uint64_t>(hash) * 0x9E37'79B9'7F4A'7C15) >> 32);
+		}
+
+		size_t slotMask() const {
+			return m_slots.size() - 1;
+		}
+
+		size_t findSlotIndex(const TKey& key) const {
+			return findSlotIndex(key, ToHashTag(THasher()(key)));
+		}
+
+		size_t findSlotIndex(const TKey& key, uint32_t hashTag) const {
+			if (m_slots.empty())
+				return End_Entry_Index;
+
+			for (auto slotIndex = hashTag & slotMask();; slotIndex = (slotIndex + 1) & slotMask()) {
+				const auto& slot = m_slots[slotIndex];
+				if (Empty_Entry_Index == slot.EntryIndex)
+					return End_Entry_Index;
+
+				if (hashTag == slot.HashTag && TKeyEqual()(entry(slot.EntryIndex).Value.first, key))
+					return slotIndex;
+			}
+		}
+
+		size_t findEntryIndex(const TKey& key) const {
+			return findEntryIndex(key, ToHashTag(THasher()(key)));
+		}
+
+		size_t findEntryIndex(const TKey& key, uint32_t hashTag) const {
+			auto slotIndex = findSlotIndex(key, hashTag);
+			return End_Entry_Index == slotIndex ? End_Entry_Index : m_slots[slotIndex].EntryIndex;
+		}
+
+		void insertSlot(const Slot& slot) {
+			auto slotIndex = slot.HashTag & slotMask();
+			while (Empty_Entry_Index != m_slots[slotIndex].EntryIndex)
+				slotIndex = (slotIndex + 1) & slotMask();
+
+			m_slots[slotIndex] = slot;
+		}
+
+		void eraseAt(size_t slotIndex) {
+			auto entryIndex = m_slots[slotIndex].EntryIndex;
+			entry(entryIndex).Value.~value_type();
+			m_entryStates[entryIndex] = false;
+			m_freeEntryIndexes.push_back(entryIndex);
+			--m_size;
+
+			// shift following slots back into the hole so that probe sequences stay intact without tombstones
+			auto holeIndex = slotIndex;
+			for (auto nextIndex = (holeIndex + 1) & slotMask();; nextIndex = (nextIndex + 1) & slotMask()) {
+				const auto& slot = m_slots[nextIndex];
+				if (Empty_Entry_Index == slot.EntryIndex)
+					break;
+
+				// slot can only be moved if its home index is not cyclically within (holeIndex, nextIndex]
+				auto homeDistance = (nextIndex - slot.HashTag) & slotMask();
+				if (homeDistance < ((nextIndex - holeIndex) & slotMask()))
+					continue;
+
+				m_slots[holeIndex] = slot;
+				holeIndex = nextIndex;
+			}
+
+			m_slots[holeIndex] = Slot{ Empty_Entry_Index, 0 };
+		}
+
+		void rehash(size_t numSlots) {
+			std::vector<Slot> slots(numSlots, Slot{ Empty_Entry_Index, 0 });
+			m_slots.swap(slots);
+
+			for (const auto& slot : slots) {
+				if (Empty_Entry_Index != slot.EntryIndex)
+					insertSlot(slot);
+			}
+		}
+
+	private:
+		static std::pair<size_t, size_t> ToChunkPosition(size_t entryIndex) {
+			// chunk N contains First_Chunk_Size * 2^N entries
+			auto chunkIndex = static_cast<size_t>(utils::Log2(static_cast<uint64_t>(entryIndex / First_Chunk_Size + 1)));
+			auto chunkStartIndex = First_Chunk_Size * ((static_cast<size_t>(1) << chunkIndex) - 1);
+			return std::make_pair(chunkIndex, entryIndex - chunkStartIndex);
+		}
+
+		Entry& entry(size_t entryIndex) {
+			auto position = ToChunkPosition(entryIndex);
+			return m_chunks[position.first][position.second];
+		}
+
+		const Entry& entry(size_t entryIndex) const {
+			auto position = ToChunkPosition(entryIndex);
+			return m_chunks[position.first][position.second];
+		}
+
+		size_t allocateEntry() {
+			if (!m_freeEntryIndexes.empty()) {
+				auto entryIndex = m_freeEntryIndexes.back();
+				m_freeEntryIndexes.pop_back();
+				return entryIndex;
+			}
+
+			auto entryIndex = m_entryStates.size();
+			auto chunkIndex = ToChunkPosition(entryIndex).first;
+			if (m_chunks.size() == chunkIndex)
+				m_chunks.push_back(std::make_unique<Entry[]>(First_Chunk_Size << chunkIndex));
+
+			m_entryStates.push_back(false);
+			return entryIndex;
+		}
+
+		void freeEntry(size_t entryIndex) {
+			// an unused last entry can be dropped instead of being added to the free list
+			if (m_entryStates.size() == entryIndex + 1)
+				m_entryStates.pop_back();
+			else
+				m_freeEntryIndexes.push_back(static_cast<uint32_t>(entryIndex));
+		}
+
+		size_t nextEntryIndex(size_t entryIndex) const {
+			for (; entryIndex < m_entryStates.size(); ++entryIndex) {
+				if (m_entryStates[entryIndex])
+					return entryIndex;
+			}
+
+			return End_Entry_Index;
+		}
+
+		void destroyAll() {
+			for (auto i = 0u; i < m_entryStates.size(); ++i) {
+				if (m_entryStates[i])
+					entry(i).Value.~value_type();
+			}
+		}
+
+	private:
+		std::vector<Slot> m_slots;
+		std::vector<std::unique_ptr<Entry[]>> m_chunks;
+		std::vector<bool> m_entryStates;
+		std::vector<uint32_t> m_freeEntryIndexes;
+		size_t m_size;
+	};
+}}
+
+namespace catapult { namespace utils { namespace traits {
+
+	template<typename ...TArgs>
+	struct is_map<deltaset::FlatMap<TArgs...>> : std::true_type {};
+
+	template<typename ...TArgs>
+	struct is_map<const deltaset::FlatMap<TArgs...>> : std::true_type {};
+}}}
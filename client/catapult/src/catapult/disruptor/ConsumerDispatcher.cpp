@@ -23,7 +23,7 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
+#include <algorithm>
 
 namespace catapult { namespace disruptor {
 
@@ -32,9 +32,17 @@ namespace catapult { namespace disruptor {
 			if (!options.DispatcherName || 0 == options.DisruptorSlotCount || utils::FileSize() == options.DisruptorMaxMemorySize)
 				CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher options are invalid");
 
+			if (0 == options.MaxConsumerBatchSize || utils::TimeSpan() == options.LatencyWindowDuration)
+				CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher options are invalid");
+
 			return options;
 		}
 
+		uint64_t ElapsedMicros(DisruptorElement::Clock::time_point startTime, DisruptorElement::Clock::time_point endTime) {
+			auto elapsedDuration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+			return static_cast<uint64_t>(std::max<int64_t>(0, elapsedDuration.count()));
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -55,31 +63,60 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, DisruptorBatchConsumersFromConsumers(consumers), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const std::vector<DisruptorBatchConsumer>& batchConsumers,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_options(options)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(batchConsumers.size() + 1)
+			, m_pWaiter(CreateDisruptorWaiter(m_options.WaitStrategy, m_barriers.size()))
 			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0)
-			, m_memorySize(0) {
+			, m_memorySize(0)
+			, m_elementLatencies(m_options.LatencyWindowDuration) {
+		for (auto i = 0u; i < batchConsumers.size(); ++i)
+			m_stageLatencies.push_back(std::make_unique<utils::WindowedLatencyHistogram>(m_options.LatencyWindowDuration));
+
 		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
+		for (const auto& batchConsumer : batchConsumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
+			m_threads.spawn([pThis = this, consumerEntry, batchConsumer]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+
+				ConsumerBatch batch;
+				batch.MaxCoalescingDelay = batchConsumer.maxCoalescingDelay();
 				while (pThis->m_keepRunning) {
-					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					if (!pThis->tryNextBatch(consumerEntry, batch)) {
+						pThis->waitForNext(consumerEntry, batch);
 						continue;
 					}
 
-					auto result = consumer(pDisruptorElement->input());
-					if (CompletionStatus::Aborted == result.CompletionStatus)
-						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
+					if (!batch.Inputs.empty()) {
+						auto startTime = DisruptorElement::Clock::now();
+						auto results = batchConsumer(batch.Inputs);
+						auto endTime = DisruptorElement::Clock::now();
+						pThis->m_stageLatencies[consumerEntry.level()]->record(ElapsedMicros(startTime, endTime), endTime);
+
+						if (results.size() != batch.Inputs.size()) {
+							CATAPULT_THROW_RUNTIME_ERROR_2(
+									"batch consumer returned wrong number of results",
+									results.size(),
+									batch.Inputs.size());
+						}
+
+						for (auto i = 0u; i < results.size(); ++i) {
+							if (CompletionStatus::Aborted == results[i].CompletionStatus)
+								pThis->m_disruptor.markSkipped(batch.Positions[i], results[i]);
+						}
+					}
 
-					pThis->advance(consumerEntry);
+					pThis->advance(consumerEntry, batch.NumClaimed);
 				}
 			});
 		}
@@ -93,6 +130,7 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		m_pWaiter->notifyAll();
 		m_threads.join();
 	}
 
@@ -116,38 +154,112 @@ namespace catapult { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
-	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
-		while (true) {
-			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
-			auto consumerPosition = consumerEntry.position();
-			if (consumerPosition == consumerBarrierPosition)
-				return nullptr;
+	size_t ConsumerDispatcher::queueDepth(size_t level) const {
+		if (level >= m_stageLatencies.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid consumer level", level);
+
+		// read the next barrier first so that the difference is never negative (the next barrier never passes this one)
+		auto nextBarrierPosition = m_barriers[level + 1].position();
+		return static_cast<size_t>(m_barriers[level].position() - nextBarrierPosition);
+	}
+
+	const utils::WindowedLatencyHistogram& ConsumerDispatcher::stageLatencies(size_t level) const {
+		if (level >= m_stageLatencies.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid consumer level", level);
+
+		return *m_stageLatencies[level];
+	}
+
+	const utils::WindowedLatencyHistogram& ConsumerDispatcher::elementLatencies() const {
+		return m_elementLatencies;
+	}
+
+	bool ConsumerDispatcher::tryNextBatch(const ConsumerEntry& consumerEntry, ConsumerBatch& batch) {
+		batch.Positions.clear();
+		batch.Inputs.clear();
 
-			if (!m_disruptor.isSkipped(consumerPosition))
-				return &m_disruptor.elementAt(consumerPosition);
+		// claim all positions up to the previous barrier (bounded by max batch size) with a single barrier read
+		auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
+		auto consumerPosition = consumerEntry.position();
+		auto numAvailable = consumerBarrierPosition - consumerPosition;
+		batch.NumClaimed = 0;
+		if (0 == numAvailable)
+			return false;
+
+		// when coalescing is enabled, start the deadline when the first element becomes available and
+		// wait for a full batch until it passes
+		if (utils::TimeSpan() != batch.MaxCoalescingDelay && !batch.CoalescingDeadline)
+			batch.CoalescingDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch.MaxCoalescingDelay.millis());
+
+		if (!isBatchReady(numAvailable, batch))
+			return false;
+
+		batch.CoalescingDeadline.reset();
+		batch.NumClaimed = std::min<PositionType>(numAvailable, m_options.MaxConsumerBatchSize);
+
+		// skipped elements are claimed (so that they are advanced past) but are not passed to the consumer
+		for (auto position = consumerPosition; position < consumerPosition + batch.NumClaimed; ++position) {
+			if (m_disruptor.isSkipped(position))
+				continue;
 
-			advance(consumerEntry);
+			batch.Positions.push_back(position);
+			batch.Inputs.push_back(&m_disruptor.elementAt(position).input());
 		}
+
+		return 0 != batch.NumClaimed;
+	}
+
+	bool ConsumerDispatcher::isBatchReady(PositionType numAvailable, const ConsumerBatch& batch) const {
+		if (0 == numAvailable)
+			return false;
+
+		if (!batch.CoalescingDeadline || numAvailable >= m_options.MaxConsumerBatchSize)
+			return true;
+
+		return std::chrono::steady_clock::now() >= *batch.CoalescingDeadline;
+	}
+
+	void ConsumerDispatcher::waitForNext(const ConsumerEntry& consumerEntry, const ConsumerBatch& batch) {
+		// wake up no later than the coalescing deadline so that a partial batch is not delayed past it
+		auto deadline = batch.CoalescingDeadline.value_or(std::chrono::steady_clock::time_point::max());
+		m_pWaiter->wait(consumerEntry.level(), deadline, [this, &consumerEntry, &batch]() {
+			return !m_keepRunning || isBatchReady(m_barriers[consumerEntry.level()].position() - consumerEntry.position(), batch);
+		});
 	}
 
-	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry) {
+	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry, PositionType count) {
 		auto consumerPosition = consumerEntry.position();
-		consumerEntry.advance();
-		m_barriers[consumerEntry.level() + 1].advance();
+		consumerEntry.advance(count);
+
+		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer;
+		// only the final element in the batch can be inspected after the barrier is advanced because producers
+		// keep a single free slot between the last barrier and the next claimed position
+		// (all elements in the batch share a single inspection time)
+		auto isLastConsumer = consumerEntry.level() + 1 == m_barriers.size() - 1;
+		auto inspectionTime = isLastConsumer ? DisruptorElement::Clock::now() : DisruptorElement::Clock::time_point();
+		if (isLastConsumer) {
+			for (auto i = 0u; i < count - 1; ++i)
+				inspect(consumerPosition + i, inspectionTime);
+		}
+
+		m_barriers[consumerEntry.level() + 1].advance(count);
+		m_pWaiter->notify(consumerEntry.level() + 1);
 
-		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
-			return;
+		if (isLastConsumer)
+			inspect(consumerPosition + count - 1, inspectionTime);
+	}
 
-		auto& element = m_disruptor.elementAt(consumerPosition);
+	void ConsumerDispatcher::inspect(PositionType position, DisruptorElement::Clock::time_point inspectionTime) {
+		auto& element = m_disruptor.elementAt(position);
 		LogCompletion(element, m_barriers, m_options.ElementTraceInterval);
+		m_elementLatencies.record(ElapsedMicros(element.creationTime(), inspectionTime), inspectionTime);
 		m_inspector(element.input(), element.completionResult());
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	bool ConsumerDispatcher::canProcessNextElement(PositionType position) const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
+		auto maxPosition = position;
 		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
 		auto totalCapacity = m_disruptor.capacity();
 
@@ -158,6 +270,22 @@ namespace catapult { namespace disruptor {
 		return requiredCapacity == totalCapacity;
 	}
 
+	bool ConsumerDispatcher::tryReserveMemory(utils::FileSize inputMemorySize) {
+		auto memorySize = m_memorySize.load();
+		for (;;) {
+			if (m_options.DisruptorMaxMemorySize.bytes() - memorySize < inputMemorySize.bytes()) {
+				CATAPULT_LOG(warning)
+						<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
+						<< ", current = " << utils::FileSize::FromBytes(memorySize) << ")";
+				return false;
+			}
+
+			// on failure, memorySize is updated to the current value, so the capacity check is repeated
+			if (m_memorySize.compare_exchange_weak(memorySize, memorySize + inputMemorySize.bytes()))
+				return true;
+		}
+	}
+
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize) {
 		return [this, processingComplete, inputMemorySize](auto elementId, const auto& result) {
 			processingComplete(elementId, result);
@@ -175,13 +303,11 @@ namespace catapult { namespace disruptor {
 
 		auto inputMemorySize = input.memorySize();
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		auto isFull = !canProcessNextElement();
-		if (m_options.DisruptorMaxMemorySize.bytes() - m_memorySize < inputMemorySize.bytes()) {
-			CATAPULT_LOG(warning)
-					<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
-					<< ", current = " << utils::FileSize::FromBytes(m_memorySize) << ")";
+		// reserve memory and claim a position without locking, so that multiple producers can add elements concurrently
+		auto isFull = !tryReserveMemory(inputMemorySize);
+		PositionType position = 0;
+		if (!isFull && !m_disruptor.tryClaim([this](auto cursor) { return canProcessNextElement(cursor); }, position)) {
+			m_memorySize -= inputMemorySize.bytes();
 			isFull = true;
 		}
 
@@ -192,11 +318,10 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		m_memorySize += inputMemorySize.bytes();
 		++m_numActiveElements;
 
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete, inputMemorySize));
-		m_barriers[0].advance();
+		auto id = m_disruptor.publish(position, std::move(input), wrap(processingComplete, inputMemorySize), m_barriers[0]);
+		m_pWaiter->notify(0);
 		return id;
 	}
 
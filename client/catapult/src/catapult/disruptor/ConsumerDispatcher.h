@@ -24,9 +24,14 @@
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
+#include "DisruptorWaitStrategy.h"
 #include "catapult/thread/ThreadGroup.h"
 #include "catapult/utils/NamedObject.h"
+#include "catapult/utils/WindowedLatencyHistogram.h"
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
 
 namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
@@ -46,6 +51,14 @@ namespace catapult { namespace disruptor {
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers);
 
+		/// Creates a dispatcher of batch consumers (\a batchConsumers) configured with \a options.
+		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
+		/// Inspector runs within a thread of the last consumer.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const std::vector<DisruptorBatchConsumer>& batchConsumers,
+				const DisruptorInspector& inspector);
+
 		~ConsumerDispatcher();
 
 	public:
@@ -74,12 +87,39 @@ namespace catapult { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the number of elements that are waiting for or being processed by the consumer at \a level.
+		size_t queueDepth(size_t level) const;
+
+		/// Gets the histogram of recent batch processing times (in microseconds) of the consumer at \a level.
+		const utils::WindowedLatencyHistogram& stageLatencies(size_t level) const;
+
+		/// Gets the histogram of recent times (in microseconds) elements spent in the disruptor before being inspected.
+		const utils::WindowedLatencyHistogram& elementLatencies() const;
+
 	private:
-		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
+		struct ConsumerBatch {
+			std::vector<PositionType> Positions;
+			std::vector<ConsumerInput*> Inputs;
+			PositionType NumClaimed = 0;
 
-		void advance(ConsumerEntry& consumerEntry);
+			utils::TimeSpan MaxCoalescingDelay;
+			std::optional<std::chrono::steady_clock::time_point> CoalescingDeadline;
+		};
 
-		bool canProcessNextElement() const;
+	private:
+		bool tryNextBatch(const ConsumerEntry& consumerEntry, ConsumerBatch& batch);
+
+		bool isBatchReady(PositionType numAvailable, const ConsumerBatch& batch) const;
+
+		void waitForNext(const ConsumerEntry& consumerEntry, const ConsumerBatch& batch);
+
+		void advance(ConsumerEntry& consumerEntry, PositionType count);
+
+		void inspect(PositionType position, DisruptorElement::Clock::time_point inspectionTime);
+
+		bool canProcessNextElement(PositionType position) const;
+
+		bool tryReserveMemory(utils::FileSize inputMemorySize);
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize);
 
@@ -87,12 +127,13 @@ namespace catapult { namespace disruptor {
 		ConsumerDispatcherOptions m_options;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
+		std::unique_ptr<DisruptorWaiter> m_pWaiter;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
-
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
+		std::vector<std::unique_ptr<utils::WindowedLatencyHistogram>> m_stageLatencies;
+		utils::WindowedLatencyHistogram m_elementLatencies;
 	};
 }}
@@ -20,7 +20,9 @@
 **/
 
 #pragma once
+#include "DisruptorWaitStrategy.h"
 #include "catapult/utils/FileSize.h"
+#include "catapult/utils/TimeSpan.h"
 
 namespace catapult { namespace disruptor {
 
@@ -34,6 +36,9 @@ namespace catapult { namespace disruptor {
 				, DisruptorMaxMemorySize(utils::FileSize::FromMegabytes(1024))
 				, ElementTraceInterval(1)
 				, ShouldThrowWhenFull(true)
+				, WaitStrategy(DisruptorWaitStrategy::Blocking)
+				, MaxConsumerBatchSize(1)
+				, LatencyWindowDuration(utils::TimeSpan::FromMinutes(5))
 		{}
 
 	public:
@@ -51,5 +56,14 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw when full, \c false if it should return an error.
 		bool ShouldThrowWhenFull;
+
+		/// Strategy used by idle consumers to wait for new elements.
+		DisruptorWaitStrategy WaitStrategy;
+
+		/// Maximum number of elements a consumer can claim and process at once.
+		size_t MaxConsumerBatchSize;
+
+		/// Duration of the windows over which latency statistics are reported.
+		utils::TimeSpan LatencyWindowDuration;
 	};
 }}
@@ -38,6 +38,12 @@ namespace catapult { namespace disruptor {
 			return ++m_position;
 		}
 
+		/// Advances the position by \a count.
+		PositionType advance(PositionType count) {
+			m_position += count;
+			return m_position;
+		}
+
 	public:
 		/// Gets the current position (in the circular buffer).
 		PositionType position() const {
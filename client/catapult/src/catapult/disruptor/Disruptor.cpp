@@ -28,22 +28,68 @@ namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
-	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
+	//  2. producers claim positions by CAS on m_cursor; ConsumerDispatcher only claims positions that are free
+	//  3. each slot is written by a single producer and made visible to consumers by publishing it (m_publishedPositions)
+	//     and advancing the first barrier past it, which can be done by any producer
+	//  4. markSkipped and isSkipped use an atomic flag inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
 			: m_elementTraceInterval(elementTraceInterval)
 			, m_container(disruptorSize)
+			, m_publishedPositions(disruptorSize)
+			, m_cursor(0)
 			, m_allElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		return store(m_cursor++, std::move(input), processingComplete);
+	}
+
+	bool Disruptor::tryClaim(const predicate<PositionType>& hasCapacity, PositionType& position) {
+		auto cursor = m_cursor.load();
+		do {
+			if (!hasCapacity(cursor))
+				return false;
+		} while (!m_cursor.compare_exchange_weak(cursor, cursor + 1));
+
+		position = cursor;
+		return true;
+	}
+
+	DisruptorElementId Disruptor::publish(
+			PositionType position,
+			ConsumerInput&& input,
+			const ProcessingCompleteFunc& processingComplete,
+			DisruptorBarrier& barrier) {
+		auto id = store(position, std::move(input), processingComplete);
+
+		// advance the barrier past all consecutively published positions, including ones published by other producers
+		// (a producer finishing out of order will have its position picked up by the producer publishing the gap)
+		auto barrierPosition = barrier.position();
+		while (isPublished(barrierPosition)) {
+			if (barrier.tryAdvance(barrierPosition))
+				++barrierPosition;
+			else
+				barrierPosition = barrier.position();
+		}
+
+		return id;
+	}
+
+	DisruptorElementId Disruptor::store(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
+		auto& element = m_container[position];
+		element = DisruptorElement(std::move(input), position + 1, processingComplete);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		auto id = element.id();
+		m_publishedPositions[position % m_publishedPositions.size()] = position + 1;
+		++m_allElementsCount;
+		return id;
+	}
+
+	bool Disruptor::isPublished(PositionType position) const {
+		return position + 1 == m_publishedPositions[position % m_publishedPositions.size()];
 	}
 
 	void Disruptor::markSkipped(PositionType position, const ConsumerResult& result) {
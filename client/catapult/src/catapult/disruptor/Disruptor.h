@@ -27,6 +27,8 @@
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include "catapult/functions.h"
+#include <algorithm>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -41,8 +43,23 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Adds \a input to the underlying container and returns the assigned disruptor element id.
 		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This unconditionally claims the next position, possibly overwriting existing elements.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Tries to claim the next position if \a hasCapacity returns \c true for it.
+		/// On success, the claimed position is stored in \a position.
+		/// \note This is safe to call from multiple producers concurrently.
+		bool tryClaim(const predicate<PositionType>& hasCapacity, PositionType& position);
+
+		/// Publishes \a input at a previously claimed \a position and returns the assigned disruptor element id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// Afterwards, \a barrier is advanced past all consecutively published positions.
+		DisruptorElementId publish(
+				PositionType position,
+				ConsumerInput&& input,
+				const ProcessingCompleteFunc& processingComplete,
+				DisruptorBarrier& barrier);
+
 		/// Sets the skip flag on the element at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result);
 
@@ -56,7 +73,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		inline size_t size() const {
-			return m_container.size();
+			return static_cast<size_t>(std::min<uint64_t>(m_allElementsCount, m_container.capacity()));
 		}
 
 		/// Gets the capacity of the disruptor.
@@ -69,9 +86,21 @@ namespace catapult { namespace disruptor {
 			return m_allElementsCount;
 		}
 
+		/// Gets the next position that will be claimed.
+		inline PositionType cursor() const {
+			return m_cursor;
+		}
+
+	private:
+		DisruptorElementId store(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
+		bool isPublished(PositionType position) const;
+
 	private:
 		size_t m_elementTraceInterval;
 		utils::CircularBuffer<DisruptorElement> m_container;
+		std::vector<std::atomic<PositionType>> m_publishedPositions; // (position + 1) of last element published in each slot
+		std::atomic<PositionType> m_cursor;
 		std::atomic<uint64_t> m_allElementsCount;
 	};
 }}
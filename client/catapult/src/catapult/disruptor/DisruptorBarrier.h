@@ -43,6 +43,17 @@ namespace catapult { namespace disruptor {
 			++m_position;
 		}
 
+		/// Advances the barrier by \a count positions.
+		inline void advance(PositionType count) {
+			m_position += count;
+		}
+
+		/// Advances the barrier if it is currently at \a position.
+		/// Returns \c true if the barrier was advanced.
+		inline bool tryAdvance(PositionType position) {
+			return m_position.compare_exchange_strong(position, position + 1);
+		}
+
 		/// Gets the level of the barrier.
 		inline size_t level() const {
 			return m_level;
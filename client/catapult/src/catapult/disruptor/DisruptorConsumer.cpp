@@ -54,4 +54,23 @@ namespace catapult { namespace disruptor {
 			return transactionConsumer(input.transactions());
 		});
 	}
+
+	DisruptorBatchConsumer DisruptorBatchConsumerFromConsumer(const DisruptorConsumer& consumer) {
+		return DisruptorBatchConsumer([consumer](const auto& inputs) {
+			std::vector<ConsumerResult> results;
+			results.reserve(inputs.size());
+			for (auto* pInput : inputs)
+				results.push_back(consumer(*pInput));
+
+			return results;
+		});
+	}
+
+	std::vector<DisruptorBatchConsumer> DisruptorBatchConsumersFromConsumers(const std::vector<DisruptorConsumer>& consumers) {
+		std::vector<DisruptorBatchConsumer> batchConsumers;
+		for (const auto& consumer : consumers)
+			batchConsumers.push_back(DisruptorBatchConsumerFromConsumer(consumer));
+
+		return batchConsumers;
+	}
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "DisruptorElement.h"
+#include "catapult/utils/TimeSpan.h"
 #include <functional>
 
 namespace catapult { namespace disruptor {
@@ -47,10 +48,51 @@ namespace catapult { namespace disruptor {
 	/// Const transaction disruptor consumer function.
 	using ConstTransactionConsumer = DisruptorConsumerT<const TransactionElements>;
 
+	/// Disruptor consumer that processes multiple inputs at once.
+	class DisruptorBatchConsumer {
+	public:
+		/// Batch consumer function that returns one result for each input.
+		using FunctionType = std::function<std::vector<ConsumerResult> (const std::vector<ConsumerInput*>&)>;
+
+	public:
+		/// Creates a batch consumer around \a func.
+		/// \note Constructor is explicit in order to prevent ambiguities with single input consumers.
+		explicit DisruptorBatchConsumer(const FunctionType& func) : DisruptorBatchConsumer(func, utils::TimeSpan())
+		{}
+
+		/// Creates a batch consumer around \a func that waits at most \a maxCoalescingDelay for a full batch of inputs.
+		DisruptorBatchConsumer(const FunctionType& func, const utils::TimeSpan& maxCoalescingDelay)
+				: m_func(func)
+				, m_maxCoalescingDelay(maxCoalescingDelay)
+		{}
+
+	public:
+		/// Gets the maximum amount of time to wait for a full batch of inputs before processing a partial batch.
+		const utils::TimeSpan& maxCoalescingDelay() const {
+			return m_maxCoalescingDelay;
+		}
+
+	public:
+		/// Processes \a inputs and returns one result for each input.
+		std::vector<ConsumerResult> operator()(const std::vector<ConsumerInput*>& inputs) const {
+			return m_func(inputs);
+		}
+
+	private:
+		FunctionType m_func;
+		utils::TimeSpan m_maxCoalescingDelay;
+	};
+
 	/// Maps \a blockConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromBlockConsumers(const std::vector<BlockConsumer>& blockConsumers);
 
 	/// Maps \a transactionConsumers to disruptor consumers so that they can be used to create a ConsumerDispatcher.
 	std::vector<DisruptorConsumer> DisruptorConsumersFromTransactionConsumers(
 			const std::vector<TransactionConsumer>& transactionConsumers);
+
+	/// Maps \a consumer to a batch consumer that processes each input in a batch individually.
+	DisruptorBatchConsumer DisruptorBatchConsumerFromConsumer(const DisruptorConsumer& consumer);
+
+	/// Maps \a consumers to batch consumers that process each input in a batch individually.
+	std::vector<DisruptorBatchConsumer> DisruptorBatchConsumersFromConsumers(const std::vector<DisruptorConsumer>& consumers);
 }}
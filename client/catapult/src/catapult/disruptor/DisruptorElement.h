@@ -21,18 +21,23 @@
 
 #pragma once
 #include "ConsumerInput.h"
-#include "catapult/utils/SpinLock.h"
+#include <atomic>
+#include <chrono>
 
 namespace catapult { namespace disruptor {
 
 	/// Augments consumer input with disruptor metadata.
 	class DisruptorElement {
+	public:
+		/// Clock used for timing elements.
+		using Clock = std::chrono::steady_clock;
+
 	public:
 		/// Creates a default disruptor element.
 		DisruptorElement()
 				: m_id(static_cast<uint64_t>(-1))
 				, m_processingComplete([](auto, auto) {})
-				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_isSkipped(false)
 		{}
 
 		/// Creates a disruptor element around \a input with \a id and a completion handler \a processingComplete.
@@ -40,9 +45,32 @@ namespace catapult { namespace disruptor {
 				: m_input(std::move(input))
 				, m_id(id)
 				, m_processingComplete(processingComplete)
-				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_isSkipped(false)
+				, m_creationTime(Clock::now())
+		{}
+
+		/// Move constructor.
+		DisruptorElement(DisruptorElement&& element)
+				: m_input(std::move(element.m_input))
+				, m_id(element.m_id)
+				, m_processingComplete(std::move(element.m_processingComplete))
+				, m_result(element.m_result)
+				, m_isSkipped(element.m_isSkipped.load(std::memory_order_acquire))
+				, m_creationTime(element.m_creationTime)
 		{}
 
+	public:
+		/// Move assignment operator.
+		DisruptorElement& operator=(DisruptorElement&& element) {
+			m_input = std::move(element.m_input);
+			m_id = element.m_id;
+			m_processingComplete = std::move(element.m_processingComplete);
+			m_result = element.m_result;
+			m_isSkipped.store(element.m_isSkipped.load(std::memory_order_acquire), std::memory_order_release);
+			m_creationTime = element.m_creationTime;
+			return *this;
+		}
+
 	public:
 		/// Gets the consumer input.
 		ConsumerInput& input() {
@@ -59,31 +87,35 @@ namespace catapult { namespace disruptor {
 			return m_id;
 		}
 
+		/// Gets the time at which the element was created.
+		Clock::time_point creationTime() const {
+			return m_creationTime;
+		}
+
 		/// Returns \c true if the element is skipped.
 		bool isSkipped() const {
-			utils::SpinLockGuard guard(*m_pSpinLock);
-			return CompletionStatus::Aborted == m_result.CompletionStatus;
+			return m_isSkipped.load(std::memory_order_acquire);
 		}
 
 		/// Gets the current element completion result.
 		ConsumerCompletionResult completionResult() const {
-			utils::SpinLockGuard guard(*m_pSpinLock);
-			return m_result;
+			// result is only modified by markSkipped, which publishes it via m_isSkipped
+			return isSkipped() ? m_result : ConsumerCompletionResult();
 		}
 
 	public:
 		/// Marks the element as skipped at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result) {
-			utils::SpinLockGuard guard(*m_pSpinLock);
 			m_result.CompletionStatus = CompletionStatus::Aborted;
 			m_result.CompletionCode = result.CompletionCode;
 			m_result.ResultSeverity = result.ResultSeverity;
 			m_result.FinalConsumerPosition = position;
+			m_isSkipped.store(true, std::memory_order_release);
 		}
 
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
-			m_processingComplete(m_id, m_result);
+			m_processingComplete(m_id, completionResult());
 		}
 
 	private:
@@ -91,7 +123,8 @@ namespace catapult { namespace disruptor {
 		DisruptorElementId m_id;
 		ProcessingCompleteFunc m_processingComplete;
 		ConsumerCompletionResult m_result;
-		std::unique_ptr<utils::SpinLock> m_pSpinLock; // unique_ptr to allow moving of element
+		std::atomic_bool m_isSkipped;
+		Clock::time_point m_creationTime;
 	};
 
 	/// Insertion operator for outputting \a element to \a out.
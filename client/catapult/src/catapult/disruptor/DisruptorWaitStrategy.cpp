@@ -0,0 +1,193 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DisruptorWaitStrategy.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		const std::array<std::pair<const char*, DisruptorWaitStrategy>, 4> String_To_Disruptor_Wait_Strategy_Pairs{{
+			{ "sleep", DisruptorWaitStrategy::Sleep },
+			{ "busy-spin", DisruptorWaitStrategy::Busy_Spin },
+			{ "spin-yield", DisruptorWaitStrategy::Spin_Yield },
+			{ "blocking", DisruptorWaitStrategy::Blocking }
+		}};
+
+		constexpr auto Max_Wait_Duration = std::chrono::milliseconds(10);
+		constexpr auto Num_Spin_Iterations = 1000u;
+
+		auto CalculateWaitEndTime(std::chrono::steady_clock::time_point deadline) {
+			return std::min(deadline, std::chrono::steady_clock::now() + Max_Wait_Duration);
+		}
+
+		bool Spin(const predicate<>& isReady) {
+			for (auto i = 0u; i < Num_Spin_Iterations; ++i) {
+				if (isReady())
+					return true;
+			}
+
+			return false;
+		}
+
+		// region SleepWaiter
+
+		class SleepWaiter : public DisruptorWaiter {
+		public:
+			void wait(size_t, std::chrono::steady_clock::time_point deadline, const predicate<>& isReady) override {
+				if (!isReady())
+					std::this_thread::sleep_until(CalculateWaitEndTime(deadline));
+			}
+
+			void notify(size_t) override
+			{}
+
+			void notifyAll() override
+			{}
+		};
+
+		// endregion
+
+		// region BusySpinWaiter
+
+		class BusySpinWaiter : public DisruptorWaiter {
+		public:
+			void wait(size_t, std::chrono::steady_clock::time_point, const predicate<>& isReady) override {
+				Spin(isReady);
+			}
+
+			void notify(size_t) override
+			{}
+
+			void notifyAll() override
+			{}
+		};
+
+		// endregion
+
+		// region SpinYieldWaiter
+
+		class SpinYieldWaiter : public DisruptorWaiter {
+		public:
+			void wait(size_t, std::chrono::steady_clock::time_point, const predicate<>& isReady) override {
+				if (!Spin(isReady))
+					std::this_thread::yield();
+			}
+
+			void notify(size_t) override
+			{}
+
+			void notifyAll() override
+			{}
+		};
+
+		// endregion
+
+		// region BlockingWaiter
+
+		class BlockingWaiter : public DisruptorWaiter {
+		private:
+			struct WaitSlot {
+				std::mutex Mutex;
+				std::condition_variable Condition;
+				std::atomic<size_t> NumWaiters = 0;
+			};
+
+		public:
+			explicit BlockingWaiter(size_t numLevels) : m_slots(numLevels)
+			{}
+
+		public:
+			void wait(size_t level, std::chrono::steady_clock::time_point deadline, const predicate<>& isReady) override {
+				if (isReady())
+					return;
+
+				// notify skips locking when there are no waiters, so NumWaiters must be incremented before isReady is rechecked
+				auto& slot = m_slots[level];
+				++slot.NumWaiters;
+				{
+					std::unique_lock<std::mutex> lock(slot.Mutex);
+					slot.Condition.wait_until(lock, CalculateWaitEndTime(deadline), isReady);
+				}
+
+				--slot.NumWaiters;
+			}
+
+			void notify(size_t level) override {
+				auto& slot = m_slots[level];
+				if (0 == slot.NumWaiters)
+					return;
+
+				notify(slot);
+			}
+
+			void notifyAll() override {
+				for (auto& slot : m_slots)
+					notify(slot);
+			}
+
+		private:
+			static void notify(WaitSlot& slot) {
+				// acquire the mutex to prevent a waiter from missing the notification between checking isReady and blocking
+				{
+					std::lock_guard<std::mutex> lock(slot.Mutex);
+				}
+
+				slot.Condition.notify_all();
+			}
+
+		private:
+			std::vector<WaitSlot> m_slots;
+		};
+
+		// endregion
+	}
+
+	bool TryParseValue(const std::string& strategyName, DisruptorWaitStrategy& strategy) {
+		return utils::TryParseEnumValue(String_To_Disruptor_Wait_Strategy_Pairs, strategyName, strategy);
+	}
+
+	std::unique_ptr<DisruptorWaiter> CreateDisruptorWaiter(DisruptorWaitStrategy strategy, size_t numLevels) {
+		switch (strategy) {
+		case DisruptorWaitStrategy::Sleep:
+			return std::make_unique<SleepWaiter>();
+
+		case DisruptorWaitStrategy::Busy_Spin:
+			return std::make_unique<BusySpinWaiter>();
+
+		case DisruptorWaitStrategy::Spin_Yield:
+			return std::make_unique<SpinYieldWaiter>();
+
+		case DisruptorWaitStrategy::Blocking:
+			return std::make_unique<BlockingWaiter>(numLevels);
+		}
+
+		CATAPULT_THROW_INVALID_ARGUMENT_1("cannot create waiter for unknown disruptor wait strategy", utils::to_underlying_type(strategy));
+	}
+}}
@@ -0,0 +1,68 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/functions.h"
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace catapult { namespace disruptor {
+
+	/// Strategy used by idle consumers to wait for new elements.
+	enum class DisruptorWaitStrategy {
+		/// Poll the barrier and sleep for a fixed interval when nothing is available.
+		Sleep,
+
+		/// Continuously poll the barrier.
+		/// \note This strategy has the lowest latency but keeps all consumer threads busy.
+		Busy_Spin,
+
+		/// Poll the barrier for a short while and then yield the processor.
+		Spin_Yield,
+
+		/// Block until the barrier is advanced.
+		Blocking
+	};
+
+	/// Tries to parse \a strategyName into a disruptor wait \a strategy.
+	bool TryParseValue(const std::string& strategyName, DisruptorWaitStrategy& strategy);
+
+	/// Waits for disruptor barriers to advance.
+	class DisruptorWaiter {
+	public:
+		virtual ~DisruptorWaiter() = default;
+
+	public:
+		/// Waits until \a isReady returns \c true after the barrier at \a level is advanced or \a deadline passes.
+		/// \note Implementations are allowed to return early, so callers are expected to recheck their state.
+		virtual void wait(size_t level, std::chrono::steady_clock::time_point deadline, const predicate<>& isReady) = 0;
+
+		/// Notifies waiters that the barrier at \a level was advanced.
+		virtual void notify(size_t level) = 0;
+
+		/// Notifies all waiters.
+		virtual void notifyAll() = 0;
+	};
+
+	/// Creates a waiter for \a numLevels barriers using \a strategy.
+	std::unique_ptr<DisruptorWaiter> CreateDisruptorWaiter(DisruptorWaitStrategy strategy, size_t numLevels);
+}}
@@ -55,6 +55,38 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	void AddDispatcherStatisticsCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			size_t numConsumers) {
+		using disruptor::ConsumerDispatcher;
+
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " LAT MED", [](const auto& dispatcher) {
+			return dispatcher.elementLatencies().percentile(50);
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " LAT HIGH", [](const auto& dispatcher) {
+			return dispatcher.elementLatencies().percentile(99);
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " LAT MAX", [](const auto& dispatcher) {
+			return dispatcher.elementLatencies().max();
+		});
+
+		// counter names can only contain letters, so consumers are identified by letters starting with 'A'
+		if (numConsumers > 26)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("too many consumers for dispatcher statistics counters", numConsumers);
+
+		for (auto level = 0u; level < numConsumers; ++level) {
+			auto stagePrefix = counterPrefix + " " + static_cast<char>('A' + level);
+			locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, stagePrefix + " DEPTH", [level](const auto& dispatcher) {
+				return dispatcher.queueDepth(level);
+			});
+			locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, stagePrefix + " LAT", [level](const auto& dispatcher) {
+				return dispatcher.stageLatencies(level).percentile(99);
+			});
+		}
+	}
+
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
 		return thread::CreateNamedTask("batch " + name + " task", [&dispatcher]() {
 			dispatcher.dispatch();
@@ -42,6 +42,16 @@ namespace catapult { namespace extensions {
 	/// Adds dispatcher counters with prefix \a counterPrefix to \a locator for a dispatcher named \a dispatcherName.
 	void AddDispatcherCounters(ServiceLocator& locator, const std::string& dispatcherName, const std::string& counterPrefix);
 
+	/// Adds dispatcher latency and queue depth counters with prefix \a counterPrefix to \a locator for a dispatcher named
+	/// \a dispatcherName composed of \a numConsumers consumers.
+	/// \note Latencies are reported in microseconds (median, 99th percentile and max for elements; 99th percentile for consumers).
+	///       Consumers are identified by letters ('A' for the first consumer).
+	void AddDispatcherStatisticsCounters(
+			ServiceLocator& locator,
+			const std::string& dispatcherName,
+			const std::string& counterPrefix,
+			size_t numConsumers);
+
 	/// Transaction batch range dispatcher.
 	using TransactionBatchRangeDispatcher = disruptor::BatchRangeDispatcher<model::AnnotatedTransactionRange>;
 
@@ -21,6 +21,7 @@
 
 #include "NetworkUtils.h"
 #include "Results.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "catapult/ionet/ReadRateMonitorSocketDecorator.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
@@ -40,9 +41,25 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region CreateSocketWorkingBufferPool
+
+	std::shared_ptr<ionet::PacketBufferPool> CreateSocketWorkingBufferPool(const config::NodeConfiguration& config) {
+		if (0 == config.SocketWorkingBufferPoolSize.bytes())
+			return nullptr;
+
+		// largest working buffer holds a partially received max size packet and one additional read
+		auto minBufferSize = config.SocketWorkingBufferSize.bytes();
+		auto maxBufferSize = config.MaxPacketDataSize.bytes() + minBufferSize;
+		return std::make_shared<ionet::PacketBufferPool>(minBufferSize, maxBufferSize, config.SocketWorkingBufferPoolSize);
+	}
+
+	// endregion
+
 	// region GetConnectionSettings / UpdateAsyncTcpServerSettings
 
-	net::ConnectionSettings GetConnectionSettings(const config::CatapultConfiguration& config) {
+	net::ConnectionSettings GetConnectionSettings(
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool) {
 		net::ConnectionSettings settings;
 		settings.NetworkIdentifier = config.Blockchain.Network.Identifier;
 		settings.NodeIdentityEqualityStrategy = config.Blockchain.Network.NodeEqualityStrategy;
@@ -50,6 +67,7 @@ namespace catapult { namespace extensions {
 		settings.Timeout = config.Node.ConnectTimeout;
 		settings.SocketWorkingBufferSize = config.Node.SocketWorkingBufferSize;
 		settings.SocketWorkingBufferSensitivity = config.Node.SocketWorkingBufferSensitivity;
+		settings.SocketWorkingBufferPool = pBufferPool;
 		settings.MaxPacketDataSize = config.Node.MaxPacketDataSize;
 		settings.OutgoingProtocols = ionet::MapNodeRolesToIpProtocols(config.Node.Local.Roles);
 
@@ -58,8 +76,11 @@ namespace catapult { namespace extensions {
 		return settings;
 	}
 
-	void UpdateAsyncTcpServerSettings(net::AsyncTcpServerSettings& settings, const config::CatapultConfiguration& config) {
-		settings.PacketSocketOptions = GetConnectionSettings(config).toSocketOptions();
+	void UpdateAsyncTcpServerSettings(
+			net::AsyncTcpServerSettings& settings,
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool) {
+		settings.PacketSocketOptions = GetConnectionSettings(config, pBufferPool).toSocketOptions();
 		settings.AllowAddressReuse = config.Node.EnableAddressReuse;
 
 		const auto& connectionsConfig = config.Node.IncomingConnections;
@@ -98,6 +119,7 @@ namespace catapult { namespace extensions {
 			unsigned short port,
 			ionet::ServiceIdentifier serviceId,
 			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool,
 			const supplier<Timestamp>& timeSupplier,
 			subscribers::NodeSubscriber& nodeSubscriber,
 			net::AcceptedConnectionContainer& acceptor) {
@@ -138,7 +160,7 @@ namespace catapult { namespace extensions {
 			});
 		});
 
-		UpdateAsyncTcpServerSettings(serverSettings, config);
+		UpdateAsyncTcpServerSettings(serverSettings, config, pBufferPool);
 		return serviceGroup.pushService(net::CreateAsyncTcpServer, endpoint, serverSettings);
 	}
 
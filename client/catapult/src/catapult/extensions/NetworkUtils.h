@@ -37,19 +37,30 @@ namespace catapult { namespace extensions {
 	/// Gets the rate monitor settings from \a banConfig.
 	ionet::RateMonitorSettings GetRateMonitorSettings(const config::NodeConfiguration::BanningSubConfiguration& banConfig);
 
-	/// Extracts connection settings from \a config.
-	net::ConnectionSettings GetConnectionSettings(const config::CatapultConfiguration& config);
+	/// Creates a socket working buffer pool sized according to \a config.
+	/// \note \c nullptr is returned when socket working buffer pooling is disabled.
+	std::shared_ptr<ionet::PacketBufferPool> CreateSocketWorkingBufferPool(const config::NodeConfiguration& config);
 
-	/// Updates \a settings with values in \a config.
-	void UpdateAsyncTcpServerSettings(net::AsyncTcpServerSettings& settings, const config::CatapultConfiguration& config);
+	/// Extracts connection settings from \a config using \a pBufferPool for socket working buffers.
+	net::ConnectionSettings GetConnectionSettings(
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool);
+
+	/// Updates \a settings with values in \a config using \a pBufferPool for socket working buffers.
+	void UpdateAsyncTcpServerSettings(
+			net::AsyncTcpServerSettings& settings,
+			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool);
 
 	/// Boots a tcp server with \a serviceGroup on localhost \a port with connection \a config and \a acceptor given \a timeSupplier.
 	/// Incoming connections are assumed to be associated with \a serviceId and are added to \a nodeSubscriber.
+	/// Socket working buffers are allocated from \a pBufferPool.
 	std::shared_ptr<net::AsyncTcpServer> BootServer(
 			thread::MultiServicePool::ServiceGroup& serviceGroup,
 			unsigned short port,
 			ionet::ServiceIdentifier serviceId,
 			const config::CatapultConfiguration& config,
+			const std::shared_ptr<ionet::PacketBufferPool>& pBufferPool,
 			const supplier<Timestamp>& timeSupplier,
 			subscribers::NodeSubscriber& nodeSubscriber,
 			net::AcceptedConnectionContainer& acceptor);
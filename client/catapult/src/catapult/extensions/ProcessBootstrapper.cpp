@@ -56,6 +56,9 @@ namespace catapult { namespace extensions {
 			ForceSymbolInjection<model::EmbeddedTransactionPlugin>();
 			ForceSymbolInjection<net::PacketIoPicker>();
 #endif
+
+			if (m_config.Node.EnableNotificationProfiling)
+				m_pluginManager.enableNotificationProfiling();
 	}
 
 	const config::CatapultConfiguration& ProcessBootstrapper::config() const {
@@ -39,7 +39,10 @@ namespace catapult {
 		struct SelectorSettings;
 	}
 	namespace io { class BlockStorageCache; }
-	namespace ionet { class NodeContainer; }
+	namespace ionet {
+		class NodeContainer;
+		class PacketBufferPool;
+	}
 	namespace plugins { class PluginManager; }
 	namespace subscribers {
 		class FinalizationSubscriber;
@@ -60,7 +63,7 @@ namespace catapult { namespace extensions {
 	public:
 		/// Creates service state around \a config, \a nodes, \a cache, \a storage, \a score, \a utCache, \a timeSupplier
 		/// \a finalizationSubscriber, \a nodeSubscriber, \a stateChangeSubscriber, \a transactionStatusSubscriber,
-		/// \a counters, \a pluginManager and \a pool.
+		/// \a counters, \a pluginManager, \a pool and \a pSocketWorkingBufferPool.
 		ServiceState(
 				const config::CatapultConfiguration& config,
 				ionet::NodeContainer& nodes,
@@ -75,7 +78,8 @@ namespace catapult { namespace extensions {
 				subscribers::TransactionStatusSubscriber& transactionStatusSubscriber,
 				const std::vector<utils::DiagnosticCounter>& counters,
 				const plugins::PluginManager& pluginManager,
-				thread::MultiServicePool& pool)
+				thread::MultiServicePool& pool,
+				const std::shared_ptr<ionet::PacketBufferPool>& pSocketWorkingBufferPool)
 				: m_config(config)
 				, m_nodes(nodes)
 				, m_cache(cache)
@@ -97,6 +101,7 @@ namespace catapult { namespace extensions {
 				, m_counters(counters)
 				, m_pluginManager(pluginManager)
 				, m_pool(pool)
+				, m_pSocketWorkingBufferPool(pSocketWorkingBufferPool)
 				, m_packetHandlers(m_config.Node.MaxPacketDataSize.bytes32())
 		{}
 
@@ -177,6 +182,11 @@ namespace catapult { namespace extensions {
 			return m_pool;
 		}
 
+		/// Gets the socket working buffer pool (optional).
+		const auto& socketWorkingBufferPool() const {
+			return m_pSocketWorkingBufferPool;
+		}
+
 		/// Gets the tasks.
 		auto& tasks() {
 			return m_tasks;
@@ -221,6 +231,7 @@ namespace catapult { namespace extensions {
 		const std::vector<utils::DiagnosticCounter>& m_counters;
 		const plugins::PluginManager& m_pluginManager;
 		thread::MultiServicePool& m_pool;
+		std::shared_ptr<ionet::PacketBufferPool> m_pSocketWorkingBufferPool;
 
 		// owned
 		std::vector<thread::Task> m_tasks;
@@ -115,5 +115,20 @@ namespace catapult { namespace io {
 		return pBlockElement;
 	}
 
+	std::shared_ptr<model::BlockElement> ReadBlockElementMetadata(
+			const std::shared_ptr<const model::Block>& pBlock,
+			InputStream& inputStream) {
+		// allocate the block element together with a block reference so that the block outlives the block element
+		using BlockElementWithBlock = std::pair<std::shared_ptr<const model::Block>, model::BlockElement>;
+		auto pBlockElementWithBlock = std::make_shared<BlockElementWithBlock>(pBlock, model::BlockElement(*pBlock));
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pBlockElementWithBlock, &pBlockElementWithBlock->second);
+
+		inputStream.read(pBlockElement->EntityHash);
+		inputStream.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(inputStream, *pBlockElement);
+		ReadSubCacheMerkleRoots(inputStream, pBlockElement->SubCacheMerkleRoots);
+		return pBlockElement;
+	}
+
 	// endregion
 }}
@@ -38,4 +38,10 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element metadata from \a inputStream into an allocated block element that references (but does not copy) \a pBlock.
+	/// \note Returned block element extends the lifetime of \a pBlock.
+	std::shared_ptr<model::BlockElement> ReadBlockElementMetadata(
+			const std::shared_ptr<const model::Block>& pBlock,
+			InputStream& inputStream);
 }}
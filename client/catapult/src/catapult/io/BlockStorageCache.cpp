@@ -22,35 +22,112 @@
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MemoryUtils.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
 	namespace {
+		using BlockStatementData = std::pair<std::vector<uint8_t>, bool>;
+
 		std::shared_ptr<const model::Block> BlockElementAsSharedBlock(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
 			return std::shared_ptr<const model::Block>(&pBlockElement->Block, [pBlockElement](const auto*) {});
 		}
+
+		uint64_t GetBlockElementSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256::Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement);
+		}
+
+		uint64_t GetBlockStatementDataSize(const BlockStatementData& blockStatementData) {
+			return sizeof(BlockStatementData) + blockStatementData.first.size();
+		}
 	}
 
 	// region CachedData
 
 	struct CachedData {
+	private:
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			std::shared_ptr<const BlockStatementData> pBlockStatementData;
+			uint64_t Size = 0;
+			std::list<Height>::iterator LruIter;
+		};
+
+		using EntryMap = std::unordered_map<Height, Entry, utils::BaseValueHasher<Height>>;
+
+	public:
+		explicit CachedData(utils::FileSize maxSize)
+				: m_maxSize(maxSize.bytes())
+				, m_size(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
 		}
 
-		std::shared_ptr<const model::Block> block(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		bool isEnabled() const {
+			return 0 != m_maxSize;
 		}
 
-		std::shared_ptr<const model::BlockElement> blockElement(Height) const {
-			return m_pBlockElement;
+		BlockStorageCacheStatistics statistics() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return { m_numHits, m_numMisses, utils::FileSize::FromBytes(m_size) };
 		}
 
 	public:
-		bool contains(Height height) const {
-			return height == m_pBlockElement->Block.Height;
+		std::shared_ptr<const model::BlockElement> tryGetBlockElement(Height height) const {
+			// the chain tip is always cached
+			if (m_pBlockElement && height == m_pBlockElement->Block.Height) {
+				++m_numHits;
+				return m_pBlockElement;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto* pEntry = tryFind(height);
+			return recordLookup(pEntry ? pEntry->pBlockElement : nullptr);
+		}
+
+		std::shared_ptr<const BlockStatementData> tryGetBlockStatementData(Height height) const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto* pEntry = tryFind(height);
+			return recordLookup(pEntry ? pEntry->pBlockStatementData : nullptr);
+		}
+
+		void add(const std::shared_ptr<const model::BlockElement>& pBlockElement) const {
+			if (!isEnabled())
+				return;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto& entry = findOrCreate(pBlockElement->Block.Height);
+			if (entry.pBlockElement)
+				return;
+
+			entry.pBlockElement = pBlockElement;
+			grow(entry, GetBlockElementSize(*pBlockElement));
+		}
+
+		void add(Height height, const BlockStatementData& blockStatementData) const {
+			if (!isEnabled())
+				return;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto& entry = findOrCreate(height);
+			if (entry.pBlockStatementData)
+				return;
+
+			entry.pBlockStatementData = std::make_shared<const BlockStatementData>(blockStatementData);
+			grow(entry, GetBlockStatementDataSize(blockStatementData));
 		}
 
 	public:
@@ -62,8 +139,73 @@ namespace catapult { namespace io {
 			m_pBlockElement.reset();
 		}
 
+		void invalidateAfter(Height height) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (auto iter = m_entries.begin(); m_entries.end() != iter;) {
+				if (iter->first > height)
+					iter = remove(iter);
+				else
+					++iter;
+			}
+		}
+
+	private:
+		template<typename T>
+		std::shared_ptr<const T> recordLookup(const std::shared_ptr<const T>& pValue) const {
+			if (pValue)
+				++m_numHits;
+			else
+				++m_numMisses;
+
+			return pValue;
+		}
+
+		Entry* tryFind(Height height) const {
+			auto iter = m_entries.find(height);
+			if (m_entries.end() == iter)
+				return nullptr;
+
+			// mark entry as most recently used
+			m_lru.splice(m_lru.begin(), m_lru, iter->second.LruIter);
+			return &iter->second;
+		}
+
+		Entry& findOrCreate(Height height) const {
+			auto* pEntry = tryFind(height);
+			if (pEntry)
+				return *pEntry;
+
+			auto& entry = m_entries[height];
+			entry.LruIter = m_lru.insert(m_lru.begin(), height);
+			return entry;
+		}
+
+		void grow(Entry& entry, uint64_t size) const {
+			entry.Size += size;
+			m_size += size;
+
+			// evict least recently used entries until the cache fits
+			while (m_size > m_maxSize && !m_lru.empty())
+				remove(m_entries.find(m_lru.back()));
+		}
+
+		EntryMap::iterator remove(EntryMap::iterator iter) const {
+			m_size -= iter->second.Size;
+			m_lru.erase(iter->second.LruIter);
+			return m_entries.erase(iter);
+		}
+
 	private:
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		// recently loaded data is updated by (concurrent) readers, so it is guarded by a separate lock
+		uint64_t m_maxSize;
+		mutable std::mutex m_mutex;
+		mutable EntryMap m_entries;
+		mutable std::list<Height> m_lru;
+		mutable uint64_t m_size;
+		mutable std::atomic<uint64_t> m_numHits;
+		mutable std::atomic<uint64_t> m_numMisses;
 	};
 
 	// endregion
@@ -89,23 +231,39 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
 		requireHeight(height, "block");
-		if (m_cachedData.contains(height))
-			return m_cachedData.block(height);
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return BlockElementAsSharedBlock(pBlockElement);
+
+		// when caching is disabled, there is no reason to load the full block element
+		if (!m_cachedData.isEnabled())
+			return m_storage.loadBlock(height);
 
-		return m_storage.loadBlock(height);
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.add(pBlockElement);
+		return BlockElementAsSharedBlock(pBlockElement);
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
-		if (m_cachedData.contains(height))
-			return m_cachedData.blockElement(height);
+		auto pBlockElement = m_cachedData.tryGetBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.add(pBlockElement);
+		return pBlockElement;
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
-		return m_storage.loadBlockStatementData(height);
+		auto pBlockStatementData = m_cachedData.tryGetBlockStatementData(height);
+		if (pBlockStatementData)
+			return *pBlockStatementData;
+
+		auto blockStatementData = m_storage.loadBlockStatementData(height);
+		m_cachedData.add(height, blockStatementData);
+		return blockStatementData;
 	}
 
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
@@ -152,7 +310,9 @@ namespace catapult { namespace io {
 		// 1. apply staging changes to permananent storage
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
-		// 2. update cache
+		// 2. update cache (dropped blocks might have been replaced, so cached data after the save start height is stale)
+		m_cachedData.invalidateAfter(m_saveStartHeight);
+
 		auto newChainHeight = m_storage.chainHeight();
 		if (newChainHeight > Height(0))
 			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
@@ -165,9 +325,16 @@ namespace catapult { namespace io {
 	// region BlockStorageCache
 
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+			: BlockStorageCache(std::move(pStorage), std::move(pStagingStorage), utils::FileSize())
+	{}
+
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize)) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -183,5 +350,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
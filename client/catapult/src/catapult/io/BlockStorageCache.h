@@ -21,6 +21,7 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
@@ -92,13 +93,33 @@ namespace catapult { namespace io {
 		Height m_saveStartHeight;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block and block statement loads that were served from memory.
+		uint64_t NumHits;
+
+		/// Number of block and block statement loads that were served from storage.
+		uint64_t NumMisses;
+
+		/// Total (estimated) size of cached blocks and block statements.
+		utils::FileSize Size;
+	};
+
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note In addition to synchronization and support for two-phase commit, this cache keeps recently loaded blocks
+	///       and block statements in memory up to a maximum size.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
 		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
 
+		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit
+		/// and keeps at most \a maxCacheSize bytes of recently loaded blocks and block statements in memory.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				utils::FileSize maxCacheSize);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -109,6 +130,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
@@ -22,6 +22,7 @@
 #include "FileBlockStorage.h"
 #include "BlockElementSerializer.h"
 #include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "BufferedFileStream.h"
 #include "FilesystemUtils.h"
 #include "PodIoUtils.h"
@@ -33,9 +34,14 @@ namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			FileBlockStorageReadMode readMode)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
+			, m_readMode(readMode)
 			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
 			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
 			, m_hashFile(dataDirectory, "hashes")
@@ -108,16 +114,41 @@ namespace catapult { namespace io {
 			blockStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::Block> GetMappedBlock(const FileDatabase::PayloadView& payloadView, Height height) {
+			const auto* pBlock = reinterpret_cast<const model::Block*>(payloadView.pData.get());
+			if (payloadView.Size < sizeof(uint32_t) || payloadView.Size < pBlock->Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("mapped block is truncated at height", height);
+
+			return std::shared_ptr<const model::Block>(payloadView.pData, pBlock);
+		}
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode)
+			return GetMappedBlock(m_blockDatabase.payloadView(height.unwrap()), height);
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto payloadView = m_blockDatabase.payloadView(height.unwrap());
+			auto pBlock = GetMappedBlock(payloadView, height);
+
+			auto metadataBuffer = RawBuffer(payloadView.pData.get() + pBlock->Size, payloadView.Size - pBlock->Size);
+			BufferInputStreamAdapter<RawBuffer> metadataStream(metadataBuffer);
+			auto pBlockElement = ReadBlockElementMetadata(pBlock, metadataStream);
+
+			if (!metadataStream.eof())
+				CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+			return PORTABLE_MOVE(pBlockElement);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
@@ -133,6 +164,11 @@ namespace catapult { namespace io {
 		if (!m_statementDatabase.contains(height.unwrap()))
 			return std::make_pair(std::vector<uint8_t>(), false);
 
+		if (FileBlockStorageReadMode::Memory_Mapped == m_readMode) {
+			auto payloadView = m_statementDatabase.payloadView(height.unwrap());
+			return std::make_pair(std::vector<uint8_t>(payloadView.pData.get(), payloadView.pData.get() + payloadView.Size), true);
+		}
+
 		size_t streamSize = 0;
 		auto pBlockStatementStream = m_statementDatabase.inputStream(height.unwrap(), &streamSize);
 
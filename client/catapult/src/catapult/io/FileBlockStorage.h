@@ -38,15 +38,26 @@ namespace catapult { namespace io {
 		None
 	};
 
+	/// File block storage read modes.
+	enum class FileBlockStorageReadMode {
+		/// Blocks and block statements are copied from file streams.
+		Stream,
+
+		/// Blocks are views into memory mapped files.
+		/// \note Block statements are copied from memory mapped files.
+		Memory_Mapped
+	};
+
 	/// File-based block storage.
 	class FileBlockStorage final : public PrunableBlockStorage {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
-		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode and \a readMode.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				FileBlockStorageReadMode readMode = FileBlockStorageReadMode::Stream);
 
 	public:
 		// LightBlockStorage
@@ -69,6 +80,7 @@ namespace catapult { namespace io {
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		FileBlockStorageReadMode m_readMode;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
@@ -21,6 +21,7 @@
 
 #include "FileDatabase.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
 #include "PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
@@ -67,11 +68,14 @@ namespace catapult { namespace io {
 
 	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
 			: m_directory(directory)
-			, m_options(options) {
+			, m_options(options)
+			, m_hasMappings(false) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
 	}
 
+	FileDatabase::~FileDatabase() = default;
+
 	bool FileDatabase::contains(uint64_t id) const {
 		auto filePath = getFilePath(id, false);
 		if (!std::filesystem::exists(filePath))
@@ -125,9 +129,63 @@ namespace catapult { namespace io {
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
+	FileDatabase::PayloadView FileDatabase::payloadView(uint64_t id) const {
+		auto filePath = getFilePath(id, false);
+		if (!std::filesystem::exists(filePath)) {
+			std::ostringstream out;
+			out << "cannot map payload at " << id << " because file does not exist";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		if (bypassHeader()) {
+			auto pMappedFile = mapFile(filePath, std::filesystem::file_size(filePath));
+			return { std::shared_ptr<const uint8_t>(pMappedFile, pMappedFile->data()), pMappedFile->size() };
+		}
+
+		// read offsets from the (shared) mapping, which reflects all header updates made after it was created
+		auto headerSize = m_options.BatchSize * sizeof(uint64_t);
+		auto pMappedFile = mapFile(filePath, headerSize);
+		if (pMappedFile->size() < headerSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("cannot map payload from file with truncated header", filePath);
+
+		auto pHeader = reinterpret_cast<const uint64_t*>(pMappedFile->data());
+		auto headerIndex = id % m_options.BatchSize;
+		auto bodyStartOffset = pHeader[headerIndex];
+		if (0 == bodyStartOffset) {
+			std::ostringstream out;
+			out << "cannot map payload at " << id << " that has not been written";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != headerIndex)
+			bodyEndOffset = pHeader[headerIndex + 1];
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = std::filesystem::file_size(filePath);
+
+		// remap when payload was written after the file was mapped
+		if (bodyEndOffset > pMappedFile->size())
+			pMappedFile = mapFile(filePath, bodyEndOffset);
+
+		if (bodyStartOffset > bodyEndOffset || bodyEndOffset > pMappedFile->size()) {
+			std::ostringstream out;
+			out << "cannot map payload at " << id << " with invalid bounds [" << bodyStartOffset << ", " << bodyEndOffset << ")";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		auto pPayloadData = std::shared_ptr<const uint8_t>(pMappedFile, pMappedFile->data() + bodyStartOffset);
+		return { pPayloadData, static_cast<size_t>(bodyEndOffset - bodyStartOffset) };
+	}
+
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
 		auto filePath = getFilePath(id, true);
 
+		// truncating a mapped file makes the truncated pages of all its mappings inaccessible, so, once payloads have been mapped,
+		// files are replaced instead of truncated (the original file is kept alive by its mappings until they are released)
+		if (m_hasMappings && contains(id))
+			detachFile(filePath);
+
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
 
@@ -164,6 +222,37 @@ namespace catapult { namespace io {
 		return std::make_unique<FileStream>(std::move(rawFile));
 	}
 
+	std::shared_ptr<const MemoryMappedFile> FileDatabase::mapFile(const std::string& filePath, uint64_t minSize) const {
+		std::lock_guard<std::mutex> lock(m_mappingMutex);
+
+		// remap when the file has grown since it was last mapped
+		if (filePath != m_mappedFilePath || !m_pMappedFile || m_pMappedFile->size() < minSize) {
+			m_pMappedFile = std::make_shared<MemoryMappedFile>(filePath);
+			m_mappedFilePath = filePath;
+			m_hasMappings = true;
+		}
+
+		return m_pMappedFile;
+	}
+
+	void FileDatabase::detachFile(const std::string& filePath) {
+		{
+			std::lock_guard<std::mutex> lock(m_mappingMutex);
+			if (filePath == m_mappedFilePath)
+				m_pMappedFile.reset();
+		}
+
+		// when header is bypassed, the file is completely rewritten, so there is nothing to preserve
+		if (bypassHeader()) {
+			std::filesystem::remove(filePath);
+			return;
+		}
+
+		auto tempFilePath = filePath + ".tmp";
+		std::filesystem::copy_file(filePath, tempFilePath, std::filesystem::copy_options::overwrite_existing);
+		std::filesystem::rename(tempFilePath, filePath);
+	}
+
 	bool FileDatabase::bypassHeader() const {
 		// skip header when batch size is one to preserve old behavior
 		return 1 == m_options.BatchSize;
@@ -22,6 +22,10 @@
 #pragma once
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include <atomic>
+#include <mutex>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
 
 namespace catapult { namespace io {
 
@@ -37,10 +41,23 @@ namespace catapult { namespace io {
 			std::string FileExtension;
 		};
 
+		/// Read-only view of a payload.
+		struct PayloadView {
+			/// Payload data.
+			/// \note This pointer keeps the underlying memory mapping alive.
+			std::shared_ptr<const uint8_t> pData;
+
+			/// Payload size.
+			size_t Size;
+		};
+
 	public:
 		/// Creates a database in \a directory with \a options.
 		FileDatabase(const config::CatapultDirectory& directory, const Options& options);
 
+		/// Destroys the database.
+		~FileDatabase();
+
 	public:
 		/// Returns \c true if a payload for \a id is contained.
 		bool contains(uint64_t id) const;
@@ -48,6 +65,11 @@ namespace catapult { namespace io {
 		/// Gets an input stream for \a id and optionally returns the stream size (\a pSize).
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
+		/// Gets a read-only view of the payload for \a id that is backed by a memory mapping of the containing file.
+		/// \note Views of payloads in the same file share a single mapping. Once a view has been created, files are
+		///       replaced instead of truncated when payloads are overwritten, so outstanding views are never invalidated.
+		PayloadView payloadView(uint64_t id) const;
+
 		/// Gets an output stream for \a id.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
@@ -56,8 +78,17 @@ namespace catapult { namespace io {
 		uint64_t getHeaderOffset(uint64_t id) const;
 		std::string getFilePath(uint64_t id, bool createDirectories) const;
 
+		std::shared_ptr<const MemoryMappedFile> mapFile(const std::string& filePath, uint64_t minSize) const;
+		void detachFile(const std::string& filePath);
+
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+
+		// most recently used mapping, which is reused across consecutive payload reads from the same file
+		mutable std::atomic<bool> m_hasMappings;
+		mutable std::mutex m_mappingMutex;
+		mutable std::string m_mappedFilePath;
+		mutable std::shared_ptr<const MemoryMappedFile> m_pMappedFile;
 	};
 }}
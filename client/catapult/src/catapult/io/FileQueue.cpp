@@ -20,10 +20,13 @@
 **/
 
 #include "FileQueue.h"
+#include "PodIoUtils.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <filesystem>
+#include <optional>
 #include <sstream>
 
 namespace catapult { namespace io {
@@ -42,11 +45,64 @@ namespace catapult { namespace io {
 			return true;
 		}
 
-		std::string GetFilename(uint64_t value) {
+		constexpr auto Message_File_Extension = ".dat";
+		constexpr auto Segment_Data_File_Extension = ".log";
+		constexpr auto Segment_Offsets_File_Extension = ".idx";
+
+		std::string GetFilename(uint64_t value, const char* extension) {
 			std::ostringstream out;
-			out << utils::HexFormat(value) << ".dat";
+			out << utils::HexFormat(value) << extension;
 			return out.str();
 		}
+
+		std::string GetSegmentFilename(const std::filesystem::path& directory, uint64_t segmentId, const char* extension) {
+			return (directory / GetFilename(segmentId, extension)).generic_string();
+		}
+
+		// region segment utils
+
+		// segments are identified by the index values of their first messages
+		std::vector<uint64_t> FindSegmentIds(const std::filesystem::path& directory) {
+			std::vector<uint64_t> segmentIds;
+			for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+				const auto& path = entry.path();
+				auto stem = path.stem().generic_string();
+				if (Segment_Offsets_File_Extension != path.extension() || 2 * sizeof(uint64_t) != stem.size())
+					continue;
+
+				char* pEnd;
+				auto segmentId = std::strtoull(stem.c_str(), &pEnd, 16);
+				if (stem.c_str() + stem.size() == pEnd)
+					segmentIds.push_back(segmentId);
+			}
+
+			std::sort(segmentIds.begin(), segmentIds.end());
+			return segmentIds;
+		}
+
+		void RemoveSegment(const std::filesystem::path& directory, uint64_t segmentId) {
+			std::filesystem::remove(GetSegmentFilename(directory, segmentId, Segment_Data_File_Extension));
+			std::filesystem::remove(GetSegmentFilename(directory, segmentId, Segment_Offsets_File_Extension));
+		}
+
+		RawFile OpenSegmentFile(const std::filesystem::path& directory, uint64_t segmentId, const char* extension, OpenMode mode) {
+			return RawFile(GetSegmentFilename(directory, segmentId, extension), mode, LockMode::None);
+		}
+
+		uint64_t CountSegmentMessages(const RawFile& offsetsFile) {
+			return offsetsFile.size() / sizeof(uint64_t);
+		}
+
+		// offsets file contains the (exclusive) end offset of each message in the segment data file
+		uint64_t ReadSegmentOffset(RawFile& offsetsFile, uint64_t numMessages) {
+			if (0 == numMessages)
+				return 0;
+
+			offsetsFile.seek((numMessages - 1) * sizeof(uint64_t));
+			return Read64(offsetsFile);
+		}
+
+		// endregion
 	}
 
 	// region FileQueueWriter
@@ -55,30 +111,101 @@ namespace catapult { namespace io {
 	{}
 
 	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename)
+			: FileQueueWriter(directory, indexFilename, utils::FileSize())
+	{}
+
+	FileQueueWriter::FileQueueWriter(const std::string& directory, const std::string& indexFilename, utils::FileSize maxSegmentSize)
 			: m_directory(CreateDirectory(directory))
 			, m_indexFile((m_directory / indexFilename).generic_string(), LockMode::None)
 			, m_indexValue(CreateIfNotExists(m_indexFile) ? 0 : m_indexFile.get())
-	{}
+			, m_maxSegmentSize(maxSegmentSize.bytes())
+			, m_hasPendingMessage(false)
+			, m_segmentSize(0) {
+		if (0 == m_maxSegmentSize)
+			return;
+
+		// discard all segments (and segment data) written after the last committed message
+		std::optional<uint64_t> lastSegmentId;
+		for (auto segmentId : FindSegmentIds(m_directory)) {
+			if (segmentId > m_indexValue)
+				RemoveSegment(m_directory, segmentId);
+			else
+				lastSegmentId = segmentId;
+		}
+
+		// continue appending to last segment unless it has been followed by messages stored in separate files
+		if (!lastSegmentId)
+			return;
+
+		auto numSegmentMessages = CountSegmentMessages(
+				OpenSegmentFile(m_directory, *lastSegmentId, Segment_Offsets_File_Extension, OpenMode::Read_Only));
+		if (numSegmentMessages < m_indexValue - *lastSegmentId)
+			return;
+
+		openSegment(*lastSegmentId, m_indexValue - *lastSegmentId);
+		if (m_segmentSize >= m_maxSegmentSize)
+			closeSegment();
+	}
 
 	void FileQueueWriter::write(const RawBuffer& buffer) {
 		if (!m_pOutputStream) {
-			auto filename = (m_directory / GetFilename(m_indexValue)).generic_string();
-			RawFile outputFile(filename, OpenMode::Read_Write);
-			m_pOutputStream = std::make_unique<BufferedOutputFileStream>(std::move(outputFile));
+			if (0 == m_maxSegmentSize) {
+				auto filename = (m_directory / GetFilename(m_indexValue, Message_File_Extension)).generic_string();
+				RawFile outputFile(filename, OpenMode::Read_Write);
+				m_pOutputStream = std::make_unique<BufferedOutputFileStream>(std::move(outputFile));
+			} else {
+				openSegment(m_indexValue, 0);
+			}
 		}
 
 		m_pOutputStream->write(buffer);
+		m_hasPendingMessage = true;
+		m_segmentSize += buffer.Size;
 	}
 
 	void FileQueueWriter::flush() {
-		if (!m_pOutputStream)
+		if (!m_hasPendingMessage)
 			return;
 
 		m_pOutputStream->flush();
-		m_pOutputStream.reset();
+		if (0 == m_maxSegmentSize) {
+			m_pOutputStream.reset();
+		} else {
+			// message is only visible to readers after its end offset is written
+			Write64(*m_pSegmentOffsetsFile, m_segmentSize);
+			if (m_segmentSize >= m_maxSegmentSize)
+				closeSegment();
+		}
+
+		m_hasPendingMessage = false;
 		m_indexValue = m_indexFile.increment();
 	}
 
+	void FileQueueWriter::openSegment(uint64_t segmentId, uint64_t numMessages) {
+		// truncate any (uncommitted) data following the first numMessages messages
+		auto offsetsFile = OpenSegmentFile(m_directory, segmentId, Segment_Offsets_File_Extension, OpenMode::Read_Append);
+		auto segmentSize = ReadSegmentOffset(offsetsFile, numMessages);
+		offsetsFile.seek(numMessages * sizeof(uint64_t));
+		offsetsFile.truncate();
+
+		auto dataFile = OpenSegmentFile(m_directory, segmentId, Segment_Data_File_Extension, OpenMode::Read_Append);
+		if (dataFile.size() < segmentSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("file queue segment data file is truncated", segmentId);
+
+		dataFile.seek(segmentSize);
+		dataFile.truncate();
+
+		m_segmentSize = segmentSize;
+		m_pSegmentOffsetsFile = std::make_unique<RawFile>(std::move(offsetsFile));
+		m_pOutputStream = std::make_unique<BufferedOutputFileStream>(std::move(dataFile));
+	}
+
+	void FileQueueWriter::closeSegment() {
+		m_pOutputStream.reset();
+		m_pSegmentOffsetsFile.reset();
+		m_segmentSize = 0;
+	}
+
 	// endregion
 
 	// region FileQueueReader
@@ -101,7 +228,9 @@ namespace catapult { namespace io {
 			const std::string& writerIndexFilename)
 			: m_directory(CreateDirectory(directory))
 			, m_readerIndexFile((m_directory / readerIndexFilename).generic_string())
-			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None) {
+			, m_writerIndexFile((m_directory / writerIndexFilename).generic_string(), LockMode::None)
+			, m_segmentId(0)
+			, m_numSegmentMessages(0) {
 		CreateIfNotExists(m_readerIndexFile);
 	}
 
@@ -119,36 +248,93 @@ namespace catapult { namespace io {
 	}
 
 	bool FileQueueReader::tryReadNextMessageConditional(const predicate<const std::vector<uint8_t>&>& predicate) {
-		return process([predicate](const auto& nextMessageFilename) {
-			auto buffer = ReadAllContents(nextMessageFilename);
-			return predicate(buffer);
-		});
+		return process(predicate);
 	}
 
 	void FileQueueReader::skip(uint32_t count) {
-		for (auto i = 0u; i < count; ++i) {
-			process([](const auto&) {
-				return true;
-			});
-		}
+		// empty predicate indicates that messages should be consumed without being read
+		for (auto i = 0u; i < count; ++i)
+			process(predicate<const std::vector<uint8_t>&>());
 	}
 
-	bool FileQueueReader::process(const predicate<const std::string&>& processFilename) {
+	bool FileQueueReader::process(const predicate<const std::vector<uint8_t>&>& processMessage) {
 		auto readerIndexValue = m_readerIndexFile.get();
 		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
 			return false;
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!std::filesystem::exists(nextMessageFilename))
+		// a message is either stored in a segment file or in a separate file
+		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue, Message_File_Extension);
+		if (!isInSelectedSegment(readerIndexValue) && std::filesystem::exists(nextMessageFilename)) {
+			if (processMessage && !processMessage(ReadAllContents(nextMessageFilename.generic_string())))
+				return false; // file was not fully processed, so don't delete it
+
+			m_readerIndexFile.increment();
+			std::filesystem::remove(nextMessageFilename);
+			return true;
+		}
+
+		if (!trySelectSegment(readerIndexValue))
 			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
 
-		if (!processFilename(nextMessageFilename.generic_string()))
-			return false; // file was not fully processed, so don't delete it
+		if (processMessage && !processMessage(readSegmentMessage(readerIndexValue)))
+			return false; // message was not fully processed, so don't consume it
 
+		// segment files are deleted after all of their messages are consumed and a subsequent segment is selected
 		m_readerIndexFile.increment();
-		std::filesystem::remove(nextMessageFilename);
 		return true;
 	}
 
+	bool FileQueueReader::isInSelectedSegment(uint64_t indexValue) const {
+		return m_pSegmentOffsetsFile && m_segmentId <= indexValue && indexValue < m_segmentId + m_numSegmentMessages;
+	}
+
+	bool FileQueueReader::trySelectSegment(uint64_t indexValue) {
+		if (isInSelectedSegment(indexValue))
+			return true;
+
+		// select the last segment starting at or before the message (reopen it if already selected because it might have grown)
+		auto segmentIds = FindSegmentIds(m_directory);
+		std::optional<uint64_t> segmentId;
+		for (auto id : segmentIds) {
+			if (id <= indexValue)
+				segmentId = id;
+		}
+
+		if (!segmentId)
+			return false;
+
+		// offsets file is opened before data file because message data is written before its end offset
+		m_pSegmentDataFile.reset();
+		m_pSegmentOffsetsFile.reset();
+		auto offsetsFile = OpenSegmentFile(m_directory, *segmentId, Segment_Offsets_File_Extension, OpenMode::Read_Only);
+		auto numSegmentMessages = CountSegmentMessages(offsetsFile);
+		if (indexValue >= *segmentId + numSegmentMessages)
+			return false;
+
+		auto dataFile = OpenSegmentFile(m_directory, *segmentId, Segment_Data_File_Extension, OpenMode::Read_Only);
+
+		// all messages in preceding segments have been consumed
+		for (auto id : segmentIds) {
+			if (id < *segmentId)
+				RemoveSegment(m_directory, id);
+		}
+
+		m_segmentId = *segmentId;
+		m_numSegmentMessages = numSegmentMessages;
+		m_pSegmentOffsetsFile = std::make_unique<RawFile>(std::move(offsetsFile));
+		m_pSegmentDataFile = std::make_unique<RawFile>(std::move(dataFile));
+		return true;
+	}
+
+	std::vector<uint8_t> FileQueueReader::readSegmentMessage(uint64_t indexValue) {
+		auto startOffset = ReadSegmentOffset(*m_pSegmentOffsetsFile, indexValue - m_segmentId);
+		auto endOffset = ReadSegmentOffset(*m_pSegmentOffsetsFile, indexValue - m_segmentId + 1);
+
+		std::vector<uint8_t> buffer(endOffset - startOffset);
+		m_pSegmentDataFile->seek(startOffset);
+		m_pSegmentDataFile->read(buffer);
+		return buffer;
+	}
+
 	// endregion
 }}
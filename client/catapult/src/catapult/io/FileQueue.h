@@ -22,13 +22,16 @@
 #pragma once
 #include "BufferedFileStream.h"
 #include "IndexFile.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/functions.h"
 #include <filesystem>
 
 namespace catapult { namespace io {
 
 	/// File based queue writer where each message is represented by a file (with incrementing names) in a directory.
-	/// \note Each call to flush will additionally create a new file.
+	/// \note Each call to flush will additionally create a new file unless a maximum segment size is specified.
+	///       In that case, messages are appended to segment files (named after their first messages) accompanied by offset files
+	///       and a new segment is started after a segment reaches the maximum size.
 	class FileQueueWriter final : public OutputStream {
 	public:
 		/// Creates a file queue writer around \a directory.
@@ -37,18 +40,33 @@ namespace catapult { namespace io {
 		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename).
 		FileQueueWriter(const std::string& directory, const std::string& indexFilename);
 
+		/// Creates a file queue writer around \a directory containing a (writer) index file (\a indexFilename)
+		/// that appends messages to segment files of (approximately) \a maxSegmentSize.
+		/// \note Each message is written to a separate file when \a maxSegmentSize is zero.
+		FileQueueWriter(const std::string& directory, const std::string& indexFilename, utils::FileSize maxSegmentSize);
+
 	public:
 		void write(const RawBuffer& buffer) override;
 		void flush() override;
 
+	private:
+		void openSegment(uint64_t segmentId, uint64_t numMessages);
+		void closeSegment();
+
 	private:
 		std::filesystem::path m_directory;
 		IndexFile m_indexFile;
 		uint64_t m_indexValue;
+		uint64_t m_maxSegmentSize;
 		std::unique_ptr<BufferedOutputFileStream> m_pOutputStream;
+
+		bool m_hasPendingMessage;
+		uint64_t m_segmentSize;
+		std::unique_ptr<RawFile> m_pSegmentOffsetsFile;
 	};
 
 	/// File based queue reader where each message is represented by a file (with incrementing names) in a directory.
+	/// \note Messages appended to segment files by a segmented writer are supported too.
 	class FileQueueReader final {
 	public:
 		/// Creates a file queue reader around \a directory.
@@ -74,11 +92,19 @@ namespace catapult { namespace io {
 		void skip(uint32_t count);
 
 	private:
-		bool process(const predicate<const std::string&>& processFilename);
+		bool process(const predicate<const std::vector<uint8_t>&>& processMessage);
+		bool isInSelectedSegment(uint64_t indexValue) const;
+		bool trySelectSegment(uint64_t indexValue);
+		std::vector<uint8_t> readSegmentMessage(uint64_t indexValue);
 
 	private:
 		std::filesystem::path m_directory;
 		IndexFile m_readerIndexFile;
 		IndexFile m_writerIndexFile;
+
+		uint64_t m_segmentId;
+		uint64_t m_numSegmentMessages;
+		std::unique_ptr<RawFile> m_pSegmentOffsetsFile;
+		std::unique_ptr<RawFile> m_pSegmentDataFile;
 	};
 }}
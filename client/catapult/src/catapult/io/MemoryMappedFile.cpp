@@ -0,0 +1,60 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	struct MemoryMappedFile::Impl {
+		boost::interprocess::mapped_region Region;
+	};
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& filePath) : m_pImpl(std::make_unique<Impl>()) {
+		if (!std::filesystem::exists(filePath))
+			CATAPULT_THROW_AND_LOG_1(catapult_file_io_error, "could not find file", filePath);
+
+		// empty files cannot be mapped, so leave the mapping empty
+		if (0 == std::filesystem::file_size(filePath))
+			return;
+
+		try {
+			// notice that the file mapping can be closed once the file has been mapped
+			boost::interprocess::file_mapping mapping(filePath.c_str(), boost::interprocess::read_only);
+			m_pImpl->Region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+		} catch (const boost::interprocess::interprocess_exception& ex) {
+			CATAPULT_THROW_AND_LOG_2(catapult_file_io_error, "could not map file", filePath, std::string(ex.what()));
+		}
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() = default;
+
+	uint64_t MemoryMappedFile::size() const {
+		return m_pImpl->Region.get_size();
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return static_cast<const uint8_t*>(m_pImpl->Region.get_address());
+	}
+}}
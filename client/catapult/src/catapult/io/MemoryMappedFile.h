@@ -0,0 +1,51 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include <memory>
+#include <string>
+#include <stdint.h>
+
+namespace catapult { namespace io {
+
+	/// Read-only memory mapping of a file.
+	class MemoryMappedFile final : public utils::NonCopyable {
+	public:
+		/// Maps the (entire) file with path \a filePath.
+		/// \throws catapult_file_io_error if the file does not exist or cannot be mapped.
+		explicit MemoryMappedFile(const std::string& filePath);
+
+		/// Unmaps the file.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets the size of the mapping.
+		uint64_t size() const;
+
+		/// Gets a pointer to the mapped data.
+		const uint8_t* data() const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}}
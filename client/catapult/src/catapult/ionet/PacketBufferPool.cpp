@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketBufferPool.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace ionet {
+
+	PacketBufferPool::PacketBufferPool(size_t minBufferSize, size_t maxBufferSize, utils::FileSize maxPoolSize)
+			: m_minBufferSize(minBufferSize)
+			, m_maxPoolSize(maxPoolSize.bytes())
+			, m_numHits(0)
+			, m_numMisses(0)
+			, m_numBuffers(0)
+			, m_size(0) {
+		if (0 == m_minBufferSize || minBufferSize > maxBufferSize)
+			CATAPULT_THROW_INVALID_ARGUMENT_2("invalid buffer size range", minBufferSize, maxBufferSize);
+
+		auto numSizeClasses = 1u;
+		for (auto capacity = m_minBufferSize; capacity < maxBufferSize; capacity *= 2)
+			++numSizeClasses;
+
+		m_sizeClassBuffers.resize(numSizeClasses);
+	}
+
+	size_t PacketBufferPool::numSizeClasses() const {
+		return m_sizeClassBuffers.size();
+	}
+
+	size_t PacketBufferPool::sizeClassCapacity(size_t size) const {
+		auto sizeClass = findSizeClass(size);
+		return sizeClass < m_sizeClassBuffers.size() ? m_minBufferSize << sizeClass : size;
+	}
+
+	PacketBufferPoolStatistics PacketBufferPool::statistics() const {
+		utils::SpinLockGuard guard(m_lock);
+		return { m_numHits, m_numMisses, m_numBuffers, utils::FileSize::FromBytes(m_size) };
+	}
+
+	ByteBuffer PacketBufferPool::acquire(size_t size) {
+		auto sizeClass = findSizeClass(size);
+		{
+			utils::SpinLockGuard guard(m_lock);
+			if (sizeClass < m_sizeClassBuffers.size() && !m_sizeClassBuffers[sizeClass].empty()) {
+				auto& buffers = m_sizeClassBuffers[sizeClass];
+				auto buffer = std::move(buffers.back());
+				buffers.pop_back();
+
+				++m_numHits;
+				--m_numBuffers;
+				m_size -= buffer.capacity();
+				return buffer;
+			}
+
+			++m_numMisses;
+		}
+
+		// allocate outside of the lock
+		ByteBuffer buffer;
+		buffer.reserve(sizeClassCapacity(size));
+		return buffer;
+	}
+
+	void PacketBufferPool::release(ByteBuffer&& buffer) {
+		auto capacity = buffer.capacity();
+		if (capacity < m_minBufferSize)
+			return;
+
+		// place the buffer into the largest size class that it can fully satisfy
+		auto sizeClass = findSizeClass(capacity);
+		if (sizeClass == m_sizeClassBuffers.size() || capacity < m_minBufferSize << sizeClass)
+			--sizeClass;
+
+		buffer.clear();
+
+		utils::SpinLockGuard guard(m_lock);
+		if (m_size + capacity > m_maxPoolSize)
+			return;
+
+		m_sizeClassBuffers[sizeClass].push_back(std::move(buffer));
+		++m_numBuffers;
+		m_size += capacity;
+	}
+
+	size_t PacketBufferPool::findSizeClass(size_t size) const {
+		size_t sizeClass = 0;
+		for (auto capacity = m_minBufferSize; capacity < size && sizeClass < m_sizeClassBuffers.size(); capacity *= 2)
+			++sizeClass;
+
+		return sizeClass;
+	}
+}}
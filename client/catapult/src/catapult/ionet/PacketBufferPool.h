@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/SpinLock.h"
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Packet buffer pool statistics.
+	struct PacketBufferPoolStatistics {
+		/// Number of buffer acquisitions that were served by a pooled buffer.
+		uint64_t NumHits;
+
+		/// Number of buffer acquisitions that required a new allocation.
+		uint64_t NumMisses;
+
+		/// Number of buffers retained by the pool.
+		size_t NumBuffers;
+
+		/// Total capacity of buffers retained by the pool.
+		utils::FileSize Size;
+	};
+
+	/// Thread safe pool of reusable packet buffers.
+	/// \note Buffers are grouped into power of two size classes starting at the minimum buffer size.
+	class PacketBufferPool : public utils::NonCopyable {
+	public:
+		/// Creates a pool with size classes ranging from \a minBufferSize to (at least) \a maxBufferSize
+		/// that retains up to \a maxPoolSize bytes of released buffers.
+		PacketBufferPool(size_t minBufferSize, size_t maxBufferSize, utils::FileSize maxPoolSize);
+
+	public:
+		/// Gets the number of size classes.
+		size_t numSizeClasses() const;
+
+		/// Gets the buffer capacity of the smallest size class that can hold \a size bytes.
+		/// \note Sizes larger than the largest size class are returned unchanged.
+		size_t sizeClassCapacity(size_t size) const;
+
+		/// Gets the pool statistics.
+		PacketBufferPoolStatistics statistics() const;
+
+	public:
+		/// Acquires an empty buffer with a capacity of at least \a size bytes.
+		ByteBuffer acquire(size_t size);
+
+		/// Releases \a buffer back to the pool.
+		/// \note Buffers are discarded when they are smaller than the smallest size class or the pool is full.
+		void release(ByteBuffer&& buffer);
+
+	private:
+		size_t findSizeClass(size_t size) const;
+
+	private:
+		size_t m_minBufferSize;
+		size_t m_maxPoolSize;
+		std::vector<std::vector<ByteBuffer>> m_sizeClassBuffers;
+
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		size_t m_numBuffers;
+		size_t m_size;
+		mutable utils::SpinLock m_lock;
+	};
+}}
@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketPayloadWriteBuffers.h"
+#include "catapult/utils/MemoryUtils.h"
+
+namespace catapult { namespace ionet {
+
+	PacketPayloadWriteBuffers::PacketPayloadWriteBuffers(const PacketPayload& payload, size_t maxCoalescedBufferSize)
+			: m_payload(payload) {
+		std::vector<RawBuffer> sourceBuffers;
+		sourceBuffers.reserve(1 + m_payload.buffers().size());
+		sourceBuffers.push_back({ reinterpret_cast<const uint8_t*>(&m_payload.header()), sizeof(PacketHeader) });
+		sourceBuffers.insert(sourceBuffers.end(), m_payload.buffers().cbegin(), m_payload.buffers().cend());
+
+		// allocate all coalesced data upfront so that buffers pointing into it are never invalidated
+		size_t numCoalescedBytes = 0;
+		for (const auto& buffer : sourceBuffers) {
+			if (buffer.Size < maxCoalescedBufferSize)
+				numCoalescedBytes += buffer.Size;
+		}
+
+		m_coalescedData.resize(numCoalescedBytes);
+
+		size_t blockStartOffset = 0;
+		size_t blockEndOffset = 0;
+		auto flushBlock = [this, &blockStartOffset, &blockEndOffset]() {
+			if (blockStartOffset != blockEndOffset)
+				m_buffers.push_back({ m_coalescedData.data() + blockStartOffset, blockEndOffset - blockStartOffset });
+
+			blockStartOffset = blockEndOffset;
+		};
+
+		for (const auto& buffer : sourceBuffers) {
+			if (buffer.Size >= maxCoalescedBufferSize) {
+				flushBlock();
+				m_buffers.push_back(buffer);
+				continue;
+			}
+
+			if (blockEndOffset - blockStartOffset + buffer.Size > maxCoalescedBufferSize)
+				flushBlock();
+
+			utils::memcpy_cond(m_coalescedData.data() + blockEndOffset, buffer.pData, buffer.Size);
+			blockEndOffset += buffer.Size;
+		}
+
+		flushBlock();
+	}
+
+	const std::vector<RawBuffer>& PacketPayloadWriteBuffers::buffers() const {
+		return m_buffers;
+	}
+
+	size_t PacketPayloadWriteBuffers::numCoalescedBytes() const {
+		return m_coalescedData.size();
+	}
+}}
@@ -0,0 +1,54 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketPayload.h"
+#include "catapult/utils/NonCopyable.h"
+#include <vector>
+
+namespace catapult { namespace ionet {
+
+	/// Gathers the header and data buffers of a packet payload into a sequence of buffers that can be written together.
+	/// \note Small buffers are coalesced so that each written buffer fills (up to) a single ssl record.
+	class PacketPayloadWriteBuffers : public utils::NonCopyable {
+	public:
+		/// Maximum size of a coalesced buffer, which is equal to the maximum ssl record payload size.
+		static constexpr size_t Max_Coalesced_Buffer_Size = 16 * 1024;
+
+	public:
+		/// Creates write buffers for \a payload.
+		/// Adjacent buffers smaller than \a maxCoalescedBufferSize are copied into contiguous buffers
+		/// of at most \a maxCoalescedBufferSize bytes; all other buffers are referenced directly.
+		explicit PacketPayloadWriteBuffers(const PacketPayload& payload, size_t maxCoalescedBufferSize = Max_Coalesced_Buffer_Size);
+
+	public:
+		/// Gets the buffers to write (in order).
+		const std::vector<RawBuffer>& buffers() const;
+
+		/// Gets the total number of bytes copied into coalesced buffers.
+		size_t numCoalescedBytes() const;
+
+	private:
+		PacketPayload m_payload;
+		std::vector<uint8_t> m_coalescedData;
+		std::vector<RawBuffer> m_buffers;
+	};
+}}
@@ -22,11 +22,13 @@
 #include "PacketSocket.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
+#include "PacketPayloadWriteBuffers.h"
 #include "WorkingBuffer.h"
 #include "catapult/thread/StrandOwnerLifetimeExtender.h"
 #include "catapult/thread/TimedCallback.h"
 #include "catapult/utils/StackTimer.h"
 #include <boost/asio/ssl.hpp>
+#include <climits>
 
 namespace catapult { namespace ionet {
 
@@ -158,6 +160,12 @@ namespace catapult { namespace ionet {
 
 		// region BasicPacketSocket(Writer)
 
+#ifdef IOV_MAX
+		constexpr size_t Max_Buffers_Per_Write = IOV_MAX;
+#else
+		constexpr size_t Max_Buffers_Per_Write = 1024;
+#endif
+
 		template<typename TSocketCallbackWrapper>
 		class BasicPacketSocketWriter {
 		public:
@@ -175,35 +183,37 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
+				// header and data buffers are gathered into as few writes as possible (one unless there are more than
+				// Max_Buffers_Per_Write buffers) in order to minimize strand roundtrips and syscalls
 				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
+				writeNext(boost::system::error_code(), pContext);
 			}
 
 		private:
 			struct WriteContext {
 			public:
 				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
+						: m_writeBuffers(payload)
 						, m_callback(callback)
 						, m_nextBufferIndex(0)
 				{}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
-				}
+				auto nextDataBuffers() {
+					const auto& buffers = m_writeBuffers.buffers();
+					auto endBufferIndex = std::min(buffers.size(), m_nextBufferIndex + Max_Buffers_Per_Write);
+
+					std::vector<boost::asio::const_buffer> asioBuffers;
+					asioBuffers.reserve(endBufferIndex - m_nextBufferIndex);
+					for (; m_nextBufferIndex < endBufferIndex; ++m_nextBufferIndex)
+						asioBuffers.push_back(boost::asio::buffer(buffers[m_nextBufferIndex].pData, buffers[m_nextBufferIndex].Size));
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+					return asioBuffers;
 				}
 
 				bool tryComplete(const boost::system::error_code& ec) {
 					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
+					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_writeBuffers.buffers().size()) {
 						m_callback(lastCode);
 						return true;
 					}
@@ -212,7 +222,7 @@ namespace catapult { namespace ionet {
 				}
 
 			private:
-				const PacketPayload m_payload;
+				const PacketPayloadWriteBuffers m_writeBuffers;
 				const PacketSocket::WriteCallback m_callback;
 				size_t m_nextBufferIndex;
 			};
@@ -221,8 +231,8 @@ namespace catapult { namespace ionet {
 				if (pContext->tryComplete(lastEc))
 					return;
 
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
+				auto buffers = pContext->nextDataBuffers();
+				boost::asio::async_write(m_socket, buffers, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
 					this->writeNext(ec, pContext);
 				}));
 			}
@@ -24,6 +24,7 @@
 #include "catapult/utils/TimeSpan.h"
 #include "catapult/functions.h"
 #include <filesystem>
+#include <memory>
 
 namespace boost {
 	namespace asio {
@@ -34,6 +35,8 @@ namespace boost {
 	}
 }
 
+namespace catapult { namespace ionet { class PacketBufferPool; } }
+
 namespace catapult { namespace ionet {
 
 	/// Context passed to ssl verify context predicate.
@@ -86,6 +89,10 @@ namespace catapult { namespace ionet {
 		/// Working buffer sensitivity.
 		size_t WorkingBufferSensitivity;
 
+		/// Pool used for allocating working buffers.
+		/// \note When unset, each working buffer manages its own memory.
+		std::shared_ptr<PacketBufferPool> BufferPool;
+
 		/// Maximum packet data size.
 		size_t MaxPacketDataSize;
 
@@ -20,6 +20,7 @@
 **/
 
 #include "WorkingBuffer.h"
+#include "PacketBufferPool.h"
 
 namespace catapult { namespace ionet {
 
@@ -27,7 +28,15 @@ namespace catapult { namespace ionet {
 			: m_options(options)
 			, m_numDataSizeSamples(0)
 			, m_maxDataSize(0) {
-		m_data.reserve(m_options.WorkingBufferSize);
+		if (m_options.BufferPool)
+			m_data = m_options.BufferPool->acquire(m_options.WorkingBufferSize);
+		else
+			m_data.reserve(m_options.WorkingBufferSize);
+	}
+
+	WorkingBuffer::~WorkingBuffer() {
+		if (m_options.BufferPool)
+			m_options.BufferPool->release(std::move(m_data));
 	}
 
 	void WorkingBuffer::append(uint8_t byte) {
@@ -35,6 +44,7 @@ namespace catapult { namespace ionet {
 	}
 
 	AppendContext WorkingBuffer::prepareAppend() {
+		reserveAppendCapacity();
 		AppendContext appendContext(m_data, m_options.WorkingBufferSize);
 		checkMemoryUsage();
 		return appendContext;
@@ -44,6 +54,14 @@ namespace catapult { namespace ionet {
 		return PacketExtractor(m_data, m_options.MaxPacketDataSize);
 	}
 
+	void WorkingBuffer::reserveAppendCapacity() {
+		// when pooling, grow by swapping in a pooled buffer so that AppendContext never needs to reallocate
+		if (!m_options.BufferPool || m_data.capacity() - m_data.size() >= m_options.WorkingBufferSize)
+			return;
+
+		reallocate(m_data.size() + m_options.WorkingBufferSize);
+	}
+
 	void WorkingBuffer::checkMemoryUsage() {
 		// ignore if memory reclamation is disabled
 		if (0 == m_options.WorkingBufferSensitivity)
@@ -55,18 +73,28 @@ namespace catapult { namespace ionet {
 			return;
 
 		// ignore if savings is less than WorkingBufferSize
-		auto maxDataSize = m_maxDataSize;
+		auto maxDataSize = m_options.BufferPool ? m_options.BufferPool->sizeClassCapacity(m_maxDataSize) : m_maxDataSize;
 		m_numDataSizeSamples = 0;
 		m_maxDataSize = 0;
-		if (m_data.capacity() - maxDataSize < m_options.WorkingBufferSize)
+		if (m_data.capacity() < maxDataSize || m_data.capacity() - maxDataSize < m_options.WorkingBufferSize)
 			return;
 
 		CATAPULT_LOG(trace) << "reclaiming memory, decreasing buffer capacity from " << m_data.capacity() << " to " << maxDataSize;
+		reallocate(maxDataSize);
+	}
 
+	void WorkingBuffer::reallocate(size_t capacity) {
 		ByteBuffer dataCopy;
-		dataCopy.reserve(maxDataSize);
+		if (m_options.BufferPool)
+			dataCopy = m_options.BufferPool->acquire(capacity);
+		else
+			dataCopy.reserve(capacity);
+
 		dataCopy.resize(m_data.size());
 		std::memcpy(dataCopy.data(), m_data.data(), m_data.size());
 		std::swap(m_data, dataCopy);
+
+		if (m_options.BufferPool)
+			m_options.BufferPool->release(std::move(dataCopy));
 	}
 }}
@@ -24,15 +24,19 @@
 #include "IoTypes.h"
 #include "PacketExtractor.h"
 #include "PacketSocketOptions.h"
+#include "catapult/utils/NonCopyable.h"
 
 namespace catapult { namespace ionet {
 
 	/// Buffer for storing working data.
-	class WorkingBuffer {
+	class WorkingBuffer : public utils::NonCopyable {
 	public:
 		/// Creates an empty working buffer around \a options.
 		explicit WorkingBuffer(const PacketSocketOptions& options);
 
+		/// Destroys the working buffer and returns its memory to the buffer pool (if any).
+		~WorkingBuffer();
+
 	public:
 		/// Gets a const iterator to the beginning of the buffer
 		inline auto begin() const {
@@ -70,8 +74,12 @@ namespace catapult { namespace ionet {
 		PacketExtractor preparePacketExtractor();
 
 	private:
+		void reserveAppendCapacity();
+
 		void checkMemoryUsage();
 
+		void reallocate(size_t capacity);
+
 	private:
 		PacketSocketOptions m_options;
 		ByteBuffer m_data;
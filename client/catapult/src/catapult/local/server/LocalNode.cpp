@@ -32,6 +32,7 @@
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
@@ -39,6 +40,7 @@
 #include "catapult/io/FileQueue.h"
 #include "catapult/io/FilesystemUtils.h"
 #include "catapult/ionet/NodeContainer.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/utils/StackLogger.h"
 
@@ -174,6 +176,18 @@ namespace catapult { namespace local {
 
 		// region utils
 
+		void AddSocketWorkingBufferPoolCounters(std::vector<utils::DiagnosticCounter>& counters, const ionet::PacketBufferPool& pool) {
+			counters.emplace_back(utils::DiagnosticCounterId("SOCKPOOL HIT"), [&pool]() {
+				return pool.statistics().NumHits;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("SOCKPOOL MISS"), [&pool]() {
+				return pool.statistics().NumMisses;
+			});
+			counters.emplace_back(utils::DiagnosticCounterId("SOCKPOOL MEM"), [&pool]() {
+				return pool.statistics().Size.megabytes();
+			});
+		}
+
 		void AddNodeCounters(std::vector<utils::DiagnosticCounter>& counters, const ionet::NodeContainer& nodes) {
 			counters.emplace_back(utils::DiagnosticCounterId("NODES"), [&nodes]() {
 				return nodes.view().size();
@@ -204,10 +218,12 @@ namespace catapult { namespace local {
 							ionet::CreateRangeNodeVersionPredicate(
 									m_config.Node.MinPartnerNodeVersion,
 									m_config.Node.MaxPartnerNodeVersion))
+					, m_pSocketWorkingBufferPool(extensions::CreateSocketWorkingBufferPool(m_config.Node))
 					, m_catapultCache({}) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize))
+							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize),
+							m_config.Node.BlockStorageCacheSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pFinalizationSubscriber(m_pBootstrapper->subscriptionManager().createFinalizationSubscriber())
 					, m_pNodeSubscriber(CreateNodeSubscriber(
@@ -262,7 +278,8 @@ namespace catapult { namespace local {
 						*m_pTransactionStatusSubscriber,
 						m_counters,
 						m_pluginManager,
-						m_pBootstrapper->pool());
+						m_pBootstrapper->pool(),
+						m_pSocketWorkingBufferPool);
 				extensionManager.registerServices(m_serviceLocator, serviceState);
 				for (const auto& counter : m_serviceLocator.counters())
 					m_counters.push_back(counter);
@@ -294,6 +311,19 @@ namespace catapult { namespace local {
 					return source.view().memorySize().megabytes();
 				});
 
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE HIT"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE MEM"), [&storage = m_storage]() {
+					return storage.statistics().Size.megabytes();
+				});
+
+				if (m_pSocketWorkingBufferPool)
+					AddSocketWorkingBufferPoolCounters(m_counters, *m_pSocketWorkingBufferPool);
+
 				AddNodeCounters(m_counters, m_nodes);
 			}
 
@@ -389,6 +419,7 @@ namespace catapult { namespace local {
 			const config::CatapultConfiguration& m_config;
 			config::CatapultDataDirectory m_dataDirectory;
 			ionet::NodeContainer m_nodes;
+			std::shared_ptr<ionet::PacketBufferPool> m_pSocketWorkingBufferPool;
 
 			cache::CatapultCache m_catapultCache;
 			io::BlockStorageCache m_storage;
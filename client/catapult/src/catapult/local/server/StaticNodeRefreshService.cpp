@@ -82,7 +82,7 @@ namespace catapult { namespace local {
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				// register services
-				auto connectionSettings = extensions::GetConnectionSettings(state.config());
+				auto connectionSettings = extensions::GetConnectionSettings(state.config(), state.socketWorkingBufferPool());
 				auto pServiceGroup = state.pool().pushServiceGroup("static_node_refresh");
 
 				auto pServerConnector = pServiceGroup->pushService(
@@ -33,9 +33,12 @@ namespace catapult { namespace model {
 			return { reinterpret_cast<const uint8_t*>(&entity) + headerSize, totalSize - headerSize };
 		}
 
-		Hash256 CalculateHash(const VerifiableEntity& entity, const RawBuffer& buffer, const GenerationHashSeed* pGenerationHashSeed) {
+		Hash256 CalculateHash(
+				crypto::Sha3_256_Builder& sha3,
+				const VerifiableEntity& entity,
+				const RawBuffer& buffer,
+				const GenerationHashSeed* pGenerationHashSeed) {
 			Hash256 entityHash;
-			crypto::Sha3_256_Builder sha3;
 
 			// add full signature and public key (this is different than Sign/Verify)
 			sha3.update(entity.Signature);
@@ -48,6 +51,31 @@ namespace catapult { namespace model {
 			sha3.final(entityHash);
 			return entityHash;
 		}
+
+		Hash256 CalculateHash(const VerifiableEntity& entity, const RawBuffer& buffer, const GenerationHashSeed* pGenerationHashSeed) {
+			crypto::Sha3_256_Builder sha3;
+			return CalculateHash(sha3, entity, buffer, pGenerationHashSeed);
+		}
+
+		Hash256 CalculateMerkleComponentHash(
+				crypto::Sha3_256_Builder& sha3,
+				const Transaction& transaction,
+				const Hash256& transactionHash,
+				const TransactionRegistry& transactionRegistry) {
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+
+			auto supplementaryBuffers = plugin.merkleSupplementaryBuffers(transaction);
+			if (supplementaryBuffers.empty())
+				return transactionHash;
+
+			sha3.update(transactionHash);
+			for (const auto& supplementaryBuffer : supplementaryBuffers)
+				sha3.update(supplementaryBuffer);
+
+			Hash256 merkleComponentHash;
+			sha3.final(merkleComponentHash);
+			return merkleComponentHash;
+		}
 	}
 
 	Hash256 CalculateHash(const Block& block) {
@@ -66,20 +94,8 @@ namespace catapult { namespace model {
 			const Transaction& transaction,
 			const Hash256& transactionHash,
 			const TransactionRegistry& transactionRegistry) {
-		const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
-
-		auto supplementaryBuffers = plugin.merkleSupplementaryBuffers(transaction);
-		if (supplementaryBuffers.empty())
-			return transactionHash;
-
 		crypto::Sha3_256_Builder sha3;
-		sha3.update(transactionHash);
-		for (const auto& supplementaryBuffer : supplementaryBuffers)
-			sha3.update(supplementaryBuffer);
-
-		Hash256 merkleComponentHash;
-		sha3.final(merkleComponentHash);
-		return merkleComponentHash;
+		return CalculateMerkleComponentHash(sha3, transaction, transactionHash, transactionRegistry);
 	}
 
 	std::vector<Hash256> CalculateMerkleTree(const std::vector<TransactionElement>& transactionElements) {
@@ -96,11 +112,24 @@ namespace catapult { namespace model {
 			const TransactionRegistry& transactionRegistry,
 			const GenerationHashSeed& generationHashSeed,
 			TransactionElement& transactionElement) {
+		crypto::Sha3_256_Builder hashBuilder;
+		UpdateHashes(transactionRegistry, generationHashSeed, transactionElement, hashBuilder);
+	}
+
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			TransactionElement& transactionElement,
+			crypto::Sha3_256_Builder& hashBuilder) {
 		const auto& transaction = transactionElement.Transaction;
 		const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
 
-		transactionElement.EntityHash = CalculateHash(transaction, generationHashSeed, plugin.dataBuffer(transaction));
+		hashBuilder.reset();
+		transactionElement.EntityHash = CalculateHash(hashBuilder, transaction, plugin.dataBuffer(transaction), &generationHashSeed);
+
+		hashBuilder.reset();
 		transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
+				hashBuilder,
 				transaction,
 				transactionElement.EntityHash,
 				transactionRegistry);
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "Block.h"
+#include "catapult/crypto/Hashes.h"
 
 namespace catapult {
 	namespace model {
@@ -57,4 +58,13 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Calculates the hashes for \a transactionElement in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note \a hashBuilder is reset before each use, so a single builder can be reused across many transactions.
+	void UpdateHashes(
+				const TransactionRegistry& transactionRegistry,
+				const GenerationHashSeed& generationHashSeed,
+				TransactionElement& transactionElement,
+				crypto::Sha3_256_Builder& hashBuilder);
 }}
@@ -61,6 +61,9 @@ namespace catapult { namespace net {
 		/// Socket working buffer sensitivity.
 		size_t SocketWorkingBufferSensitivity;
 
+		/// Pool used for allocating socket working buffers (optional).
+		std::shared_ptr<ionet::PacketBufferPool> SocketWorkingBufferPool;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -83,6 +86,7 @@ namespace catapult { namespace net {
 			options.AcceptHandshakeTimeout = Timeout;
 			options.WorkingBufferSize = SocketWorkingBufferSize.bytes();
 			options.WorkingBufferSensitivity = SocketWorkingBufferSensitivity;
+			options.BufferPool = SocketWorkingBufferPool;
 			options.MaxPacketDataSize = MaxPacketDataSize.bytes();
 			options.OutgoingProtocols = OutgoingProtocols;
 			options.SslOptions = SslOptions;
@@ -22,6 +22,7 @@
 #pragma once
 #include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
+#include "catapult/utils/ExecutionProfiler.h"
 #include <functional>
 #include <vector>
 
@@ -32,10 +33,20 @@ namespace catapult { namespace observers {
 	private:
 		using NotificationObserverPredicate = predicate<const model::Notification&>;
 
+	public:
+		/// Creates a builder.
+		DemuxObserverBuilder() : m_pProfiler(nullptr)
+		{}
+
+		/// Creates a builder that records execution statistics of all added observers in \a profiler.
+		explicit DemuxObserverBuilder(utils::ExecutionProfiler& profiler) : m_pProfiler(&profiler)
+		{}
+
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
+			pObserver = profile(std::move(pObserver));
 			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
 				return model::AreEqualExcludingChannel(type, notification.Type);
 			};
@@ -49,6 +60,38 @@ namespace catapult { namespace observers {
 		}
 
 	private:
+		template<typename TNotification>
+		NotificationObserverPointerT<TNotification> profile(NotificationObserverPointerT<TNotification>&& pObserver) {
+			if (!m_pProfiler)
+				return std::move(pObserver);
+
+			auto& statistics = m_pProfiler->statistics(pObserver->name());
+			return std::make_unique<ProfilingObserver<TNotification>>(std::move(pObserver), statistics);
+		}
+
+		template<typename TNotification>
+		class ProfilingObserver : public NotificationObserverT<TNotification> {
+		public:
+			ProfilingObserver(NotificationObserverPointerT<TNotification>&& pObserver, utils::ExecutionStatistics& statistics)
+					: m_pObserver(std::move(pObserver))
+					, m_statistics(statistics)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pObserver->name();
+			}
+
+			void notify(const TNotification& notification, ObserverContext& context) const override {
+				utils::ExecutionTimer timer(m_statistics);
+				m_pObserver->notify(notification, context);
+			}
+
+		private:
+			NotificationObserverPointerT<TNotification> m_pObserver;
+			utils::ExecutionStatistics& m_statistics;
+		};
+
 		template<typename TNotification>
 		class ConditionalObserver : public NotificationObserver {
 		public:
@@ -75,13 +118,14 @@ namespace catapult { namespace observers {
 		};
 
 	private:
+		utils::ExecutionProfiler* m_pProfiler;
 		AggregateObserverBuilder<model::Notification> m_builder;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	inline DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_builder.add(profile(std::move(pObserver)));
 		return *this;
 	}
 }}
@@ -57,9 +57,19 @@ namespace catapult { namespace plugins {
 		if (!m_storageConfig.PreferCacheDatabase)
 			return cache::CacheConfiguration();
 
+		// only pass along column configurations for the named cache, keyed by column name
+		auto cacheDatabaseConfig = m_storageConfig.CacheDatabaseConfig;
+		cacheDatabaseConfig.Columns.clear();
+
+		auto prefix = name + ".";
+		for (const auto& pair : m_storageConfig.CacheDatabaseConfig.Columns) {
+			if (pair.first.size() > prefix.size() && 0 == pair.first.find(prefix))
+				cacheDatabaseConfig.Columns.emplace(pair.first.substr(prefix.size()), pair.second);
+		}
+
 		return cache::CacheConfiguration(
 				(std::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string(),
-				m_storageConfig.CacheDatabaseConfig,
+				cacheDatabaseConfig,
 				m_config.EnableVerifiableState ? cache::PatriciaTreeStorageMode::Enabled : cache::PatriciaTreeStorageMode::Disabled);
 	}
 
@@ -96,9 +106,14 @@ namespace catapult { namespace plugins {
 				hook(builder, std::forward<TArgs>(args)...);
 		}
 
+		template<typename TBuilder>
+		static TBuilder CreateBuilder(utils::ExecutionProfiler* pProfiler) {
+			return pProfiler ? TBuilder(*pProfiler) : TBuilder();
+		}
+
 		template<typename TBuilder, typename THooks, typename... TArgs>
-		static auto Build(const THooks& hooks, TArgs&&... args) {
-			TBuilder builder;
+		static auto Build(const THooks& hooks, utils::ExecutionProfiler* pProfiler, TArgs&&... args) {
+			auto builder = CreateBuilder<TBuilder>(pProfiler);
 			ApplyAll(builder, hooks);
 			return builder.build(std::forward<TArgs>(args)...);
 		}
@@ -148,7 +163,8 @@ namespace catapult { namespace plugins {
 
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateless::DemuxValidatorBuilder>(m_statelessValidatorHooks, isSuppressedFailure);
+		using BuilderType = validators::stateless::DemuxValidatorBuilder;
+		return Build<BuilderType>(m_statelessValidatorHooks, m_pValidatorProfiler.get(), isSuppressedFailure);
 	}
 
 	PluginManager::StatelessValidatorPointer PluginManager::createStatelessValidator() const {
@@ -157,7 +173,8 @@ namespace catapult { namespace plugins {
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator(
 			const validators::ValidationResultPredicate& isSuppressedFailure) const {
-		return Build<validators::stateful::DemuxValidatorBuilder>(m_statefulValidatorHooks, isSuppressedFailure);
+		using BuilderType = validators::stateful::DemuxValidatorBuilder;
+		return Build<BuilderType>(m_statefulValidatorHooks, m_pValidatorProfiler.get(), isSuppressedFailure);
 	}
 
 	PluginManager::StatefulValidatorPointer PluginManager::createStatefulValidator() const {
@@ -177,14 +194,31 @@ namespace catapult { namespace plugins {
 	}
 
 	PluginManager::ObserverPointer PluginManager::createObserver() const {
-		observers::DemuxObserverBuilder builder;
+		auto builder = CreateBuilder<observers::DemuxObserverBuilder>(m_pObserverProfiler.get());
 		ApplyAll(builder, m_observerHooks);
 		ApplyAll(builder, m_transientObserverHooks);
 		return builder.build();
 	}
 
 	PluginManager::ObserverPointer PluginManager::createPermanentObserver() const {
-		return Build<observers::DemuxObserverBuilder>(m_observerHooks);
+		return Build<observers::DemuxObserverBuilder>(m_observerHooks, m_pObserverProfiler.get());
+	}
+
+	// endregion
+
+	// region profiling
+
+	void PluginManager::enableNotificationProfiling() {
+		m_pValidatorProfiler = std::make_unique<utils::ExecutionProfiler>();
+		m_pObserverProfiler = std::make_unique<utils::ExecutionProfiler>();
+	}
+
+	const utils::ExecutionProfiler* PluginManager::validatorProfiler() const {
+		return m_pValidatorProfiler.get();
+	}
+
+	const utils::ExecutionProfiler* PluginManager::observerProfiler() const {
+		return m_pObserverProfiler.get();
 	}
 
 	// endregion
@@ -31,6 +31,7 @@
 #include "catapult/observers/DemuxObserverBuilder.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/ExecutionProfiler.h"
 #include "catapult/validators/DemuxValidatorBuilder.h"
 #include "catapult/validators/ValidatorTypes.h"
 #include "catapult/plugins.h"
@@ -200,6 +201,19 @@ namespace catapult { namespace plugins {
 
 		// endregion
 
+		// region profiling
+
+		/// Enables recording of execution statistics by all validators and observers created after this call.
+		void enableNotificationProfiling();
+
+		/// Gets the validator execution profiler or \c nullptr when profiling is disabled.
+		const utils::ExecutionProfiler* validatorProfiler() const;
+
+		/// Gets the observer execution profiler or \c nullptr when profiling is disabled.
+		const utils::ExecutionProfiler* observerProfiler() const;
+
+		// endregion
+
 		// region resolvers
 
 		/// Adds a mosaic \a resolver.
@@ -235,6 +249,8 @@ namespace catapult { namespace plugins {
 		std::vector<StatefulValidatorHook> m_statefulValidatorHooks;
 		std::vector<ObserverHook> m_observerHooks;
 		std::vector<ObserverHook> m_transientObserverHooks;
+		std::unique_ptr<utils::ExecutionProfiler> m_pValidatorProfiler;
+		std::unique_ptr<utils::ExecutionProfiler> m_pObserverProfiler;
 
 		std::vector<MosaicResolver> m_mosaicResolvers;
 		std::vector<AddressResolver> m_addressResolvers;
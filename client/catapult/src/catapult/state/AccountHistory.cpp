@@ -42,6 +42,12 @@ namespace catapult { namespace state {
 		});
 	}
 
+	bool AccountHistory::hasValueAfter(Height height) const {
+		return m_heightBalanceMap.hasValueAfter(height)
+				|| m_heightVrfPublicKeyMap.hasValueAfter(height)
+				|| m_heightVotingPublicKeysMap.hasValueAfter(height);
+	}
+
 	void AccountHistory::add(Height height, Amount balance) {
 		m_heightBalanceMap.add(height, balance);
 	}
@@ -42,6 +42,9 @@ namespace catapult { namespace state {
 		/// Returns \c true if any historical balance is at least \a minAmount.
 		bool anyAtLeast(Amount minAmount) const;
 
+		/// Returns \c true if any value was added at a height greater than \a height.
+		bool hasValueAfter(Height height) const;
+
 	public:
 		/// Adds \a balance at \a height.
 		void add(Height height, Amount balance);
@@ -55,6 +55,11 @@ namespace catapult { namespace state {
 			return m_heightValueMap.cend() == iter ? TValue() : iter->second;
 		}
 
+		/// Returns \c true if there is a value change at a height greater than \a height.
+		bool hasValueAfter(Height height) const {
+			return !m_heightValueMap.empty() && m_heightValueMap.cbegin()->first > height;
+		}
+
 		/// Returns \c true if \a predicate returns \c true for any historical value.
 		bool anyOf(const predicate<const TValue&>& predicate) const {
 			return std::any_of(m_heightValueMap.cbegin(), m_heightValueMap.cend(), [predicate](const auto& pair) {
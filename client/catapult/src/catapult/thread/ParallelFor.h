@@ -22,6 +22,9 @@
 #pragma once
 #include "Future.h"
 #include <boost/asio.hpp>
+#include <memory>
+#include <numeric>
+#include <vector>
 
 namespace catapult { namespace thread {
 
@@ -126,4 +129,17 @@ namespace catapult { namespace thread {
 			}
 		});
 	}
+
+	/// Uses \a ioContext to call \a callback once for each partition index less than \a numPartitions (possibly concurrently).
+	/// Future is returned that is resolved when all partitions have been processed.
+	template<typename TWorkCallback>
+	thread::future<bool> ParallelForPartitionIndexes(boost::asio::io_context& ioContext, size_t numPartitions, TWorkCallback callback) {
+		// partition indexes are captured by the work callback, which keeps them alive until all partitions have been processed
+		auto pPartitionIndexes = std::make_shared<std::vector<size_t>>(numPartitions);
+		std::iota(pPartitionIndexes->begin(), pPartitionIndexes->end(), static_cast<size_t>(0));
+		return ParallelFor(ioContext, *pPartitionIndexes, numPartitions, [pPartitionIndexes, callback](auto partitionIndex, auto) {
+			callback(partitionIndex);
+			return true;
+		});
+	}
 }}
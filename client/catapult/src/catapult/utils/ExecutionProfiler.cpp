@@ -0,0 +1,93 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ExecutionProfiler.h"
+
+namespace catapult { namespace utils {
+
+	// region ExecutionStatistics
+
+	ExecutionStatistics::ExecutionStatistics(const std::string& name)
+			: m_name(name)
+			, m_totalElapsed(0)
+	{}
+
+	const std::string& ExecutionStatistics::name() const {
+		return m_name;
+	}
+
+	uint64_t ExecutionStatistics::count() const {
+		return m_latencies.count();
+	}
+
+	uint64_t ExecutionStatistics::totalElapsed() const {
+		return m_totalElapsed.load(std::memory_order_relaxed);
+	}
+
+	const LatencyHistogram& ExecutionStatistics::latencies() const {
+		return m_latencies;
+	}
+
+	void ExecutionStatistics::record(uint64_t elapsed) {
+		m_latencies.record(elapsed);
+		m_totalElapsed.fetch_add(elapsed, std::memory_order_relaxed);
+	}
+
+	// endregion
+
+	// region ExecutionProfiler
+
+	ExecutionStatistics& ExecutionProfiler::statistics(const std::string& name) {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto& pStatistics = m_statisticsMap[name];
+		if (!pStatistics)
+			pStatistics = std::make_unique<ExecutionStatistics>(name);
+
+		return *pStatistics;
+	}
+
+	std::vector<const ExecutionStatistics*> ExecutionProfiler::statistics() const {
+		std::lock_guard<std::mutex> guard(m_mutex);
+		std::vector<const ExecutionStatistics*> statistics;
+		for (const auto& pair : m_statisticsMap)
+			statistics.push_back(pair.second.get());
+
+		return statistics;
+	}
+
+	uint64_t ExecutionProfiler::totalCount() const {
+		uint64_t count = 0;
+		for (const auto* pStatistics : statistics())
+			count += pStatistics->count();
+
+		return count;
+	}
+
+	uint64_t ExecutionProfiler::totalElapsed() const {
+		uint64_t elapsed = 0;
+		for (const auto* pStatistics : statistics())
+			elapsed += pStatistics->totalElapsed();
+
+		return elapsed;
+	}
+
+	// endregion
+}}
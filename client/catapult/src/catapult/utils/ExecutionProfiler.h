@@ -0,0 +1,104 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "LatencyHistogram.h"
+#include "NonCopyable.h"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Execution statistics of a single named operation.
+	class ExecutionStatistics : NonCopyable {
+	public:
+		/// Creates statistics for the operation with \a name.
+		explicit ExecutionStatistics(const std::string& name);
+
+	public:
+		/// Gets the operation name.
+		const std::string& name() const;
+
+		/// Gets the number of recorded executions.
+		uint64_t count() const;
+
+		/// Gets the cumulative elapsed time of all recorded executions (in nanoseconds).
+		uint64_t totalElapsed() const;
+
+		/// Gets the histogram of elapsed times (in nanoseconds).
+		const LatencyHistogram& latencies() const;
+
+	public:
+		/// Records an execution that took \a elapsed nanoseconds.
+		void record(uint64_t elapsed);
+
+	private:
+		std::string m_name;
+		LatencyHistogram m_latencies;
+		std::atomic<uint64_t> m_totalElapsed;
+	};
+
+	/// Profiler that collects execution statistics for named operations.
+	/// \note Statistics are added when instrumented objects are built, but can be recorded and read concurrently.
+	class ExecutionProfiler : NonCopyable {
+	public:
+		/// Gets the statistics of the operation with \a name, adding them when not present.
+		ExecutionStatistics& statistics(const std::string& name);
+
+		/// Gets the statistics of all operations ordered by name.
+		std::vector<const ExecutionStatistics*> statistics() const;
+
+		/// Gets the number of recorded executions across all operations.
+		uint64_t totalCount() const;
+
+		/// Gets the cumulative elapsed time across all operations (in nanoseconds).
+		uint64_t totalElapsed() const;
+
+	private:
+		std::map<std::string, std::unique_ptr<ExecutionStatistics>> m_statisticsMap;
+		mutable std::mutex m_mutex;
+	};
+
+	/// Records the lifetime of a timer into execution statistics.
+	class ExecutionTimer : NonCopyable {
+	public:
+		/// Creates a timer that records into \a statistics.
+		explicit ExecutionTimer(ExecutionStatistics& statistics)
+				: m_statistics(statistics)
+				, m_start(std::chrono::steady_clock::now())
+		{}
+
+		/// Destroys the timer and records the elapsed time.
+		~ExecutionTimer() {
+			auto elapsed = std::chrono::steady_clock::now() - m_start;
+			m_statistics.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+		}
+
+	private:
+		ExecutionStatistics& m_statistics;
+		std::chrono::steady_clock::time_point m_start;
+	};
+}}
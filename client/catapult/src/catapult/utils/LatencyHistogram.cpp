@@ -0,0 +1,113 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "LatencyHistogram.h"
+#include "IntegerMath.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	LatencyHistogram::LatencyHistogram() {
+		reset();
+	}
+
+	uint64_t LatencyHistogram::count() const {
+		return m_count.load(std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::max() const {
+		return m_max.load(std::memory_order_relaxed);
+	}
+
+	uint64_t LatencyHistogram::percentile(uint32_t percentile) const {
+		if (percentile > 100)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("percentile must be no greater than 100", percentile);
+
+		// buckets can be updated while they are read, so use the sum of the buckets instead of m_count
+		uint64_t totalCount = 0;
+		for (const auto& bucket : m_buckets)
+			totalCount += bucket.load(std::memory_order_relaxed);
+
+		if (0 == totalCount)
+			return 0;
+
+		// find the first bucket at which the cumulative count reaches the (rounded up) rank of the percentile
+		auto rank = std::max<uint64_t>(1, (totalCount * percentile + 99) / 100);
+		uint64_t cumulativeCount = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			cumulativeCount += m_buckets[i].load(std::memory_order_relaxed);
+			if (cumulativeCount >= rank)
+				return std::min(BucketUpperBound(i), max());
+		}
+
+		return max();
+	}
+
+	void LatencyHistogram::record(uint64_t value) {
+		m_buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		m_count.fetch_add(1, std::memory_order_relaxed);
+		updateMax(value);
+	}
+
+	void LatencyHistogram::merge(const LatencyHistogram& histogram) {
+		for (auto i = 0u; i < Num_Buckets; ++i)
+			m_buckets[i].fetch_add(histogram.m_buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+		m_count.fetch_add(histogram.count(), std::memory_order_relaxed);
+		updateMax(histogram.max());
+	}
+
+	void LatencyHistogram::reset() {
+		for (auto& bucket : m_buckets)
+			bucket.store(0, std::memory_order_relaxed);
+
+		m_count.store(0, std::memory_order_relaxed);
+		m_max.store(0, std::memory_order_relaxed);
+	}
+
+	void LatencyHistogram::updateMax(uint64_t value) {
+		auto currentMax = m_max.load(std::memory_order_relaxed);
+		while (currentMax < value && !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+		{}
+	}
+
+	uint32_t LatencyHistogram::BucketIndex(uint64_t value) {
+		// small values are stored exactly
+		if (value < Num_Sub_Buckets)
+			return static_cast<uint32_t>(value);
+
+		// larger values are stored in the sub-bucket selected by the bits immediately following the most significant bit
+		auto shift = static_cast<uint32_t>(Log2(value)) - Sub_Bucket_Bits;
+		auto subBucketIndex = static_cast<uint32_t>(value >> shift) & (Num_Sub_Buckets - 1);
+		return (shift + 1) * Num_Sub_Buckets + subBucketIndex;
+	}
+
+	uint64_t LatencyHistogram::BucketUpperBound(uint32_t bucketIndex) {
+		if (bucketIndex < Num_Sub_Buckets)
+			return bucketIndex;
+
+		auto shift = bucketIndex / Num_Sub_Buckets - 1;
+		auto subBucketIndex = static_cast<uint64_t>(bucketIndex % Num_Sub_Buckets);
+		auto lowerBound = (Num_Sub_Buckets + subBucketIndex) << shift;
+		return lowerBound + ((uint64_t(1) << shift) - 1);
+	}
+}}
@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Lock-free histogram of latency values with logarithmic buckets and linear sub-buckets.
+	/// \note Values are bucketed with a relative precision of 1 / Num_Sub_Buckets.
+	///       Recording is wait-free and can happen concurrently with reading.
+	class LatencyHistogram {
+	public:
+		/// Number of bits used for linear sub-buckets.
+		static constexpr uint32_t Sub_Bucket_Bits = 3;
+
+		/// Number of linear sub-buckets within each power of two range.
+		static constexpr uint32_t Num_Sub_Buckets = 1u << Sub_Bucket_Bits;
+
+		/// Total number of buckets.
+		static constexpr uint32_t Num_Buckets = (64 - Sub_Bucket_Bits + 1) * Num_Sub_Buckets;
+
+	public:
+		/// Creates an empty histogram.
+		LatencyHistogram();
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the largest recorded value.
+		uint64_t max() const;
+
+		/// Gets the (approximate) value below or at which \a percentile percent of the recorded values fall.
+		/// \note The highest value equivalent to the value at the requested percentile is returned.
+		uint64_t percentile(uint32_t percentile) const;
+
+	public:
+		/// Records \a value.
+		void record(uint64_t value);
+
+		/// Adds all values recorded in \a histogram.
+		void merge(const LatencyHistogram& histogram);
+
+		/// Removes all recorded values.
+		/// \note Values recorded concurrently with a reset might be partially removed.
+		void reset();
+
+	public:
+		/// Gets the index of the bucket containing \a value.
+		static uint32_t BucketIndex(uint64_t value);
+
+		/// Gets the highest value contained in the bucket with index \a bucketIndex.
+		static uint64_t BucketUpperBound(uint32_t bucketIndex);
+
+	private:
+		void updateMax(uint64_t value);
+
+	private:
+		std::array<std::atomic<uint64_t>, Num_Buckets> m_buckets;
+		std::atomic<uint64_t> m_count;
+		std::atomic<uint64_t> m_max;
+	};
+}}
@@ -0,0 +1,106 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "WindowedLatencyHistogram.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	WindowedLatencyHistogram::WindowedLatencyHistogram(const TimeSpan& windowDuration)
+			: WindowedLatencyHistogram(windowDuration, Clock::now)
+	{}
+
+	WindowedLatencyHistogram::WindowedLatencyHistogram(const TimeSpan& windowDuration, const TimeSupplier& timeSupplier)
+			: m_windowMillis(windowDuration.millis())
+			, m_timeSupplier(timeSupplier)
+			, m_startTime(m_timeSupplier()) {
+		if (0 == m_windowMillis)
+			CATAPULT_THROW_INVALID_ARGUMENT("window duration must be nonzero");
+	}
+
+	uint64_t WindowedLatencyHistogram::count() const {
+		uint64_t count = 0;
+		forEachReportedWindow([&count](const auto& histogram) {
+			count += histogram.count();
+		});
+		return count;
+	}
+
+	uint64_t WindowedLatencyHistogram::max() const {
+		uint64_t max = 0;
+		forEachReportedWindow([&max](const auto& histogram) {
+			max = std::max(max, histogram.max());
+		});
+		return max;
+	}
+
+	uint64_t WindowedLatencyHistogram::percentile(uint32_t percentile) const {
+		LatencyHistogram mergedHistogram;
+		forEachReportedWindow([&mergedHistogram](const auto& histogram) {
+			mergedHistogram.merge(histogram);
+		});
+		return mergedHistogram.percentile(percentile);
+	}
+
+	void WindowedLatencyHistogram::record(uint64_t value) {
+		record(value, m_timeSupplier());
+	}
+
+	void WindowedLatencyHistogram::record(uint64_t value, Clock::time_point recordTime) {
+		auto recordWindowIndex = windowIndex(recordTime);
+		auto& window = m_windows[recordWindowIndex % m_windows.size()];
+
+		auto slotWindowIndex = window.Index.load();
+		while (slotWindowIndex < recordWindowIndex) {
+			// the window slot still contains values from an older window, so only the writer that claims it discards them
+			// (notice that values recorded concurrently by other writers in the new window might be partially discarded too)
+			if (window.Index.compare_exchange_weak(slotWindowIndex, recordWindowIndex)) {
+				window.Histogram.reset();
+				slotWindowIndex = recordWindowIndex;
+			}
+		}
+
+		// the window slot has already been claimed by a newer window, so the value is too old to be reported
+		if (slotWindowIndex != recordWindowIndex)
+			return;
+
+		window.Histogram.record(value);
+	}
+
+	uint64_t WindowedLatencyHistogram::windowIndex(Clock::time_point timePoint) const {
+		if (timePoint <= m_startTime)
+			return 0;
+
+		auto elapsedMillis = std::chrono::duration_cast<std::chrono::milliseconds>(timePoint - m_startTime).count();
+		return static_cast<uint64_t>(elapsedMillis) / m_windowMillis;
+	}
+
+	template<typename TAction>
+	void WindowedLatencyHistogram::forEachReportedWindow(TAction action) const {
+		auto currentWindowIndex = windowIndex(m_timeSupplier());
+		for (const auto& window : m_windows) {
+			// only report the current and previous windows
+			if (window.Index.load() + 1 >= currentWindowIndex)
+				action(window.Histogram);
+		}
+	}
+}}
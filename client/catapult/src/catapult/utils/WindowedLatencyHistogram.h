@@ -0,0 +1,85 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "LatencyHistogram.h"
+#include "TimeSpan.h"
+#include "catapult/functions.h"
+#include <atomic>
+#include <chrono>
+
+namespace catapult { namespace utils {
+
+	/// Latency histogram that only reports values recorded in the current and previous time windows.
+	/// \note Reported values cover between one and two windows, so values recorded earlier stop affecting them.
+	///       Recording is lock-free and can happen concurrently with reading.
+	class WindowedLatencyHistogram {
+	public:
+		/// Clock used for determining windows.
+		using Clock = std::chrono::steady_clock;
+
+		/// Supplier of the current time.
+		using TimeSupplier = supplier<Clock::time_point>;
+
+	public:
+		/// Creates an empty histogram with windows of \a windowDuration.
+		explicit WindowedLatencyHistogram(const TimeSpan& windowDuration);
+
+		/// Creates an empty histogram with windows of \a windowDuration using \a timeSupplier to get the current time.
+		WindowedLatencyHistogram(const TimeSpan& windowDuration, const TimeSupplier& timeSupplier);
+
+	public:
+		/// Gets the number of values recorded in the reported windows.
+		uint64_t count() const;
+
+		/// Gets the largest value recorded in the reported windows.
+		uint64_t max() const;
+
+		/// Gets the (approximate) value below or at which \a percentile percent of the values recorded in the reported windows fall.
+		uint64_t percentile(uint32_t percentile) const;
+
+	public:
+		/// Records \a value in the current window.
+		void record(uint64_t value);
+
+		/// Records \a value in the window containing \a recordTime.
+		/// \note Values recorded at times within windows that are no longer reported are dropped.
+		void record(uint64_t value, Clock::time_point recordTime);
+
+	private:
+		uint64_t windowIndex(Clock::time_point timePoint) const;
+
+		template<typename TAction>
+		void forEachReportedWindow(TAction action) const;
+
+	private:
+		struct Window {
+			LatencyHistogram Histogram;
+			std::atomic<uint64_t> Index = 0;
+		};
+
+	private:
+		uint64_t m_windowMillis;
+		TimeSupplier m_timeSupplier;
+		Clock::time_point m_startTime;
+		std::array<Window, 2> m_windows;
+	};
+}}
@@ -22,6 +22,7 @@
 #pragma once
 #include "AggregateValidatorBuilder.h"
 #include "ValidatorTypes.h"
+#include "catapult/utils/ExecutionProfiler.h"
 #include <functional>
 #include <vector>
 
@@ -36,10 +37,20 @@ namespace catapult { namespace validators {
 		using NotificationValidatorPredicate = predicate<const model::Notification&>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+	public:
+		/// Creates a builder.
+		DemuxValidatorBuilderT() : m_pProfiler(nullptr)
+		{}
+
+		/// Creates a builder that records execution statistics of all added validators in \a profiler.
+		explicit DemuxValidatorBuilderT(utils::ExecutionProfiler& profiler) : m_pProfiler(&profiler)
+		{}
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
+			pValidator = profile(std::move(pValidator));
 			if constexpr (!std::is_same_v<model::Notification, TNotification>) {
 				auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
 					return model::AreEqualExcludingChannel(type, notification.Type);
@@ -63,6 +74,15 @@ namespace catapult { namespace validators {
 		}
 
 	private:
+		template<typename TNotification>
+		NotificationValidatorPointerT<TNotification> profile(NotificationValidatorPointerT<TNotification>&& pValidator) {
+			if (!m_pProfiler)
+				return std::move(pValidator);
+
+			auto& statistics = m_pProfiler->statistics(pValidator->name());
+			return std::make_unique<ProfilingValidator<TNotification>>(std::move(pValidator), statistics);
+		}
+
 		template<typename TNotification>
 		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
 		public:
@@ -90,7 +110,31 @@ namespace catapult { namespace validators {
 			NotificationValidatorPredicate m_predicate;
 		};
 
+		template<typename TNotification>
+		class ProfilingValidator : public NotificationValidatorT<TNotification, TArgs...> {
+		public:
+			ProfilingValidator(NotificationValidatorPointerT<TNotification>&& pValidator, utils::ExecutionStatistics& statistics)
+					: m_pValidator(std::move(pValidator))
+					, m_statistics(statistics)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			ValidationResult validate(const TNotification& notification, TArgs&&... args) const override {
+				utils::ExecutionTimer timer(m_statistics);
+				return m_pValidator->validate(notification, std::forward<TArgs>(args)...);
+			}
+
+		private:
+			NotificationValidatorPointerT<TNotification> m_pValidator;
+			utils::ExecutionStatistics& m_statistics;
+		};
+
 	private:
+		utils::ExecutionProfiler* m_pProfiler;
 		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
 	};
 }}
@@ -55,6 +55,23 @@ namespace catapult { namespace crypto {
 
 		// endregion
 
+		// region batch traits
+
+		struct Sha3_256_Sequential_BatchTraits {
+			static void HashFunc(const std::vector<RawBuffer>& buffers, std::vector<Hash256>& hashes) {
+				for (auto i = 0u; i < buffers.size(); ++i)
+					Sha3_256(buffers[i], hashes[i]);
+			}
+		};
+
+		struct Sha3_256_Multi_BatchTraits {
+			static void HashFunc(const std::vector<RawBuffer>& buffers, std::vector<Hash256>& hashes) {
+				Sha3_256Multi(buffers.data(), buffers.size(), hashes.data());
+			}
+		};
+
+		// endregion
+
 		template<typename TTraits>
 		void BenchmarkHasher(benchmark::State& state) {
 			std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)));
@@ -70,10 +87,36 @@ namespace catapult { namespace crypto {
 			state.SetBytesProcessed(static_cast<int64_t>(buffer.size()) * state.iterations());
 		}
 
+		template<typename TTraits>
+		void BenchmarkBatchHasher(benchmark::State& state) {
+			constexpr auto Batch_Size = 1000u;
+			std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)) * Batch_Size);
+			std::vector<RawBuffer> buffers;
+			for (auto i = 0u; i < Batch_Size; ++i)
+				buffers.push_back({ buffer.data() + i * static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(0)) });
+
+			std::vector<Hash256> hashes(Batch_Size);
+			for (auto _ : state) {
+				state.PauseTiming();
+				bench::FillWithRandomData(buffer);
+				state.ResumeTiming();
+
+				TTraits::HashFunc(buffers, hashes);
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(buffer.size()) * state.iterations());
+		}
+
 		void AddDefaultArguments(benchmark::internal::Benchmark& benchmark) {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		void AddBatchArguments(benchmark::internal::Benchmark& benchmark) {
+			// small messages, similar to merkle tree nodes and typical transactions
+			for (auto arg : { 64, 256, 1024 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
 	}
 }}
 
@@ -82,6 +125,9 @@ namespace catapult { namespace crypto {
 #define CATAPULT_REGISTER_HASHER_BENCHMARK(TRAITS_NAME) \
 	catapult::crypto::AddDefaultArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkHasher<catapult::crypto::TRAITS_NAME>))
 
+#define CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(TRAITS_NAME) \
+	catapult::crypto::AddBatchArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkBatchHasher<catapult::crypto::TRAITS_NAME>))
+
 void RegisterTests();
 void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Ripemd160_Traits);
@@ -89,4 +135,7 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(Sha3_256_Sequential_BatchTraits);
+	CATAPULT_REGISTER_BATCH_HASHER_BENCHMARK(Sha3_256_Multi_BatchTraits);
 }
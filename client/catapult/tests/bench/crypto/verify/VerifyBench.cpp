@@ -19,11 +19,13 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
+#include "catapult/crypto/CryptoUtils.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/utils/RandomGenerator.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
+#include <donna/catapult.h>
 
 namespace catapult { namespace crypto {
 
@@ -90,6 +92,23 @@ namespace catapult { namespace crypto {
 			if (0 != numFailures)
 				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
 		}
+
+		void BenchmarkUnpackNegativeAndCheckSubgroup(benchmark::State& state) {
+			auto numFailures = 0u;
+			ge25519 ALIGN(16) A;
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto keyPair = CreateRandomKeyPair();
+				state.ResumeTiming();
+
+				if (!crypto::UnpackNegativeAndCheckSubgroup(A, keyPair.publicKey()))
+					++numFailures;
+			}
+
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " calls to UnpackNegativeAndCheckSubgroup failed";
+		}
 	}
 }}
 
@@ -108,4 +127,11 @@ void RegisterTests() {
 			->Threads(2)
 			->Threads(4)
 			->Threads(8);
+
+	benchmark::RegisterBenchmark("BenchmarkUnpackNegativeAndCheckSubgroup", catapult::crypto::BenchmarkUnpackNegativeAndCheckSubgroup)
+			->UseRealTime()
+			->Threads(1)
+			->Threads(2)
+			->Threads(4)
+			->Threads(8);
 }
@@ -0,0 +1,198 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/state/AccountState.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		constexpr auto Num_Original_Accounts = 100'000u;
+		constexpr auto Num_Delta_Accounts = 1'000u;
+		constexpr MosaicId Currency_Mosaic_Id(1111);
+		constexpr MosaicId Harvesting_Mosaic_Id(9876);
+
+		struct AccountStateToKeyConverter {
+			static constexpr auto ToKey(const state::AccountState& accountState) {
+				return accountState.Address;
+			}
+		};
+
+		template<typename TMapStoragePolicy>
+		using AccountStateMap = typename TMapStoragePolicy::template MapType<
+			Address,
+			state::AccountState,
+			utils::ArrayHasher<Address>>;
+
+		template<typename TMapStoragePolicy>
+		using AccountStateBaseSet = BaseSet<
+			MutableTypeTraits<state::AccountState>,
+			MapStorageTraits<AccountStateMap<TMapStoragePolicy>, AccountStateToKeyConverter>>;
+
+		// region BenchmarkContext
+
+		template<typename TMapStoragePolicy>
+		class BenchmarkContext {
+		public:
+			BenchmarkContext() : m_originalAddresses(GenerateAddresses(Num_Original_Accounts)) {
+				auto pDelta = m_set.rebase();
+				for (const auto& address : m_originalAddresses)
+					pDelta->insert(CreateAccountState(address));
+
+				m_set.commit();
+			}
+
+		public:
+			const std::vector<Address>& originalAddresses() const {
+				return m_originalAddresses;
+			}
+
+			AccountStateBaseSet<TMapStoragePolicy>& set() {
+				return m_set;
+			}
+
+		public:
+			static std::vector<Address> GenerateAddresses(size_t count) {
+				std::vector<Address> addresses(count);
+				for (auto& address : addresses)
+					bench::FillWithRandomData(address);
+
+				return addresses;
+			}
+
+			static state::AccountState CreateAccountState(const Address& address) {
+				auto accountState = state::AccountState(address, Height(1));
+				accountState.Balances.credit(Currency_Mosaic_Id, Amount(bench::Random() % 1'000'000));
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Amount(bench::Random() % 1'000'000));
+				return accountState;
+			}
+
+		private:
+			std::vector<Address> m_originalAddresses;
+			AccountStateBaseSet<TMapStoragePolicy> m_set;
+		};
+
+		template<typename TMapStoragePolicy>
+		BenchmarkContext<TMapStoragePolicy>& GetBenchmarkContext() {
+			static BenchmarkContext<TMapStoragePolicy> context;
+			return context;
+		}
+
+		std::vector<Address> SelectAddresses(const std::vector<Address>& addresses, size_t count) {
+			std::vector<Address> selectedAddresses;
+			for (auto i = 0u; i < count; ++i)
+				selectedAddresses.push_back(addresses[bench::Random() % addresses.size()]);
+
+			return selectedAddresses;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TMapStoragePolicy>
+		void BenchmarkFind(benchmark::State& state) {
+			auto& context = GetBenchmarkContext<TMapStoragePolicy>();
+			const auto& set = context.set();
+			auto addresses = SelectAddresses(context.originalAddresses(), Num_Delta_Accounts);
+
+			for (auto _ : state) {
+				for (const auto& address : addresses)
+					benchmark::DoNotOptimize(set.find(address).get());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * addresses.size()));
+		}
+
+		template<typename TMapStoragePolicy>
+		void BenchmarkDeltaFindMutable(benchmark::State& state) {
+			auto& context = GetBenchmarkContext<TMapStoragePolicy>();
+			auto addresses = SelectAddresses(context.originalAddresses(), Num_Delta_Accounts);
+
+			for (auto _ : state) {
+				auto pDelta = context.set().rebaseDetached();
+				for (const auto& address : addresses)
+					benchmark::DoNotOptimize(pDelta->find(address).get());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * addresses.size()));
+		}
+
+		template<typename TMapStoragePolicy>
+		void BenchmarkDeltaInsert(benchmark::State& state) {
+			auto& context = GetBenchmarkContext<TMapStoragePolicy>();
+			std::vector<state::AccountState> accountStates;
+			for (const auto& address : context.GenerateAddresses(Num_Delta_Accounts))
+				accountStates.push_back(context.CreateAccountState(address));
+
+			for (auto _ : state) {
+				auto pDelta = context.set().rebaseDetached();
+				for (const auto& accountState : accountStates)
+					pDelta->insert(accountState);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * accountStates.size()));
+		}
+
+		template<typename TMapStoragePolicy>
+		void BenchmarkCommit(benchmark::State& state) {
+			auto& context = GetBenchmarkContext<TMapStoragePolicy>();
+			auto addresses = SelectAddresses(context.originalAddresses(), Num_Delta_Accounts);
+
+			for (auto _ : state) {
+				auto pDelta = context.set().rebase();
+				for (const auto& address : addresses)
+					pDelta->find(address).get()->Balances.credit(Currency_Mosaic_Id, Amount(1));
+
+				context.set().commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * addresses.size()));
+		}
+
+		// endregion
+	}
+}}
+
+#define REGISTER_BENCHMARK(BENCH_NAME) benchmark::RegisterBenchmark(#BENCH_NAME, BENCH_NAME)
+
+#define CATAPULT_REGISTER_BASE_SET_BENCHMARK(BENCH_NAME, POLICY_NAME) \
+	REGISTER_BENCHMARK(catapult::deltaset::BENCH_NAME<catapult::deltaset::POLICY_NAME>)
+
+void RegisterTests();
+void RegisterTests() {
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkFind, UnorderedMapStoragePolicy);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkFind, FlatMapStoragePolicy);
+
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkDeltaFindMutable, UnorderedMapStoragePolicy);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkDeltaFindMutable, FlatMapStoragePolicy);
+
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkDeltaInsert, UnorderedMapStoragePolicy);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkDeltaInsert, FlatMapStoragePolicy);
+
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkCommit, UnorderedMapStoragePolicy);
+	CATAPULT_REGISTER_BASE_SET_BENCHMARK(BenchmarkCommit, FlatMapStoragePolicy);
+}
@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/Transaction.h"
+#include "catapult/utils/Logging.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		constexpr auto Disruptor_Slot_Count = 64u * 1024;
+
+		std::unique_ptr<ConsumerDispatcher> g_pDispatcher;
+
+		ConsumerInput CreateTransactionInput() {
+			uint8_t* pRangeData;
+			auto range = model::TransactionRange::PrepareFixed(1, &pRangeData);
+			auto& transaction = reinterpret_cast<model::Transaction&>(*pRangeData);
+			transaction.Size = sizeof(model::Transaction);
+			return ConsumerInput(std::move(range));
+		}
+
+		void BenchmarkProcessElement(benchmark::State& state) {
+			if (0 == state.thread_index()) {
+				auto options = ConsumerDispatcherOptions("bench dispatcher", Disruptor_Slot_Count);
+				options.ShouldThrowWhenFull = false;
+				g_pDispatcher = std::make_unique<ConsumerDispatcher>(options, std::vector<DisruptorConsumer>{
+					[](const auto&) { return ConsumerResult::Continue(); },
+					[](const auto&) { return ConsumerResult::Continue(); }
+				});
+			}
+
+			auto numRejected = 0u;
+			for (auto _ : state) {
+				// a zero id indicates the input was rejected because the dispatcher is full
+				if (0 == g_pDispatcher->processElement(CreateTransactionInput()))
+					++numRejected;
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() - numRejected));
+			if (0 != numRejected)
+				CATAPULT_LOG(warning) << numRejected << " calls to processElement were rejected";
+
+			if (0 == state.thread_index())
+				g_pDispatcher.reset();
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkProcessElement", catapult::disruptor::BenchmarkProcessElement)
+			->UseRealTime()
+			->Threads(1)
+			->Threads(2)
+			->Threads(4)
+			->Threads(8)
+			->Threads(16)
+			->Threads(32);
+}
@@ -0,0 +1,153 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "plugins/coresystem/src/importance/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockchainConfiguration.h"
+#include "catapult/state/AccountActivityBuckets.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <thread>
+
+namespace catapult { namespace importance {
+
+	namespace {
+		constexpr auto Num_High_Value_Accounts = 1'000'000u;
+		constexpr auto Num_Seeded_Activity_Buckets = 3u;
+		constexpr Amount Min_Harvester_Balance(1'000'000);
+
+		model::BlockchainConfiguration CreateBlockchainConfiguration() {
+			auto config = model::BlockchainConfiguration::Uninitialized();
+			config.CurrencyMosaicId = MosaicId(1111);
+			config.HarvestingMosaicId = MosaicId(9876);
+			config.ImportanceGrouping = 1;
+			config.VotingSetGrouping = 1;
+			config.TotalChainImportance = Importance(8'999'999'998'000'000);
+			config.ImportanceActivityPercentage = 5;
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			config.MaxHarvesterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			config.MinVoterBalance = Amount(std::numeric_limits<Amount::ValueType>::max());
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateAccountStateCacheOptions(const model::BlockchainConfiguration& config) {
+			return {
+				model::NetworkIdentifier::Testnet,
+				config.ImportanceGrouping,
+				config.VotingSetGrouping,
+				config.MinHarvesterBalance,
+				config.MaxHarvesterBalance,
+				config.MinVoterBalance,
+				config.CurrencyMosaicId,
+				config.HarvestingMosaicId
+			};
+		}
+
+		// region BenchmarkCache
+
+		class BenchmarkCache {
+		public:
+			BenchmarkCache()
+					: m_config(CreateBlockchainConfiguration())
+					, m_cache(cache::CacheConfiguration(), CreateAccountStateCacheOptions(m_config))
+					, m_delta(m_cache.createDelta())
+					, m_importanceHeight(Num_Seeded_Activity_Buckets) {
+				for (auto i = 0u; i < Num_High_Value_Accounts; ++i)
+					addAccount();
+
+				m_delta->updateHighValueAccounts(Height(1));
+			}
+
+		public:
+			const model::BlockchainConfiguration& config() const {
+				return m_config;
+			}
+
+		public:
+			void recalculate(const ImportanceCalculator& calculator) {
+				// each recalculation needs to be at a new importance height
+				m_importanceHeight = m_importanceHeight + model::ImportanceHeight(1);
+				calculator.recalculate(ImportanceRollbackMode::Disabled, m_importanceHeight, *m_delta);
+			}
+
+		private:
+			void addAccount() {
+				Address address;
+				bench::FillWithRandomData(address);
+				m_delta->addAccount(address, Height(1));
+
+				auto& accountState = m_delta->find(address).get();
+				auto balance = Amount(Min_Harvester_Balance.unwrap() * (1 + bench::Random() % 100));
+				accountState.Balances.credit(m_config.HarvestingMosaicId, balance);
+				for (auto i = 1u; i <= Num_Seeded_Activity_Buckets; ++i) {
+					accountState.ActivityBuckets.update(model::ImportanceHeight(i), [](auto& bucket) {
+						bucket.TotalFeesPaid = Amount(bench::Random() % 1'000);
+						bucket.BeneficiaryCount = static_cast<uint32_t>(bench::Random() % 10);
+					});
+				}
+			}
+
+		private:
+			model::BlockchainConfiguration m_config;
+			cache::AccountStateCache m_cache;
+			cache::LockedCacheDelta<cache::AccountStateCacheDelta> m_delta;
+			model::ImportanceHeight m_importanceHeight;
+		};
+
+		BenchmarkCache& GetBenchmarkCache() {
+			static BenchmarkCache cache;
+			return cache;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkRecalculate(benchmark::State& state) {
+			auto& benchmarkCache = GetBenchmarkCache();
+			auto numWorkerThreads = static_cast<uint32_t>(state.range(0));
+			auto pCalculator = CreateImportanceCalculator(benchmarkCache.config(), numWorkerThreads, 0);
+
+			for (auto _ : state)
+				benchmarkCache.recalculate(*pCalculator);
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_High_Value_Accounts));
+		}
+
+		void AddThreadArguments(benchmark::internal::Benchmark& benchmark) {
+			auto maxNumWorkerThreads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+			for (int64_t numWorkerThreads = 1; numWorkerThreads < maxNumWorkerThreads; numWorkerThreads *= 2)
+				benchmark.Arg(numWorkerThreads);
+
+			benchmark.Arg(maxNumWorkerThreads)->UseRealTime()->Unit(benchmark::kMillisecond);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	catapult::importance::AddThreadArguments(*benchmark::RegisterBenchmark(
+			"BenchmarkRecalculate",
+			catapult::importance::BenchmarkRecalculate));
+}
@@ -0,0 +1,144 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/model/Block.h"
+#include "catapult/model/Elements.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Blocks = 1000u;
+		constexpr auto Num_Transactions_Per_Block = 100u;
+		constexpr auto Transaction_Size = 256u;
+		constexpr auto File_Database_Batch_Size = 100u;
+
+		// region BenchmarkStorage
+
+		class BenchmarkStorage {
+		public:
+			BenchmarkStorage()
+					: m_directory((std::filesystem::temp_directory_path() / "catapult.bench.io.blockstorage").generic_string()) {
+				std::filesystem::remove_all(m_directory);
+				std::filesystem::create_directories(m_directory);
+
+				FileBlockStorage storage(m_directory, File_Database_Batch_Size, FileBlockStorageMode::None);
+				for (auto i = 1u; i <= Num_Blocks; ++i)
+					saveBlock(storage, Height(i));
+			}
+
+			~BenchmarkStorage() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			const std::string& directory() const {
+				return m_directory;
+			}
+
+			uint64_t chainBytes() const {
+				return static_cast<uint64_t>(m_chainBytes);
+			}
+
+		private:
+			void saveBlock(FileBlockStorage& storage, Height height) {
+				auto blockHeaderSize = model::GetBlockHeaderSize(model::Entity_Type_Block_Normal);
+				auto blockSize = blockHeaderSize + Num_Transactions_Per_Block * Transaction_Size;
+
+				std::vector<uint8_t> buffer(blockSize);
+				bench::FillWithRandomData(buffer);
+
+				auto& block = reinterpret_cast<model::Block&>(buffer[0]);
+				block.Size = blockSize;
+				block.Type = model::Entity_Type_Block_Normal;
+				block.Version = model::Block::Current_Version;
+				block.Height = height;
+
+				for (auto i = 0u; i < Num_Transactions_Per_Block; ++i)
+					reinterpret_cast<model::Transaction&>(buffer[blockHeaderSize + i * Transaction_Size]).Size = Transaction_Size;
+
+				model::BlockElement blockElement(block);
+				for (const auto& transaction : block.Transactions())
+					blockElement.Transactions.push_back(model::TransactionElement(transaction));
+
+				storage.saveBlock(blockElement);
+				m_chainBytes += blockSize;
+			}
+
+		private:
+			std::string m_directory;
+			size_t m_chainBytes = 0;
+		};
+
+		const BenchmarkStorage& GetBenchmarkStorage() {
+			static BenchmarkStorage storage;
+			return storage;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		template<typename TLoad>
+		void BenchmarkLoadChain(benchmark::State& state, FileBlockStorageReadMode readMode, TLoad load) {
+			const auto& benchmarkStorage = GetBenchmarkStorage();
+			FileBlockStorage storage(benchmarkStorage.directory(), File_Database_Batch_Size, FileBlockStorageMode::None, readMode);
+
+			for (auto _ : state) {
+				for (auto i = 1u; i <= Num_Blocks; ++i)
+					benchmark::DoNotOptimize(load(storage, Height(i)));
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Blocks));
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * benchmarkStorage.chainBytes()));
+		}
+
+		void BenchmarkLoadBlock(benchmark::State& state, FileBlockStorageReadMode readMode) {
+			BenchmarkLoadChain(state, readMode, [](const auto& storage, auto height) {
+				return storage.loadBlock(height);
+			});
+		}
+
+		void BenchmarkLoadBlockElement(benchmark::State& state, FileBlockStorageReadMode readMode) {
+			BenchmarkLoadChain(state, readMode, [](const auto& storage, auto height) {
+				return storage.loadBlockElement(height);
+			});
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::io::FileBlockStorageReadMode;
+
+	for (auto readMode : { FileBlockStorageReadMode::Stream, FileBlockStorageReadMode::Memory_Mapped }) {
+		auto suffix = std::string(FileBlockStorageReadMode::Stream == readMode ? "Stream" : "MemoryMapped");
+		benchmark::RegisterBenchmark(("BenchmarkLoadBlock/" + suffix).c_str(), catapult::io::BenchmarkLoadBlock, readMode)
+				->UseRealTime();
+		benchmark::RegisterBenchmark(("BenchmarkLoadBlockElement/" + suffix).c_str(), catapult::io::BenchmarkLoadBlockElement, readMode)
+				->UseRealTime();
+	}
+}
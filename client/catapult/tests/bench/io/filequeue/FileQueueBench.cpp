@@ -0,0 +1,132 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileQueue.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr auto Num_Messages = 1000u;
+		constexpr auto Message_Size = 256u;
+		constexpr auto Max_Segment_Size = utils::FileSize::FromMegabytes(16);
+
+		// region BenchmarkDirectory
+
+		class BenchmarkDirectory {
+		public:
+			BenchmarkDirectory() : m_directory((std::filesystem::temp_directory_path() / "catapult.bench.io.filequeue").generic_string()) {
+				reset();
+			}
+
+			~BenchmarkDirectory() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			const std::string& directory() const {
+				return m_directory;
+			}
+
+		public:
+			void reset() {
+				std::filesystem::remove_all(m_directory);
+				std::filesystem::create_directories(m_directory);
+			}
+
+		private:
+			std::string m_directory;
+		};
+
+		std::vector<std::vector<uint8_t>> GenerateMessages() {
+			std::vector<std::vector<uint8_t>> messages(Num_Messages, std::vector<uint8_t>(Message_Size));
+			for (auto& message : messages)
+				bench::FillWithRandomData(message);
+
+			return messages;
+		}
+
+		void WriteMessages(
+				const std::string& directory,
+				utils::FileSize maxSegmentSize,
+				const std::vector<std::vector<uint8_t>>& messages) {
+			FileQueueWriter writer(directory, "index.dat", maxSegmentSize);
+			for (const auto& message : messages) {
+				writer.write(message);
+				writer.flush();
+			}
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkWrite(benchmark::State& state, utils::FileSize maxSegmentSize) {
+			BenchmarkDirectory benchmarkDirectory;
+			auto messages = GenerateMessages();
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				benchmarkDirectory.reset();
+				state.ResumeTiming();
+
+				WriteMessages(benchmarkDirectory.directory(), maxSegmentSize, messages);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Messages));
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * Num_Messages * Message_Size));
+		}
+
+		void BenchmarkRead(benchmark::State& state, utils::FileSize maxSegmentSize) {
+			BenchmarkDirectory benchmarkDirectory;
+			auto messages = GenerateMessages();
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				benchmarkDirectory.reset();
+				WriteMessages(benchmarkDirectory.directory(), maxSegmentSize, messages);
+				state.ResumeTiming();
+
+				FileQueueReader reader(benchmarkDirectory.directory(), "index_reader.dat", "index.dat");
+				while (reader.tryReadNextMessage([](const auto& buffer) { benchmark::DoNotOptimize(buffer.data()); }))
+				{}
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Messages));
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * Num_Messages * Message_Size));
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using catapult::utils::FileSize;
+
+	for (auto maxSegmentSize : { FileSize(), catapult::io::Max_Segment_Size }) {
+		auto suffix = std::string(FileSize() == maxSegmentSize ? "File" : "Segment");
+		benchmark::RegisterBenchmark(("BenchmarkWrite/" + suffix).c_str(), catapult::io::BenchmarkWrite, maxSegmentSize)->UseRealTime();
+		benchmark::RegisterBenchmark(("BenchmarkRead/" + suffix).c_str(), catapult::io::BenchmarkRead, maxSegmentSize)->UseRealTime();
+	}
+}
@@ -0,0 +1,260 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/PacketPayloadWriteBuffers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <climits>
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+#ifdef IOV_MAX
+		constexpr size_t Max_Buffers_Per_Write = IOV_MAX;
+#else
+		constexpr size_t Max_Buffers_Per_Write = 1024;
+#endif
+
+		// region CountingSocket
+
+		// counts write operations, each of which corresponds to a single send syscall
+		class CountingSocket {
+		public:
+			using executor_type = boost::asio::ip::tcp::socket::executor_type;
+
+		public:
+			explicit CountingSocket(boost::asio::ip::tcp::socket& socket)
+					: m_socket(socket)
+					, m_numWrites(0)
+			{}
+
+		public:
+			size_t numWrites() const {
+				return m_numWrites;
+			}
+
+		public:
+			executor_type get_executor() {
+				return m_socket.get_executor();
+			}
+
+			template<typename TConstBufferSequence, typename THandler>
+			auto async_write_some(const TConstBufferSequence& buffers, THandler&& handler) {
+				++m_numWrites;
+				return m_socket.async_write_some(buffers, std::forward<THandler>(handler));
+			}
+
+		private:
+			boost::asio::ip::tcp::socket& m_socket;
+			size_t m_numWrites;
+		};
+
+		// endregion
+
+		// region LoopbackConnection
+
+		// loopback tcp connection with a background thread that drains all data written to it
+		class LoopbackConnection {
+		public:
+			LoopbackConnection()
+					: m_writeSocket(m_ioContext)
+					, m_readSocket(m_ioContext)
+					, m_strand(m_ioContext) {
+				auto localHost = boost::asio::ip::address_v4::loopback();
+				boost::asio::ip::tcp::acceptor acceptor(m_ioContext, boost::asio::ip::tcp::endpoint(localHost, 0));
+				m_readSocket.connect(acceptor.local_endpoint());
+				acceptor.accept(m_writeSocket);
+
+				m_readThread = std::thread([&readSocket = m_readSocket]() {
+					std::vector<uint8_t> buffer(64 * 1024);
+					boost::system::error_code ec;
+					while (!ec)
+						readSocket.read_some(boost::asio::buffer(buffer), ec);
+				});
+			}
+
+			~LoopbackConnection() {
+				m_writeSocket.shutdown(boost::asio::ip::tcp::socket::shutdown_both);
+				m_writeSocket.close();
+				m_readThread.join();
+			}
+
+		public:
+			boost::asio::io_context& ioContext() {
+				return m_ioContext;
+			}
+
+			boost::asio::ip::tcp::socket& writeSocket() {
+				return m_writeSocket;
+			}
+
+			boost::asio::io_context::strand& strand() {
+				return m_strand;
+			}
+
+		private:
+			boost::asio::io_context m_ioContext;
+			boost::asio::ip::tcp::socket m_writeSocket;
+			boost::asio::ip::tcp::socket m_readSocket;
+			boost::asio::io_context::strand m_strand;
+			std::thread m_readThread;
+		};
+
+		// endregion
+
+		// region writers
+
+		// writes header and each payload buffer with separate (stranded) writes
+		class SequentialPayloadWriter {
+		public:
+			SequentialPayloadWriter(CountingSocket& socket, boost::asio::io_context::strand& strand, const PacketPayload& payload)
+					: m_socket(socket)
+					, m_strand(strand)
+					, m_payload(payload)
+					, m_nextBufferIndex(0)
+			{}
+
+		public:
+			void start() {
+				const auto* pHeaderData = reinterpret_cast<const uint8_t*>(&m_payload.header());
+				auto asioBuffer = boost::asio::buffer(pHeaderData, sizeof(PacketHeader));
+				boost::asio::async_write(m_socket, asioBuffer, m_strand.wrap([this](const auto& ec, auto) {
+					this->writeNext(ec);
+				}));
+			}
+
+		private:
+			void writeNext(const boost::system::error_code& lastEc) {
+				if (lastEc || m_nextBufferIndex == m_payload.buffers().size())
+					return;
+
+				auto buffer = m_payload.buffers()[m_nextBufferIndex++];
+				auto asioBuffer = boost::asio::buffer(buffer.pData, buffer.Size);
+				boost::asio::async_write(m_socket, asioBuffer, m_strand.wrap([this](const auto& ec, auto) {
+					this->writeNext(ec);
+				}));
+			}
+
+		private:
+			CountingSocket& m_socket;
+			boost::asio::io_context::strand& m_strand;
+			const PacketPayload& m_payload;
+			size_t m_nextBufferIndex;
+		};
+
+		// writes header and all payload buffers with gathered (stranded) writes
+		class GatheredPayloadWriter {
+		public:
+			GatheredPayloadWriter(CountingSocket& socket, boost::asio::io_context::strand& strand, const PacketPayload& payload)
+					: m_socket(socket)
+					, m_strand(strand)
+					, m_writeBuffers(payload)
+					, m_nextBufferIndex(0)
+			{}
+
+		public:
+			void start() {
+				writeNext(boost::system::error_code());
+			}
+
+		private:
+			void writeNext(const boost::system::error_code& lastEc) {
+				const auto& buffers = m_writeBuffers.buffers();
+				if (lastEc || m_nextBufferIndex == buffers.size())
+					return;
+
+				auto endBufferIndex = std::min(buffers.size(), m_nextBufferIndex + Max_Buffers_Per_Write);
+
+				std::vector<boost::asio::const_buffer> asioBuffers;
+				for (; m_nextBufferIndex < endBufferIndex; ++m_nextBufferIndex)
+					asioBuffers.push_back(boost::asio::buffer(buffers[m_nextBufferIndex].pData, buffers[m_nextBufferIndex].Size));
+
+				boost::asio::async_write(m_socket, asioBuffers, m_strand.wrap([this](const auto& ec, auto) {
+					this->writeNext(ec);
+				}));
+			}
+
+		private:
+			CountingSocket& m_socket;
+			boost::asio::io_context::strand& m_strand;
+			PacketPayloadWriteBuffers m_writeBuffers;
+			size_t m_nextBufferIndex;
+		};
+
+		// endregion
+
+		// region benchmark
+
+		PacketPayload CreatePayload(size_t numBuffers, size_t bufferSize) {
+			PacketPayloadBuilder builder(PacketType::Push_Block);
+			for (auto i = 0u; i < numBuffers; ++i) {
+				std::vector<uint8_t> buffer(bufferSize);
+				bench::FillWithRandomData(buffer);
+				builder.appendValues(buffer);
+			}
+
+			return builder.build();
+		}
+
+		template<typename TWriter>
+		void BenchmarkWritePayload(benchmark::State& state) {
+			auto payload = CreatePayload(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+
+			LoopbackConnection connection;
+			CountingSocket socket(connection.writeSocket());
+			for (auto _ : state) {
+				TWriter writer(socket, connection.strand(), payload);
+				writer.start();
+
+				connection.ioContext().run();
+				connection.ioContext().restart();
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.header().Size));
+			auto numWrites = static_cast<double>(socket.numWrites());
+			state.counters["writes/payload"] = benchmark::Counter(numWrites, benchmark::Counter::kAvgIterations);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	using namespace catapult::ionet;
+
+	auto registerBenchmark = [](const auto* name, auto benchmark) {
+		benchmark::RegisterBenchmark(name, benchmark)
+				->Args({ 1, 1024 * 1024 })
+				->Args({ 10, 256 })
+				->Args({ 100, 256 })
+				->Args({ 1000, 256 })
+				->Args({ 100, 4 * 1024 })
+				->Args({ 100, 64 * 1024 })
+				->UseRealTime();
+	};
+
+	registerBenchmark("BenchmarkWritePayload_Sequential", BenchmarkWritePayload<SequentialPayloadWriter>);
+	registerBenchmark("BenchmarkWritePayload_Gathered", BenchmarkWritePayload<GatheredPayloadWriter>);
+}
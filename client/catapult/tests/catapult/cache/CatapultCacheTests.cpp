@@ -28,6 +28,7 @@
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -135,12 +136,20 @@ namespace catapult { namespace cache {
 				return view.calculateStateHash(Height(123));
 			}
 		};
+
+		struct ParallelDeltaTraits : public DeltaTraits {
+			static auto CalculateStateHash(const CatapultCacheDelta& view) {
+				auto pPool = test::CreateStartedIoThreadPool();
+				return view.calculateStateHash(Height(123), *pPool);
+			}
+		};
 	}
 
 #define VIEW_DELTA_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_View) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ViewTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Delta) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DeltaTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_DeltaParallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelDeltaTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	VIEW_DELTA_TEST(StateHashIsZeroWhenStateCalculationIsDisabled) {
@@ -354,6 +363,24 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region sync
+
+	TEST(TEST_CLASS, SyncDelegatesToSubCaches) {
+		// Arrange:
+		auto cache = CreateSimpleCatapultCache();
+		CommitChangeToAllSubCaches(cache);
+
+		// Act:
+		cache.sync();
+
+		// Assert:
+		EXPECT_EQ(1u, cache.sub<test::SimpleCacheT<2>>().numSyncs());
+		EXPECT_EQ(1u, cache.sub<test::SimpleCacheT<4>>().numSyncs());
+		EXPECT_EQ(1u, cache.sub<test::SimpleCacheT<6>>().numSyncs());
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
@@ -562,6 +562,17 @@ namespace catapult { namespace cache {
 		AssertView<test::SimpleCacheView>(pView, 6, SubCacheViewType::View);
 	}
 
+	TEST(TEST_CLASS, SyncDelegatesToCache) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+
+		// Act:
+		adapter.sync();
+
+		// Assert:
+		EXPECT_EQ(1u, adapter.cache().numSyncs());
+	}
+
 	// endregion
 
 	// region createStorage
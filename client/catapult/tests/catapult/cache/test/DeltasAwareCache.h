@@ -98,6 +98,9 @@ namespace catapult { namespace test {
 		void commit(const CacheDeltaType&)
 		{}
 
+		void sync()
+		{}
+
 	private:
 		const ByteVectorCacheDeltas& m_deltas;
 		Breadcrumbs& m_breadcrumbs;
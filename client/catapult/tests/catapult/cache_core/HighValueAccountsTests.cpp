@@ -119,6 +119,147 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region copy on write address set
+
+	TEST(TEST_CLASS, CopyOnWrite_CanCreateAroundOriginal) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+
+		// Act:
+		CopyOnWriteAddressSet addresses(original);
+
+		// Assert:
+		EXPECT_EQ(&original, &addresses.get());
+		EXPECT_FALSE(addresses.isCopied());
+		EXPECT_TRUE(addresses.contains(*original.cbegin()));
+		EXPECT_FALSE(addresses.contains(test::GenerateRandomByteArray<Address>()));
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_NoOpModificationsDoNotCopyOriginal) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		CopyOnWriteAddressSet addresses(original);
+
+		// Act:
+		addresses.insert(*original.cbegin());
+		addresses.erase(test::GenerateRandomByteArray<Address>());
+
+		// Assert:
+		EXPECT_EQ(&original, &addresses.get());
+		EXPECT_FALSE(addresses.isCopied());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_InsertOfNewAddressCopiesOriginal) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		auto expected = original;
+		CopyOnWriteAddressSet addresses(original);
+		auto address = test::GenerateRandomByteArray<Address>();
+
+		// Act:
+		addresses.insert(address);
+
+		// Assert:
+		expected.insert(address);
+		EXPECT_TRUE(addresses.isCopied());
+		EXPECT_EQ(expected, addresses.get());
+		EXPECT_EQ(4u, original.size());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_EraseOfContainedAddressCopiesOriginal) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		auto expected = original;
+		CopyOnWriteAddressSet addresses(original);
+		auto address = *original.cbegin();
+
+		// Act:
+		addresses.erase(address);
+
+		// Assert:
+		expected.erase(address);
+		EXPECT_TRUE(addresses.isCopied());
+		EXPECT_EQ(expected, addresses.get());
+		EXPECT_EQ(4u, original.size());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_CanReset) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		auto replacement = GenerateRandomAddresses(3);
+		CopyOnWriteAddressSet addresses(original);
+
+		// Act:
+		addresses.reset(model::AddressSet(replacement));
+
+		// Assert:
+		EXPECT_TRUE(addresses.isCopied());
+		EXPECT_EQ(replacement, addresses.get());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_DetachIntoDoesNotReplaceDestinationWhenNotCopied) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		auto destination = GenerateRandomAddresses(3);
+		auto expected = destination;
+		CopyOnWriteAddressSet addresses(original);
+
+		// Act:
+		addresses.detachInto(destination);
+
+		// Assert:
+		EXPECT_EQ(expected, destination);
+		EXPECT_TRUE(addresses.get().empty());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_DetachIntoReplacesDestinationWhenCopied) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		auto destination = GenerateRandomAddresses(3);
+		CopyOnWriteAddressSet addresses(original);
+		addresses.erase(*original.cbegin());
+		auto expected = addresses.get();
+
+		// Act:
+		addresses.detachInto(destination);
+
+		// Assert:
+		EXPECT_EQ(expected, destination);
+		EXPECT_TRUE(addresses.get().empty());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_CanDetachWhenNotCopied) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		CopyOnWriteAddressSet addresses(original);
+
+		// Act:
+		auto detachedAddresses = addresses.detach();
+
+		// Assert:
+		EXPECT_EQ(original, detachedAddresses);
+		EXPECT_EQ(4u, original.size());
+		EXPECT_TRUE(addresses.get().empty());
+	}
+
+	TEST(TEST_CLASS, CopyOnWrite_CanDetachWhenCopied) {
+		// Arrange:
+		auto original = GenerateRandomAddresses(4);
+		CopyOnWriteAddressSet addresses(original);
+		addresses.erase(*original.cbegin());
+		auto expected = addresses.get();
+
+		// Act:
+		auto detachedAddresses = addresses.detach();
+
+		// Assert:
+		EXPECT_EQ(expected, detachedAddresses);
+		EXPECT_EQ(4u, original.size());
+		EXPECT_TRUE(addresses.get().empty());
+	}
+
+	// endregion
+
 	// region updater - constructor
 
 	namespace {
@@ -143,6 +284,9 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(accounts.removedAddresses(), updater.removedAddresses());
 
 		test::AssertEqual(accounts.accountHistories(), updater.accountHistories());
+
+		// - updater shares the original account histories
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
 	}
 
 	// endregion
@@ -996,6 +1140,74 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(updater.removedAddresses().empty());
 	}
 
+	namespace {
+		template<typename TModifier>
+		void AssertVoterEligibleAccountHistoriesCopyBehavior(bool shouldCopy, TModifier modifier) {
+			// Arrange: seed voter eligible accounts at height 3
+			test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+			auto addedAddresses = AddAccountsWithBalances(deltas.Copied, { Amount(2'100'000), Amount(2'200'000) });
+
+			auto accounts = CreateAccounts({});
+			{
+				HighValueAccountsUpdater updater(CreateOptions(), accounts);
+				updater.setHeight(Height(3));
+				updater.update(deltas.deltas());
+				updater.detachAccounts(accounts);
+			}
+
+			auto originalAccountHistories = accounts.accountHistories();
+			HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+			// Act:
+			modifier(deltas.Copied.find(addedAddresses[1])->second);
+
+			updater.setHeight(Height(4));
+			updater.update(deltas.deltas());
+
+			// Assert:
+			EXPECT_EQ(shouldCopy, &accounts.accountHistories() != &updater.accountHistories());
+			test::AssertEqual(originalAccountHistories, accounts.accountHistories());
+		}
+	}
+
+	TEST(TEST_CLASS, Updater_VoterEligible_UnchangedAccountsDoNotCopyAccountHistories) {
+		AssertVoterEligibleAccountHistoriesCopyBehavior(false, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, Updater_VoterEligible_ChangedAccountsCopyAccountHistories) {
+		AssertVoterEligibleAccountHistoriesCopyBehavior(true, [](auto& accountState) {
+			Credit(accountState, Amount(1));
+		});
+	}
+
+	TEST(TEST_CLASS, Updater_VoterEligible_UnchangedAccountsDoNotCopyAccountHistoriesWhenPruningGreaterHeightsIsNoOp) {
+		// Arrange: all histories end below the update height
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.setHeight(Height(8));
+		updater.update(test::DeltaElementsTestUtils::Wrapper<MemorySetType>().deltas());
+
+		// Assert:
+		EXPECT_EQ(&accounts.accountHistories(), &updater.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Updater_VoterEligible_AccountHistoriesAreCopiedWhenGreaterHeightsArePruned) {
+		// Arrange: some histories end above the update height
+		auto accounts = HighValueAccounts(model::AddressSet(), model::AddressSet(), CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Act:
+		updater.setHeight(Height(6));
+		updater.update(test::DeltaElementsTestUtils::Wrapper<MemorySetType>().deltas());
+
+		// Assert:
+		EXPECT_NE(&accounts.accountHistories(), &updater.accountHistories());
+		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
+		EXPECT_EQ(3u, updater.accountHistories().size());
+	}
+
 	// endregion
 
 	// region updater - voter eligible accounts (historical non-balance data)
@@ -1298,5 +1510,60 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(updater.accountHistories().empty());
 	}
 
+	TEST(TEST_CLASS, Updater_DetachAccountsIntoOriginalUpdatesHighValueAccountsInPlace) {
+		// Arrange:
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Added, GetHarvesterEligibleTestBalances());
+
+		auto accounts = HighValueAccounts(
+				model::AddressSet(addedAddresses.cbegin(), addedAddresses.cbegin() + 3),
+				model::AddressSet(),
+				CreateThreeAccountHistories());
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+		updater.setHeight(Height(9));
+		updater.update(deltas.deltas());
+
+		// Act:
+		updater.detachAccounts(accounts);
+
+		// Assert:
+		EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), accounts.addresses());
+		EXPECT_EQ(Pick(addedAddresses, { 1 }), accounts.removedAddresses());
+
+		auto expectedAccountHistories = CreateThreeAccountHistories();
+		expectedAccountHistories.emplace(addedAddresses[5], test::CreateAccountHistory({ { Height(9), Min_Voter_Balance } }));
+		test::AssertEqualBalanceHistoryOnly(expectedAccountHistories, accounts.accountHistories());
+
+		// - updater is cleared
+		EXPECT_TRUE(updater.addresses().empty());
+		EXPECT_TRUE(updater.removedAddresses().empty());
+
+		EXPECT_TRUE(updater.accountHistories().empty());
+	}
+
+	TEST(TEST_CLASS, Updater_DetachAccountsIntoOriginalPreservesAddressesWhenNoThresholdIsCrossed) {
+		// Arrange: all accounts are already high value and remain high value
+		test::DeltaElementsTestUtils::Wrapper<MemorySetType> deltas;
+		auto addedAddresses = AddAccountsWithBalances(deltas.Copied, { Min_Harvester_Balance, Min_Harvester_Balance + Amount(1) });
+
+		auto removedAddresses = GenerateRandomAddresses(3);
+		auto accounts = CreateAccounts(model::AddressSet(addedAddresses.cbegin(), addedAddresses.cend()), removedAddresses);
+		const auto* pOriginalAddressesData = &*accounts.addresses().cbegin();
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+		updater.update(deltas.deltas());
+
+		// Sanity: updater shares the original sets
+		EXPECT_EQ(&accounts.addresses(), &updater.addresses());
+		EXPECT_EQ(&accounts.removedAddresses(), &updater.removedAddresses());
+
+		// Act:
+		updater.detachAccounts(accounts);
+
+		// Assert: original sets were not replaced
+		EXPECT_EQ(model::AddressSet(addedAddresses.cbegin(), addedAddresses.cend()), accounts.addresses());
+		EXPECT_EQ(removedAddresses, accounts.removedAddresses());
+		EXPECT_EQ(pOriginalAddressesData, &*accounts.addresses().cbegin());
+	}
+
 	// endregion
 }}
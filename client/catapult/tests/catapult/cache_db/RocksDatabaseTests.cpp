@@ -57,6 +57,39 @@ namespace catapult { namespace cache {
 		auto MultiColumnSettings() {
 			return CreateSettings({ "default", "beta", "gamma" });
 		}
+
+		auto AsyncWritesSettings(size_t numKilobytes = 0) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.MaxWriteBatchSize = utils::FileSize::FromKilobytes(numKilobytes);
+			config.EnableAsyncWrites = true;
+			return RocksDatabaseSettings(test::TempDirectoryGuard::DefaultName(), config, { "default" }, FilterPruningMode::Disabled);
+		}
+
+		auto ColumnConfigurationsSettings(utils::FileSize blockCacheSize, utils::FileSize memtableMemoryBudget) {
+			auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			config.BlockCacheSize = blockCacheSize;
+			config.MemtableMemoryBudget = memtableMemoryBudget;
+
+			// - alpha: dedicated block cache, bloom filters, prefix extractor and hash memtable
+			auto& alphaConfig = config.Columns["alpha"];
+			alphaConfig.BlockCacheSize = utils::FileSize::FromMegabytes(1);
+			alphaConfig.BloomFilterBitsPerKey = 10;
+			alphaConfig.PrefixLength = 2;
+			alphaConfig.Compression = config::CacheDatabaseCompression::None;
+			alphaConfig.MemtableType = config::CacheDatabaseMemtableType::Hash_Skip_List;
+
+			// - beta: shared block cache and vector memtable
+			auto& betaConfig = config.Columns["beta"];
+			betaConfig.Compression = config::CacheDatabaseCompression::None;
+			betaConfig.MemtableType = config::CacheDatabaseMemtableType::Vector;
+
+			// - default: not configured
+			return RocksDatabaseSettings(
+					test::TempDirectoryGuard::DefaultName(),
+					config,
+					{ "default", "alpha", "beta" },
+					FilterPruningMode::Disabled);
+		}
 	}
 
 	// region constructor
@@ -688,4 +721,153 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region async writes
+
+	TEST(TEST_CLASS, SyncIsNoOpWhenAsyncWritesAreDisabled) {
+		// Arrange:
+		test::RdbTestContext context(BatchSettings());
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+		database.flush();
+
+		// Act:
+		database.sync();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+	}
+
+	TEST(TEST_CLASS, SyncSucceedsWhenNothingHasBeenFlushed_AsyncWrites) {
+		// Arrange:
+		test::RdbTestContext context(AsyncWritesSettings());
+
+		// Act + Assert:
+		EXPECT_NO_THROW(context.database().sync());
+	}
+
+	TEST(TEST_CLASS, FinalizeBatchCommitsBatchedPutsImmediately_AsyncWrites) {
+		// Arrange:
+		test::RdbTestContext context(AsyncWritesSettings(100));
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+
+		// Act:
+		database.flush();
+
+		// Assert: value is visible before it is synced
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+
+		// - sync can be awaited
+		EXPECT_NO_THROW(database.sync());
+	}
+
+	TEST(TEST_CLASS, CanFinalizeMultipleBatches_AsyncWrites) {
+		// Arrange:
+		test::RdbTestContext context(AsyncWritesSettings(100));
+		auto& database = context.database();
+
+		// Act: flush many batches without waiting for syncs
+		constexpr auto Num_Batches = 100u;
+		for (auto i = 0u; i < Num_Batches; ++i) {
+			database.put(0, test::ToSlice(i * 2), test::EvenKeyToValue(i * 2));
+			database.flush();
+		}
+
+		database.sync();
+
+		// Assert:
+		for (auto i = 0u; i < Num_Batches; ++i) {
+			RdbDataIterator iter;
+			database.get(0, test::ToSlice(i * 2), iter);
+			test::AssertIteratorValue(test::EvenKeyToValue(i * 2), iter);
+		}
+	}
+
+	TEST(TEST_CLASS, PendingWritesArePersistedWhenDatabaseIsDestroyed_AsyncWrites) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		{
+			RocksDatabase database(AsyncWritesSettings());
+			database.put(0, "hello", "amazing");
+			database.put(0, "world", "awesome");
+		}
+
+		// Act: reopen the database
+		RocksDatabase database(AsyncWritesSettings());
+
+		// Assert:
+		RdbDataIterator iter1;
+		database.get(0, "hello", iter1);
+		test::AssertIteratorValue("amazing", iter1);
+
+		RdbDataIterator iter2;
+		database.get(0, "world", iter2);
+		test::AssertIteratorValue("awesome", iter2);
+	}
+
+	// endregion
+
+	// region column configurations
+
+	namespace {
+		void AssertCanReadAndWriteWithColumnConfigurations(utils::FileSize blockCacheSize, utils::FileSize memtableMemoryBudget) {
+			// Arrange:
+			test::TempDirectoryGuard dbDirGuard;
+			RocksDatabase database(ColumnConfigurationsSettings(blockCacheSize, memtableMemoryBudget));
+
+			// Act:
+			database.put(0, "hello", "amazing");
+			database.put(1, "hello", "awesome");
+			database.put(2, "hello", "incredible");
+
+			// Assert:
+			auto iters = GetHelloKeyFromColumns(database, 3);
+
+			test::AssertIteratorValue("amazing", iters[0]);
+			test::AssertIteratorValue("awesome", iters[1]);
+			test::AssertIteratorValue("incredible", iters[2]);
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadAndWriteWithColumnConfigurations_DefaultBlockCache) {
+		AssertCanReadAndWriteWithColumnConfigurations(utils::FileSize(), utils::FileSize());
+	}
+
+	TEST(TEST_CLASS, CanReadAndWriteWithColumnConfigurations_SharedBlockCache) {
+		AssertCanReadAndWriteWithColumnConfigurations(utils::FileSize::FromMegabytes(2), utils::FileSize());
+	}
+
+	TEST(TEST_CLASS, CanReadAndWriteWithColumnConfigurations_MemtableMemoryBudget) {
+		AssertCanReadAndWriteWithColumnConfigurations(utils::FileSize::FromMegabytes(2), utils::FileSize::FromMegabytes(4));
+	}
+
+	TEST(TEST_CLASS, CanReopenDatabaseWithColumnConfigurations) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto settings = ColumnConfigurationsSettings(utils::FileSize::FromMegabytes(2), utils::FileSize());
+		{
+			RocksDatabase database(settings);
+			database.put(1, "hello", "awesome");
+			database.put(2, "world", "incredible");
+		}
+
+		// Act: reopen the database
+		RocksDatabase database(settings);
+
+		// Assert:
+		RdbDataIterator iter1;
+		database.get(1, "hello", iter1);
+		test::AssertIteratorValue("awesome", iter1);
+
+		RdbDataIterator iter2;
+		database.get(2, "world", iter2);
+		test::AssertIteratorValue("incredible", iter2);
+	}
+
+	// endregion
 }}
@@ -522,6 +522,99 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (max fee multiplier order)
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithVaryingMultipliers() {
+			// create transaction infos with max fee multipliers { 24, 82, 42, 21, 82, 42 }
+			return test::CreateTransactionInfosFromSizeMultiplierPairs({
+				{ 200, 240 }, { 250, 820 }, { 300, 420 }, { 350, 210 }, { 400, 820 }, { 450, 420 }
+			});
+		}
+
+		std::vector<uint32_t> ExtractSizes(const MemoryUtCache& cache, MaxFeeMultiplierOrder order, size_t numRequested = 100) {
+			std::vector<uint32_t> sizes;
+			cache.view().forEach(order, [numRequested, &sizes](const auto& info) {
+				sizes.push_back(info.pEntity->Size);
+				return numRequested != sizes.size();
+			});
+			return sizes;
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachWithOrderForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractSizes(cache, MaxFeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractSizes(cache, MaxFeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachWithAscendingOrderForwardsTransactionsOrderedByMaxFeeMultiplierThenArrival) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithVaryingMultipliers());
+
+		// Act:
+		auto sizes = ExtractSizes(cache, MaxFeeMultiplierOrder::Ascending);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 350, 200, 300, 450, 250, 400 }), sizes);
+	}
+
+	TEST(TEST_CLASS, ForEachWithDescendingOrderForwardsTransactionsOrderedByMaxFeeMultiplierThenArrival) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithVaryingMultipliers());
+
+		// Act:
+		auto sizes = ExtractSizes(cache, MaxFeeMultiplierOrder::Descending);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 250, 400, 300, 450, 200, 350 }), sizes);
+	}
+
+	TEST(TEST_CLASS, ForEachWithOrderForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithVaryingMultipliers());
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 350, 200, 300 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Ascending, 3));
+		EXPECT_EQ(std::vector<uint32_t>({ 250, 400, 300 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Descending, 3));
+	}
+
+	TEST(TEST_CLASS, ForEachWithOrderReflectsRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithVaryingMultipliers();
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		test::RemoveAll(cache, { transactionInfos[1].EntityHash, transactionInfos[5].EntityHash });
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 350, 200, 300, 400 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<uint32_t>({ 400, 300, 200, 350 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachWithOrderReflectsRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		test::AddAll(cache, CreateTransactionInfosWithVaryingMultipliers());
+
+		// Act:
+		cache.modifier().removeAll();
+		test::AddAll(cache, test::CreateTransactionInfosFromSizeMultiplierPairs({ { 300, 420 }, { 200, 820 } }));
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 300, 200 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<uint32_t>({ 200, 300 }), ExtractSizes(cache, MaxFeeMultiplierOrder::Descending));
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsShortHashesForAllTransactions) {
@@ -70,6 +70,14 @@ namespace catapult { namespace cache {
 				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, CompareNaturalOrder, SelectAllFilter);
 			}
 		};
+
+		// test::CreateSeededMemoryUtCache seeds with transactions with equal max fee multipliers, which are ordered by arrival
+		template<MaxFeeMultiplierOrder Order>
+		struct GetFirstOrderedFilteredTraits {
+			static auto GetFirst(const MemoryUtCacheView& utCacheView, uint32_t count, const EmbeddedCountRetriever& countRetriever) {
+				return GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, Order, SelectAllFilter);
+			}
+		};
 	}
 
 #define GET_FIRST_TRAITS_BASED_TEST(TEST_NAME) \
@@ -77,6 +85,12 @@ namespace catapult { namespace cache {
 	TEST(TEST_CLASS, TEST_NAME##_Ordinal) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrdinalTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Filtered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstFilteredTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_SortedFiltered) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstSortedFilteredTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_AscendingFiltered) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrderedFilteredTraits<MaxFeeMultiplierOrder::Ascending>>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_DescendingFiltered) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<GetFirstOrderedFilteredTraits<MaxFeeMultiplierOrder::Descending>>(); \
+	} \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// endregion
@@ -232,4 +246,70 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region OrderedFiltered
+
+	namespace {
+		std::unique_ptr<MemoryUtCache> CreateMemoryUtCacheWithVaryingMultipliers() {
+			// add transaction infos with max fee multipliers { 24, 82, 42, 21, 82, 42 }
+			auto pUtCache = test::CreateSeededMemoryUtCache(0);
+			test::AddAll(*pUtCache, test::CreateTransactionInfosFromSizeMultiplierPairs({
+				{ 200, 240 }, { 250, 820 }, { 300, 420 }, { 350, 210 }, { 400, 820 }, { 450, 420 }
+			}));
+			return pUtCache;
+		}
+
+		void AssertOrderedTransactionInfos(
+				const MemoryUtCacheView& utCacheView,
+				const std::vector<const model::TransactionInfo*>& transactionInfos,
+				const std::vector<size_t>& expectedIndexes) {
+			auto allTransactionInfos = test::ExtractTransactionInfos(utCacheView, utCacheView.size());
+			ASSERT_EQ(expectedIndexes.size(), transactionInfos.size());
+			for (auto i = 0u; i < transactionInfos.size(); ++i)
+				test::AssertEqual(*allTransactionInfos[expectedIndexes[i]], *transactionInfos[i], "transaction at " + std::to_string(i));
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrder_OrderedFiltered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithVaryingMultipliers();
+		auto utCacheView = pUtCache->view();
+
+		// Act:
+		auto order = MaxFeeMultiplierOrder::Ascending;
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 6, CountAsOne, order, SelectAllFilter);
+
+		// Assert: transactions with equal multipliers are ordered by arrival
+		AssertOrderedTransactionInfos(utCacheView, transactionInfos, { 3, 0, 2, 5, 1, 4 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrder_OrderedFiltered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithVaryingMultipliers();
+		auto utCacheView = pUtCache->view();
+
+		// Act:
+		auto order = MaxFeeMultiplierOrder::Descending;
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 6, CountAsOne, order, SelectAllFilter);
+
+		// Assert: transactions with equal multipliers are ordered by arrival
+		AssertOrderedTransactionInfos(utCacheView, transactionInfos, { 1, 4, 2, 5, 0, 3 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesOrderingAndFiltering_OrderedFiltered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithVaryingMultipliers();
+		auto utCacheView = pUtCache->view();
+
+		// Act: filter transactions with sizes not divisible by 100
+		auto order = MaxFeeMultiplierOrder::Descending;
+		auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, 3, CountAsOne, order, [](const auto& transactionInfo) {
+			return 0 == transactionInfo.pEntity->Size % 100;
+		});
+
+		// Assert: (4, 2, 0) should be returned; if count was applied first, wrong (4, 2) would be returned
+		AssertOrderedTransactionInfos(utCacheView, transactionInfos, { 4, 2, 0 });
+	}
+
+	// endregion
 }}
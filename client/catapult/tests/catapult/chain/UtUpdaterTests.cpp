@@ -123,29 +123,46 @@ namespace catapult { namespace chain {
 		public:
 			explicit UpdaterTestContext(
 					ThrottleMode throttleMode = ThrottleMode::Off,
-					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier())
+					BlockFeeMultiplier minFeeMultiplier = BlockFeeMultiplier(),
+					const std::optional<UtUpdaterParallelOptions>& parallelOptions = std::nullopt)
 					: m_cache(CreateCacheWithDefaultHeight())
 					, m_pUtChangeSubscriber(std::make_unique<mocks::MockUtChangeSubscriber>())
 					, m_utChangeSubscriber(*m_pUtChangeSubscriber)
 					, m_transactionsCache(
 							cache::MemoryCacheOptions(utils::FileSize(), utils::FileSize::FromKilobytes(2)),
 							cache::CreateAggregateUtCache,
-							std::move(m_pUtChangeSubscriber))
-					, m_updater(
+							std::move(m_pUtChangeSubscriber)) {
+				auto timeSupplier = []() { return Default_Time; };
+				auto failedTransactionSink = [this](const auto& transaction, const auto& hash, auto result) {
+					// notice that transaction.Deadline is used as transaction marker
+					m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
+				};
+				auto throttle = [this, throttleMode](const auto& transactionInfo, const auto& context) {
+					m_throttleParams.emplace_back(transactionInfo, context);
+					return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
+				};
+
+				if (parallelOptions) {
+					m_pUpdater = std::make_unique<UtUpdater>(
 							m_transactionsCache,
 							m_cache,
 							minFeeMultiplier,
 							m_executionConfig.Config,
-							[]() { return Default_Time; },
-							[this](const auto& transaction, const auto& hash, auto result) {
-								// notice that transaction.Deadline is used as transaction marker
-								m_failedTransactionStatuses.emplace_back(hash, transaction.Deadline, utils::to_underlying_type(result));
-							},
-							[this, throttleMode](const auto& transactionInfo, const auto& context) {
-								m_throttleParams.emplace_back(transactionInfo, context);
-								return ThrottleMode::Even == throttleMode && (0 == transactionInfo.pEntity->Deadline.unwrap() % 2);
-							})
-			{}
+							timeSupplier,
+							failedTransactionSink,
+							throttle,
+							*parallelOptions);
+				} else {
+					m_pUpdater = std::make_unique<UtUpdater>(
+							m_transactionsCache,
+							m_cache,
+							minFeeMultiplier,
+							m_executionConfig.Config,
+							timeSupplier,
+							failedTransactionSink,
+							throttle);
+				}
+			}
 
 		public:
 			cache::MemoryUtCacheProxy& transactionsCache() {
@@ -153,7 +170,7 @@ namespace catapult { namespace chain {
 			}
 
 			UtUpdater& updater() {
-				return m_updater;
+				return *m_pUpdater;
 			}
 
 			void setValidationResult(ValidationResult result, const Hash256& hash, size_t id) {
@@ -467,7 +484,7 @@ namespace catapult { namespace chain {
 			std::unique_ptr<mocks::MockUtChangeSubscriber> m_pUtChangeSubscriber;
 			mocks::MockUtChangeSubscriber& m_utChangeSubscriber;
 			cache::MemoryUtCacheProxy m_transactionsCache;
-			UtUpdater m_updater;
+			std::unique_ptr<UtUpdater> m_pUpdater;
 
 			std::unordered_set<size_t> m_partialUndoFailureIndexes;
 			std::vector<model::TransactionStatus> m_failedTransactionStatuses;
@@ -1098,4 +1115,266 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - parallel admission checks
+
+	namespace {
+		UtUpdaterParallelOptions CreateParallelOptions(size_t minParallelTransactionsCount, std::vector<size_t>& numPartitionsHistory) {
+			// process all partitions sequentially in order to make the tests deterministic
+			UtUpdaterParallelOptions options;
+			options.MinParallelTransactionsCount = minParallelTransactionsCount;
+			options.MaxPartitions = 3;
+			options.ProcessPartitions = [&numPartitionsHistory](auto numPartitions, const auto& processPartition) {
+				numPartitionsHistory.push_back(numPartitions);
+				for (auto i = 0u; i < numPartitions; ++i)
+					processPartition(i);
+			};
+			return options;
+		}
+
+		void AssertRevertedTransactionsUpdateWithParallelOptions(
+				size_t minParallelTransactionsCount,
+				const std::vector<size_t>& expectedNumPartitionsHistory) {
+			// Arrange: initialize the UT cache with 4 transactions
+			std::vector<size_t> numPartitionsHistory;
+			auto parallelOptions = CreateParallelOptions(minParallelTransactionsCount, numPartitionsHistory);
+			UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(), parallelOptions);
+			auto originalTransactionData = CreateTransactionData(4, 5);
+			test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+			context.resetSubscriber();
+
+			// - prepare 5 new transactions
+			auto transactionData = CreateTransactionData(5);
+
+			// Act:
+			context.updater().update({}, transactionData.UtInfos);
+
+			// Assert: the cache contains original and new transactions
+			EXPECT_EQ(9u, context.transactionsCache().view().size());
+			test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+			test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+			// - all entities were published once and executed in order
+			context.assertContexts(CreateRevertedAndExistingSources(5, 4));
+			context.assertEntityInfos(ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos));
+
+			context.assertSubscriberCalls(GenerateRawDeadlines(5));
+
+			EXPECT_EQ(expectedNumPartitionsHistory, numPartitionsHistory);
+		}
+	}
+
+	TEST(TEST_CLASS, RevertedTransactionsUpdateDoesNotCheckTransactionsInParallelWhenBelowMinCount) {
+		AssertRevertedTransactionsUpdateWithParallelOptions(6, {});
+	}
+
+	TEST(TEST_CLASS, RevertedTransactionsUpdateChecksTransactionsInParallelWhenAtLeastMinCount) {
+		AssertRevertedTransactionsUpdateWithParallelOptions(4, { 3, 3 });
+		AssertRevertedTransactionsUpdateWithParallelOptions(5, { 3 });
+	}
+
+	TEST(TEST_CLASS, RevertedTransactionsUpdateCapsPartitionsAtTransactionsCount) {
+		// Arrange:
+		std::vector<size_t> numPartitionsHistory;
+		auto parallelOptions = CreateParallelOptions(1, numPartitionsHistory);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(), parallelOptions);
+		auto transactionData = CreateTransactionData(2);
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos);
+
+		// Assert: no partitions are created for the (empty) original transactions
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		context.assertEntityInfos(transactionData.EntityInfos);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), numPartitionsHistory);
+	}
+
+	TEST(TEST_CLASS, NewTransactionsUpdateDoesNotCheckTransactionsInParallel) {
+		// Arrange:
+		std::vector<size_t> numPartitionsHistory;
+		auto parallelOptions = CreateParallelOptions(1, numPartitionsHistory);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(), parallelOptions);
+		auto transactionData = CreateTransactionData(4);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertEntityInfos(transactionData.EntityInfos);
+		EXPECT_TRUE(numPartitionsHistory.empty());
+	}
+
+	TEST(TEST_CLASS, CommittedOriginalTransactionsAreNotAdmittedByParallelChecks) {
+		// Arrange: initialize the UT cache with 6 transactions
+		std::vector<size_t> numPartitionsHistory;
+		auto parallelOptions = CreateParallelOptions(1, numPartitionsHistory);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(), parallelOptions);
+		auto originalTransactionData = CreateTransactionData(6, 3);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - prepare 3 new transactions
+		auto transactionData = CreateTransactionData(3);
+
+		// Act:
+		context.updater().update({ &originalHashes[2], &originalHashes[4] }, transactionData.UtInfos);
+
+		// Assert: the cache contains original and new transactions (and the committed original ones were filtered out)
+		EXPECT_EQ(7u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 1, 3, 5 }));
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		// - publisher, validator and observer only get called for entities that pass the filter
+		auto unconfirmedEntityInfos = ConcatContainers(
+				transactionData.EntityInfos,
+				Select(originalTransactionData.EntityInfos, { 0, 1, 3, 5 }));
+		context.assertContexts(CreateRevertedAndExistingSources(3, 4));
+		context.assertEntityInfos(unconfirmedEntityInfos);
+
+		context.assertSubscriberCalls({ 0, 1, 4 }, { 25, 49 });
+		EXPECT_EQ(std::vector<size_t>({ 3, 3 }), numPartitionsHistory);
+	}
+
+	TEST(TEST_CLASS, ParallelCheckedTransactionsThatPartiallyFailValidationAreUndone) {
+		// Arrange: initialize the UT cache with 6 transactions
+		std::vector<size_t> numPartitionsHistory;
+		auto parallelOptions = CreateParallelOptions(1, numPartitionsHistory);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(), parallelOptions);
+		auto originalTransactionData = CreateTransactionData(6, 3);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+		context.resetSubscriber();
+
+		// - prepare 3 new transactions
+		auto transactionData = CreateTransactionData(3);
+
+		// - set failures for 2 / 6 original entities
+		context.setValidationResult(ValidationResult::Failure, originalHashes[1], 2);
+		context.setValidationResult(ValidationResult::Failure, originalHashes[4], 2);
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos);
+
+		// Assert: transactions admitted by parallel checks are undone in the same way as other transactions
+		EXPECT_EQ(7u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalHashes, { 0, 2, 3, 5 }));
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+
+		context.setPartialUndoFailureIndexes({ 6 + 3, 6 + 9 });
+		context.assertContexts(CreateRevertedAndExistingSources(3, 6));
+		context.assertEntityInfos(
+				ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos),
+				{ { 3 + 1, ValidationResult::Failure }, { 3 + 4, ValidationResult::Failure } });
+
+		context.assertSubscriberCalls({ 0, 1, 4 }, { 16, 49 });
+		EXPECT_EQ(std::vector<size_t>({ 3, 3 }), numPartitionsHistory);
+	}
+
+	TEST(TEST_CLASS, ParallelCheckedTransactionsWithInsufficientFeeMultiplesAreNotAddedToCache) {
+		// Arrange:
+		std::vector<size_t> numPartitionsHistory;
+		auto parallelOptions = CreateParallelOptions(1, numPartitionsHistory);
+		UpdaterTestContext context(ThrottleMode::Off, BlockFeeMultiplier(20), parallelOptions);
+		auto transactionData = CreateTransactionData(6);
+
+		// - set fee multiples
+		auto i = 0u;
+		std::array<uint32_t, 6> feeMultiples{ 10, 20, 19, 30, 21, 10 };
+		for (auto& utInfo : transactionData.UtInfos) {
+			auto multiplier = BlockFeeMultiplier(feeMultiples[i++]);
+			const_cast<Amount&>(utInfo.pEntity->MaxFee) = model::CalculateTransactionFee(multiplier, *utInfo.pEntity);
+		}
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos);
+
+		// Assert: only transactions with multiples of at least 20 were added
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(transactionData.Hashes, { 1, 3, 4 }));
+
+		context.assertEntityInfos(Select(transactionData.EntityInfos, { 1, 3, 4 }));
+		EXPECT_EQ(std::vector<size_t>({ 3 }), numPartitionsHistory);
+	}
+
+	// endregion
+
+	// region rebaseStatistics
+
+	namespace {
+		void AssertRebaseStatistics(
+				const UtUpdaterRebaseStatistics& statistics,
+				uint64_t expectedNumRebases,
+				uint64_t expectedNumTransactions,
+				uint64_t expectedNumAddedTransactions) {
+			EXPECT_EQ(expectedNumRebases, statistics.NumRebases);
+			EXPECT_EQ(expectedNumTransactions, statistics.NumTransactions);
+			EXPECT_EQ(expectedNumAddedTransactions, statistics.NumAddedTransactions);
+		}
+	}
+
+	TEST(TEST_CLASS, RebaseStatisticsAreInitiallyZero) {
+		// Arrange:
+		UpdaterTestContext context;
+
+		// Act:
+		auto statistics = context.updater().rebaseStatistics();
+
+		// Assert:
+		AssertRebaseStatistics(statistics, 0, 0, 0);
+		EXPECT_EQ(0u, statistics.ElapsedMillis);
+	}
+
+	TEST(TEST_CLASS, NewTransactionsUpdateDoesNotChangeRebaseStatistics) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto transactionData = CreateTransactionData(4);
+
+		// Act:
+		context.updater().update(transactionData.UtInfos);
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		AssertRebaseStatistics(context.updater().rebaseStatistics(), 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, RevertedTransactionsUpdateChangesRebaseStatistics) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(6, 3);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare 3 new transactions and fail validation of one original transaction
+		auto transactionData = CreateTransactionData(3);
+		context.setValidationResult(ValidationResult::Failure, originalHashes[1], 1);
+
+		// Act:
+		context.updater().update({ &originalHashes[2], &originalHashes[4] }, transactionData.UtInfos);
+
+		// Assert: all transactions were considered but only unconfirmed and valid transactions were added
+		EXPECT_EQ(6u, context.transactionsCache().view().size());
+		AssertRebaseStatistics(context.updater().rebaseStatistics(), 1, 9, 6);
+	}
+
+	TEST(TEST_CLASS, RebaseStatisticsReflectMostRecentRebase) {
+		// Arrange: initialize the UT cache with 6 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(6, 3);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		auto transactionData = CreateTransactionData(3);
+		context.updater().update({ &originalHashes[2], &originalHashes[4] }, transactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {});
+
+		// Assert: the most recent rebase reapplied all remaining transactions
+		EXPECT_EQ(7u, context.transactionsCache().view().size());
+		AssertRebaseStatistics(context.updater().rebaseStatistics(), 2, 7, 7);
+	}
+
+	// endregion
 }}
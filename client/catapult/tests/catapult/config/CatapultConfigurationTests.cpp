@@ -115,6 +115,9 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.BlockStorageCacheSize);
+			EXPECT_FALSE(config.EnableMemoryMappedBlockStorage);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(16), config.FileSpoolingMaxSegmentSize);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -139,18 +142,25 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.SocketWorkingBufferPoolSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(300), config.BlockDisruptorMaxMemorySize);
 			EXPECT_EQ(1u, config.BlockElementTraceInterval);
+			EXPECT_EQ(1024u, config.BlockMinParallelTransactionsHashCount);
 
 			EXPECT_EQ(8192u, config.TransactionDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.TransactionDisruptorMaxMemorySize);
+			EXPECT_EQ(32u, config.TransactionDisruptorMaxBatchSize);
+			EXPECT_EQ(utils::TimeSpan::FromMilliseconds(5), config.TransactionDisruptorMaxCoalescingDelay);
 			EXPECT_EQ(10u, config.TransactionElementTraceInterval);
+			EXPECT_EQ(1024u, config.TransactionMinParallelRebaseCount);
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+			EXPECT_FALSE(config.EnableNotificationProfiling);
+			EXPECT_EQ(disruptor::DisruptorWaitStrategy::Blocking, config.DispatcherWaitStrategy);
 
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
@@ -169,6 +179,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
+			EXPECT_FALSE(config.CacheDatabase.EnableAsyncWrites);
 
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
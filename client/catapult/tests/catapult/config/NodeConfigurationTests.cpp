@@ -45,6 +45,9 @@ namespace catapult { namespace config {
 							{ "enableAutoSyncCleanup", "true" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "blockStorageCacheSize", "27MB" },
+							{ "enableMemoryMappedBlockStorage", "true" },
+							{ "fileSpoolingMaxSegmentSize", "3MB" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -69,18 +72,25 @@ namespace catapult { namespace config {
 
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
+							{ "socketWorkingBufferPoolSize", "3MB" },
 							{ "maxPacketDataSize", "10MB" },
 
 							{ "blockDisruptorSlotCount", "1000" },
 							{ "blockDisruptorMaxMemorySize", "15MB" },
 							{ "blockElementTraceInterval", "34" },
+							{ "blockMinParallelTransactionsHashCount", "543" },
 
 							{ "transactionDisruptorSlotCount", "9876" },
 							{ "transactionDisruptorMaxMemorySize", "101KB" },
+							{ "transactionDisruptorMaxBatchSize", "17" },
+							{ "transactionDisruptorMaxCoalescingDelay", "12ms" },
 							{ "transactionElementTraceInterval", "98" },
+							{ "transactionMinParallelRebaseCount", "321" },
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
+							{ "enableNotificationProfiling", "true" },
+							{ "dispatcherWaitStrategy", "spin-yield" },
 
 							{ "maxTrackedNodes", "222" },
 
@@ -102,7 +112,28 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+							{ "enableAsyncWrites", "true" }
+						}
+					},
+					{
+						"cache_database:AccountStateCache.default",
+						{
+							{ "blockCacheSize", "21MB" },
+							{ "bloomFilterBitsPerKey", "10" },
+							{ "prefixLength", "8" },
+							{ "compression", "lz4" },
+							{ "memtableType", "hash-skip-list" }
+						}
+					},
+					{
+						"cache_database:HashCache.key_lookup",
+						{
+							{ "blockCacheSize", "0MB" },
+							{ "bloomFilterBitsPerKey", "0" },
+							{ "prefixLength", "0" },
+							{ "compression", "zstd" },
+							{ "memtableType", "vector" }
 						}
 					},
 					{
@@ -167,6 +198,9 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(utils::FileSize(), config.BlockStorageCacheSize);
+				EXPECT_FALSE(config.EnableMemoryMappedBlockStorage);
+				EXPECT_EQ(utils::FileSize(), config.FileSpoolingMaxSegmentSize);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -191,18 +225,25 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockDisruptorMaxMemorySize);
 				EXPECT_EQ(0u, config.BlockElementTraceInterval);
+				EXPECT_EQ(0u, config.BlockMinParallelTransactionsHashCount);
 
 				EXPECT_EQ(0u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.TransactionDisruptorMaxMemorySize);
+				EXPECT_EQ(0u, config.TransactionDisruptorMaxBatchSize);
+				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.TransactionDisruptorMaxCoalescingDelay);
 				EXPECT_EQ(0u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(0u, config.TransactionMinParallelRebaseCount);
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
+				EXPECT_FALSE(config.EnableNotificationProfiling);
+				EXPECT_EQ(disruptor::DisruptorWaitStrategy::Sleep, config.DispatcherWaitStrategy);
 
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
@@ -221,6 +262,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_FALSE(config.CacheDatabase.EnableAsyncWrites);
+				EXPECT_TRUE(config.CacheDatabase.Columns.empty());
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -262,6 +305,9 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(27), config.BlockStorageCacheSize);
+				EXPECT_TRUE(config.EnableMemoryMappedBlockStorage);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.FileSpoolingMaxSegmentSize);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -286,18 +332,25 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.SocketWorkingBufferPoolSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(15), config.BlockDisruptorMaxMemorySize);
 				EXPECT_EQ(34u, config.BlockElementTraceInterval);
+				EXPECT_EQ(543u, config.BlockMinParallelTransactionsHashCount);
 
 				EXPECT_EQ(9876u, config.TransactionDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromKilobytes(101), config.TransactionDisruptorMaxMemorySize);
+				EXPECT_EQ(17u, config.TransactionDisruptorMaxBatchSize);
+				EXPECT_EQ(utils::TimeSpan::FromMilliseconds(12), config.TransactionDisruptorMaxCoalescingDelay);
 				EXPECT_EQ(98u, config.TransactionElementTraceInterval);
+				EXPECT_EQ(321u, config.TransactionMinParallelRebaseCount);
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+				EXPECT_TRUE(config.EnableNotificationProfiling);
+				EXPECT_EQ(disruptor::DisruptorWaitStrategy::Spin_Yield, config.DispatcherWaitStrategy);
 
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
@@ -316,6 +369,23 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(45), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_TRUE(config.CacheDatabase.EnableAsyncWrites);
+
+				ASSERT_EQ(2u, config.CacheDatabase.Columns.size());
+
+				const auto& columnConfig1 = config.CacheDatabase.Columns.at("AccountStateCache.default");
+				EXPECT_EQ(utils::FileSize::FromMegabytes(21), columnConfig1.BlockCacheSize);
+				EXPECT_EQ(10u, columnConfig1.BloomFilterBitsPerKey);
+				EXPECT_EQ(8u, columnConfig1.PrefixLength);
+				EXPECT_EQ(CacheDatabaseCompression::Lz4, columnConfig1.Compression);
+				EXPECT_EQ(CacheDatabaseMemtableType::Hash_Skip_List, columnConfig1.MemtableType);
+
+				const auto& columnConfig2 = config.CacheDatabase.Columns.at("HashCache.key_lookup");
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), columnConfig2.BlockCacheSize);
+				EXPECT_EQ(0u, columnConfig2.BloomFilterBitsPerKey);
+				EXPECT_EQ(0u, columnConfig2.PrefixLength);
+				EXPECT_EQ(CacheDatabaseCompression::Zstd, columnConfig2.Compression);
+				EXPECT_EQ(CacheDatabaseMemtableType::Vector, columnConfig2.MemtableType);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
@@ -350,6 +420,50 @@ namespace catapult { namespace config {
 
 	DEFINE_CONFIGURATION_TESTS(NodeConfigurationTests, Node)
 
+	// region enum parsing
+
+	TEST(TEST_CLASS, CanParseValidCacheDatabaseCompression) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("none", CacheDatabaseCompression::None);
+		assertSuccessfulParse("lz4", CacheDatabaseCompression::Lz4);
+		assertSuccessfulParse("zstd", CacheDatabaseCompression::Zstd);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCacheDatabaseCompression) {
+		test::AssertEnumParseFailure("lz4", CacheDatabaseCompression::Zstd, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	TEST(TEST_CLASS, CanParseValidCacheDatabaseMemtableType) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("skip-list", CacheDatabaseMemtableType::Skip_List);
+		assertSuccessfulParse("hash-skip-list", CacheDatabaseMemtableType::Hash_Skip_List);
+		assertSuccessfulParse("vector", CacheDatabaseMemtableType::Vector);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCacheDatabaseMemtableType) {
+		test::AssertEnumParseFailure("vector", CacheDatabaseMemtableType::Skip_List, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	// endregion
+
 	// region utils
 
 	namespace {
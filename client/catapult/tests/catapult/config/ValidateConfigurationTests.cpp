@@ -306,4 +306,43 @@ namespace catapult { namespace config {
 	}
 
 	// endregion
+
+	// region cache database column validation
+
+	namespace {
+		auto CreateCatapultConfigurationWithColumn(CacheDatabaseMemtableType memtableType, uint32_t prefixLength) {
+			auto mutableConfig = CreateMutableCatapultConfiguration();
+			auto& columnConfig = mutableConfig.Node.CacheDatabase.Columns["AccountStateCache.default"];
+			columnConfig.MemtableType = memtableType;
+			columnConfig.PrefixLength = prefixLength;
+			return mutableConfig.ToConst();
+		}
+	}
+
+	TEST(TEST_CLASS, HashSkipListMemtableRequiresPrefixLength) {
+		// Arrange:
+		auto assertNoThrow = [](auto memtableType, uint32_t prefixLength) {
+			auto config = CreateCatapultConfigurationWithColumn(memtableType, prefixLength);
+			EXPECT_NO_THROW(ValidateConfiguration(config))
+					<< "type " << utils::to_underlying_type(memtableType) << ", length " << prefixLength;
+		};
+
+		auto assertThrow = [](auto memtableType, uint32_t prefixLength) {
+			auto config = CreateCatapultConfigurationWithColumn(memtableType, prefixLength);
+			EXPECT_THROW(ValidateConfiguration(config), utils::property_malformed_error)
+					<< "type " << utils::to_underlying_type(memtableType) << ", length " << prefixLength;
+		};
+
+		// Act + Assert:
+		// - no exceptions
+		assertNoThrow(CacheDatabaseMemtableType::Skip_List, 0);
+		assertNoThrow(CacheDatabaseMemtableType::Skip_List, 8);
+		assertNoThrow(CacheDatabaseMemtableType::Vector, 0);
+		assertNoThrow(CacheDatabaseMemtableType::Hash_Skip_List, 8);
+
+		// - exceptions
+		assertThrow(CacheDatabaseMemtableType::Hash_Skip_List, 0);
+	}
+
+	// endregion
 }}
@@ -36,6 +36,7 @@ namespace catapult { namespace consumers {
 #define TEST_CLASS BatchSignatureConsumerTests // used to generate unique function names in macros
 #define BLOCK_TEST_CLASS BlockBatchSignatureConsumerTests
 #define TRANSACTION_TEST_CLASS TransactionBatchSignatureConsumerTests
+#define COALESCING_TRANSACTION_TEST_CLASS CoalescingTransactionBatchSignatureConsumerTests
 
 	namespace {
 		// region NotificationDescriptor
@@ -532,4 +533,182 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region coalescing transaction
+
+	namespace {
+		struct CoalescingTestContext {
+		public:
+			explicit CoalescingTestContext(
+					const std::vector<NotificationDescriptor>& descriptors,
+					const std::unordered_set<size_t>& alwaysVerifiableIndexes = {})
+					: GenerationHashSeed(test::GenerateRandomByteArray<catapult::GenerationHashSeed>())
+					, pPublisher(std::make_shared<MockSignatureNotificationPublisher>(
+							GenerationHashSeed,
+							descriptors,
+							alwaysVerifiableIndexes))
+					, pPool(test::CreateStartedIoThreadPool())
+					, Consumer(CreateCoalescingTransactionBatchSignatureConsumer(
+							GenerationHashSeed,
+							CreateRandomFiller(),
+							pPublisher,
+							*pPool,
+							utils::TimeSpan::FromMilliseconds(7),
+							[this](const auto&, const auto& hash, auto result) {
+								FailedTransactionStatuses.emplace_back(hash, Timestamp(), utils::to_underlying_type(result));
+							}))
+			{}
+
+		public:
+			catapult::GenerationHashSeed GenerationHashSeed;
+			std::shared_ptr<MockSignatureNotificationPublisher> pPublisher;
+			std::unique_ptr<thread::IoThreadPool> pPool;
+
+			std::vector<model::TransactionStatus> FailedTransactionStatuses;
+			disruptor::DisruptorBatchConsumer Consumer;
+		};
+
+		std::vector<disruptor::ConsumerInput> CreateTransactionInputs(size_t numInputs, size_t numTransactionsPerInput) {
+			std::vector<disruptor::ConsumerInput> inputs;
+			for (auto i = 0u; i < numInputs; ++i) {
+				inputs.emplace_back(test::CreateTransactionEntityRange(numTransactionsPerInput));
+				for (auto& element : inputs.back().transactions())
+					element.EntityHash = test::GenerateRandomByteArray<Hash256>();
+			}
+
+			return inputs;
+		}
+
+		std::vector<disruptor::ConsumerInput*> ToPointers(std::vector<disruptor::ConsumerInput>& inputs) {
+			std::vector<disruptor::ConsumerInput*> pInputs;
+			for (auto& input : inputs)
+				pInputs.push_back(&input);
+
+			return pInputs;
+		}
+
+		model::WeakEntityInfos GetAllEntityInfos(const std::vector<disruptor::ConsumerInput>& inputs) {
+			model::WeakEntityInfos entityInfos;
+			for (const auto& input : inputs) {
+				for (const auto& element : input.transactions())
+					entityInfos.emplace_back(element.Transaction, element.EntityHash);
+			}
+
+			return entityInfos;
+		}
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, HasCustomMaxCoalescingDelay) {
+		// Arrange:
+		CoalescingTestContext context({});
+
+		// Act + Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(7), context.Consumer.maxCoalescingDelay());
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, CanProcessZeroInputs) {
+		// Arrange:
+		CoalescingTestContext context({});
+
+		// Act:
+		auto results = context.Consumer({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+		EXPECT_TRUE(context.pPublisher->entityInfos().empty());
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, CanProcessMultipleInputsWithSignatureNotifications_AllVerifiable) {
+		// Arrange:
+		auto inputs = CreateTransactionInputs(3, 2);
+		CoalescingTestContext context(GetMixedDescriptors());
+
+		// Act:
+		auto results = context.Consumer(ToPointers(inputs));
+
+		// Assert: signatures from all inputs were extracted together
+		ASSERT_EQ(3u, results.size());
+		for (const auto& result : results)
+			test::AssertContinued(result);
+
+		EXPECT_EQ(GetAllEntityInfos(inputs), context.pPublisher->entityInfos());
+		EXPECT_TRUE(context.FailedTransactionStatuses.empty());
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, CanProcessMultipleInputsWithSignatureNotifications_SomeVerifiable) {
+		// Arrange: make all signatures of the third entity (second input) unverifiable
+		auto inputs = CreateTransactionInputs(3, 2);
+		auto descriptors = GetMixedDescriptors();
+		for (auto& descriptor : descriptors)
+			StripVerifiable(descriptor);
+
+		CoalescingTestContext context(descriptors, { 0, 1, 3, 4, 5 });
+
+		// Act:
+		auto results = context.Consumer(ToPointers(inputs));
+
+		// Assert: failure is only attributed to the input containing the failed entity
+		ASSERT_EQ(3u, results.size());
+		test::AssertContinued(results[0]);
+		test::AssertAborted(results[1], Failure_Consumer_Batch_Signature_Not_Verifiable, disruptor::ConsumerResultSeverity::Fatal);
+		test::AssertContinued(results[2]);
+
+		EXPECT_EQ(GetAllEntityInfos(inputs), context.pPublisher->entityInfos());
+
+		// - only a single element should have failed
+		ASSERT_EQ(1u, context.FailedTransactionStatuses.size());
+		EXPECT_EQ(inputs[1].transactions()[0].EntityHash, context.FailedTransactionStatuses[0].Hash);
+
+		EXPECT_EQ(disruptor::ConsumerResultSeverity::Failure, inputs[1].transactions()[0].ResultSeverity);
+		EXPECT_EQ(disruptor::ConsumerResultSeverity::Success, inputs[1].transactions()[1].ResultSeverity);
+		for (auto i : { 0u, 2u }) {
+			for (const auto& element : inputs[i].transactions())
+				EXPECT_EQ(disruptor::ConsumerResultSeverity::Success, element.ResultSeverity) << "input at " << i;
+		}
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, CanProcessMultipleInputsWithSignatureNotifications_NoneVerifiable) {
+		// Arrange:
+		auto inputs = CreateTransactionInputs(3, 2);
+		auto descriptors = GetMixedDescriptors();
+		for (auto& descriptor : descriptors)
+			StripVerifiable(descriptor);
+
+		CoalescingTestContext context(descriptors);
+
+		// Act:
+		auto results = context.Consumer(ToPointers(inputs));
+
+		// Assert:
+		ASSERT_EQ(3u, results.size());
+		for (const auto& result : results)
+			test::AssertAborted(result, Failure_Consumer_Batch_Signature_Not_Verifiable, disruptor::ConsumerResultSeverity::Fatal);
+
+		EXPECT_EQ(6u, context.FailedTransactionStatuses.size());
+	}
+
+	TEST(COALESCING_TRANSACTION_TEST_CLASS, SkippedElementsAreNotVerified) {
+		// Arrange:
+		auto inputs = CreateTransactionInputs(2, 2);
+		inputs[0].transactions()[1].ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+		inputs[1].transactions()[0].ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+		CoalescingTestContext context(GetMixedDescriptors());
+
+		// Act:
+		auto results = context.Consumer(ToPointers(inputs));
+
+		// Assert:
+		ASSERT_EQ(2u, results.size());
+		test::AssertContinued(results[0]);
+		test::AssertContinued(results[1]);
+
+		model::WeakEntityInfos expectedEntityInfos{
+			{ inputs[0].transactions()[0].Transaction, inputs[0].transactions()[0].EntityHash },
+			{ inputs[1].transactions()[1].Transaction, inputs[1].transactions()[1].EntityHash }
+		};
+		EXPECT_EQ(expectedEntityInfos, context.pPublisher->entityInfos());
+		EXPECT_TRUE(context.FailedTransactionStatuses.empty());
+	}
+
+	// endregion
 }}
@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
@@ -205,16 +206,20 @@ namespace catapult { namespace consumers {
 
 		struct ProcessorTestContext {
 		public:
-			explicit ProcessorTestContext(ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled)
+			explicit ProcessorTestContext(
+					ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled,
+					thread::IoThreadPool* pPool = nullptr)
 					: BlockHitPredicateFactory(BlockHitPredicate) {
-				Processor = CreateBlockchainProcessor(
-						[this](const auto& cache) {
-							return BlockHitPredicateFactory(cache);
-						},
-						[this](auto height, auto timestamp, const auto& entities, auto& state) {
-							return BatchEntityProcessor(height, timestamp, entities, state);
-						},
-						receiptValidationMode);
+				consumers::BlockHitPredicateFactory blockHitPredicateFactory = [this](const auto& cache) {
+					return BlockHitPredicateFactory(cache);
+				};
+				chain::BatchEntityProcessor batchEntityProcessor = [this](auto height, auto timestamp, const auto& entities, auto& state) {
+					return BatchEntityProcessor(height, timestamp, entities, state);
+				};
+
+				Processor = pPool
+						? CreateBlockchainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, *pPool)
+						: CreateBlockchainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
 			}
 
 		public:
@@ -664,27 +669,38 @@ namespace catapult { namespace consumers {
 
 	// region invalid - state hash
 
-	TEST(TEST_CLASS, ExecuteShortCircuitsOnInconsistentStateHash) {
-		// Arrange:
-		ProcessorTestContext context;
-		auto pParentBlock = test::GenerateEmptyRandomBlock();
-		auto elements = test::CreateBlockElements(3);
-		PrepareChain(Height(11), *pParentBlock, elements);
+	namespace {
+		void AssertShortCircuitsOnInconsistentStateHash(thread::IoThreadPool* pPool) {
+			// Arrange:
+			ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool);
+			auto pParentBlock = test::GenerateEmptyRandomBlock();
+			auto elements = test::CreateBlockElements(3);
+			PrepareChain(Height(11), *pParentBlock, elements);
 
-		// - invalidate the second block state hash
-		test::FillWithRandomData(const_cast<model::Block&>(elements[1].Block).StateHash);
+			// - invalidate the second block state hash
+			test::FillWithRandomData(const_cast<model::Block&>(elements[1].Block).StateHash);
 
-		// Act:
-		auto result = context.Process(*pParentBlock, elements);
+			// Act:
+			auto result = context.Process(*pParentBlock, elements);
 
-		// Assert:
-		// - block hit predicate returned true
-		// - processor returned success
-		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
-		EXPECT_EQ(2u, context.BlockHitPredicate.params().size());
-		EXPECT_EQ(2u, context.BatchEntityProcessor.params().size());
-		context.assertBlockHitPredicateCalls(*pParentBlock, elements);
-		context.assertBatchEntityProcessorCalls(elements);
+			// Assert:
+			// - block hit predicate returned true
+			// - processor returned success
+			EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+			EXPECT_EQ(2u, context.BlockHitPredicate.params().size());
+			EXPECT_EQ(2u, context.BatchEntityProcessor.params().size());
+			context.assertBlockHitPredicateCalls(*pParentBlock, elements);
+			context.assertBatchEntityProcessorCalls(elements);
+		}
+	}
+
+	TEST(TEST_CLASS, ExecuteShortCircuitsOnInconsistentStateHash) {
+		AssertShortCircuitsOnInconsistentStateHash(nullptr);
+	}
+
+	TEST(TEST_CLASS, ExecuteShortCircuitsOnInconsistentStateHash_Parallel) {
+		auto pPool = test::CreateStartedIoThreadPool();
+		AssertShortCircuitsOnInconsistentStateHash(pPool.get());
 	}
 
 	// endregion
@@ -765,9 +781,9 @@ namespace catapult { namespace consumers {
 	// region update - sub cache merkle roots
 
 	namespace {
-		void AssertSubCacheMerkleRootsAreUpdatedCorrectly(size_t numExpectedBlocks) {
+		void AssertSubCacheMerkleRootsAreUpdatedCorrectly(size_t numExpectedBlocks, thread::IoThreadPool* pPool = nullptr) {
 			// Arrange:
-			ProcessorTestContext context;
+			ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool);
 			auto pParentBlock = test::GenerateEmptyRandomBlock();
 			auto elements = test::CreateBlockElements(numExpectedBlocks);
 			PrepareChain(Height(11), *pParentBlock, elements);
@@ -801,6 +817,11 @@ namespace catapult { namespace consumers {
 		AssertSubCacheMerkleRootsAreUpdatedCorrectly(3);
 	}
 
+	TEST(TEST_CLASS, SetsSubCacheMerkleRootsInMultiBlockInput_Parallel) {
+		auto pPool = test::CreateStartedIoThreadPool();
+		AssertSubCacheMerkleRootsAreUpdatedCorrectly(3, pPool.get());
+	}
+
 	// endregion
 
 	// region update - block statements
@@ -373,13 +373,13 @@ namespace catapult { namespace consumers {
 			};
 
 		public:
-			static cache::CatapultCache Create(PruneIdentifiers& pruneIdentifiers) {
+			static cache::CatapultCache Create(PruneIdentifiers& pruneIdentifiers, size_t& numSyncs) {
 				auto config = model::BlockchainConfiguration::Uninitialized();
 				config.VotingSetGrouping = 1;
 
 				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(3);
 				test::CoreSystemCacheFactory::CreateSubCaches(config, subCaches);
-				subCaches[PruneAwareCacheSubCachePlugin::Id] = std::make_unique<PruneAwareCacheSubCachePlugin>(pruneIdentifiers);
+				subCaches[PruneAwareCacheSubCachePlugin::Id] = std::make_unique<PruneAwareCacheSubCachePlugin>(pruneIdentifiers, numSyncs);
 
 				auto cache = cache::CatapultCache(std::move(subCaches));
 				test::AddMarkerAccount(cache);
@@ -411,7 +411,9 @@ namespace catapult { namespace consumers {
 				static constexpr auto Name = "PruneAwareCache";
 
 			public:
-				explicit PruneAwareCacheSubCachePlugin(PruneIdentifiers& pruneIdentifiers) : m_pruneIdentifiers(pruneIdentifiers)
+				PruneAwareCacheSubCachePlugin(PruneIdentifiers& pruneIdentifiers, size_t& numSyncs)
+						: m_pruneIdentifiers(pruneIdentifiers)
+						, m_numSyncs(numSyncs)
 				{}
 
 			public:
@@ -426,8 +428,13 @@ namespace catapult { namespace consumers {
 				void commit() override
 				{}
 
+				void sync() override {
+					++m_numSyncs;
+				}
+
 			private:
 				PruneIdentifiers& m_pruneIdentifiers;
+				size_t& m_numSyncs;
 			};
 		};
 
@@ -444,7 +451,8 @@ namespace catapult { namespace consumers {
 			{}
 
 			ConsumerTestContext(std::unique_ptr<io::BlockStorage>&& pStorage, std::unique_ptr<io::PrunableBlockStorage>&& pStagingStorage)
-					: Cache(CatapultCacheFactory::Create(CachePruneIdentifiers))
+					: NumCacheSyncs(0)
+					, Cache(CatapultCacheFactory::Create(CachePruneIdentifiers, NumCacheSyncs))
 					, Storage(std::move(pStorage), std::move(pStagingStorage))
 					, LocalFinalizedHeightHashPair{ Height(1), Hash256() }
 					, NetworkFinalizedHeightHashPair{ Height(1), Hash256() } {
@@ -480,6 +488,7 @@ namespace catapult { namespace consumers {
 					return TransactionsChange(changeInfo);
 				};
 				handlers.CommitStep = [this](auto step) {
+					NumCacheSyncsAtCommitSteps.push_back(NumCacheSyncs);
 					return CommitStep(step);
 				};
 
@@ -488,6 +497,8 @@ namespace catapult { namespace consumers {
 
 		public:
 			CatapultCacheFactory::PruneIdentifiers CachePruneIdentifiers;
+			size_t NumCacheSyncs;
+			std::vector<size_t> NumCacheSyncsAtCommitSteps;
 			cache::CatapultCache Cache;
 			io::BlockStorageCache Storage;
 			model::HeightHashPair LocalFinalizedHeightHashPair;
@@ -651,6 +662,9 @@ namespace catapult { namespace consumers {
 				EXPECT_EQ(CommitOperationStep::Blocks_Written, CommitStep.params()[0]);
 				EXPECT_EQ(CommitOperationStep::State_Written, CommitStep.params()[1]);
 				EXPECT_EQ(CommitOperationStep::All_Updated, CommitStep.params()[2]);
+
+				// - cache was synced after state was written but before all updated step was announced
+				EXPECT_EQ(std::vector<size_t>({ 0, 0, 1 }), NumCacheSyncsAtCommitSteps);
 			}
 		};
 
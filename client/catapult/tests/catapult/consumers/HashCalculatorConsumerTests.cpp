@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
@@ -150,14 +151,19 @@ namespace catapult { namespace consumers {
 			EXPECT_EQ(numExpectedTransactions, numTransactions);
 		}
 
-		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+		using BlockConsumerFactory = std::function<disruptor::BlockConsumer (const model::TransactionRegistry&)>;
+
+		void AssertBlockHashesAreCalculatedCorrectly(
+				uint32_t numBlocks,
+				uint32_t numTransactionsPerBlock,
+				const BlockConsumerFactory& consumerFactory) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateBlockConsumerInput(registry, numBlocks, numTransactionsPerBlock);
 			auto& blockElements = input.blocks();
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry)(blockElements);
+			auto result = consumerFactory(registry)(blockElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -165,6 +171,12 @@ namespace catapult { namespace consumers {
 			for (const auto& blockElement : blockElements)
 				AssertCorrectHashes(blockElement, numTransactionsPerBlock);
 		}
+
+		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+			AssertBlockHashesAreCalculatedCorrectly(numBlocks, numTransactionsPerBlock, [](const auto& registry) {
+				return CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry);
+			});
+		}
 	}
 
 	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
@@ -188,6 +200,18 @@ namespace catapult { namespace consumers {
 		AssertBlockHashesAreCalculatedCorrectly(3, 4);
 	}
 
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactions_ParallelTransactionsHash) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(4);
+
+		// Assert: only blocks with at least 10 transactions are hashed in parallel
+		for (auto numTransactionsPerBlock : { 4u, 10u, 17u }) {
+			AssertBlockHashesAreCalculatedCorrectly(3, numTransactionsPerBlock, [&pool = *pPool](const auto& registry) {
+				return CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, pool, 10);
+			});
+		}
+	}
+
 	TEST(BLOCK_TEST_CLASS, CalculatesCorrectHashForDeterministicEntity) {
 		// Arrange:
 		auto generationHashSeed = utils::ParseByteArray<GenerationHashSeed>(test::Deterministic_Network_Generation_Hash_Seed_String);
@@ -241,6 +265,21 @@ namespace catapult { namespace consumers {
 		}
 	}
 
+	TEST(BLOCK_TEST_CLASS, EntitiesAreSkippedWhenBlockTransactionsHashDoesNotMatch_ParallelTransactionsHash) {
+		// Arrange: corrupt the block transactions hash
+		auto pPool = test::CreateStartedIoThreadPool(4);
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(3, 17);
+		auto& blockElements = input.blocks();
+		const_cast<model::Block&>(blockElements[1].Block).TransactionsHash[0] ^= 0xFF;
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, *pPool, 10)(blockElements);
+
+		// Assert: the elements were skipped because a block transactions hash didn't match
+		test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch, disruptor::ConsumerResultSeverity::Failure);
+	}
+
 	TEST(BLOCK_TEST_CLASS, SingleEntityIsSkippedWhenBlockTransactionsHashDoesNotMatch) {
 		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(1, 0, 0);
 		AssertBlockWithMismatchedBlockTransactionsHashIsSkipped(1, 3, 0);
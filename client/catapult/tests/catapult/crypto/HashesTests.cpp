@@ -756,4 +756,101 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region builder reset
+
+	namespace {
+		template<typename THashBuilder, typename TCalculateHashSingle>
+		void AssertResetBuilderMatchesSingleCallVariant(TCalculateHashSingle calculateHashSingle) {
+			using OutputHashType = typename THashBuilder::OutputType;
+
+			// Arrange: partially hash some unrelated data
+			THashBuilder hashBuilder;
+			hashBuilder.update(test::HexStringToVector(Data_Sets_Long[0]));
+
+			for (const auto& dataStr : Data_Sets_Long) {
+				OutputHashType expected;
+				auto buffer = test::HexStringToVector(dataStr);
+				calculateHashSingle(buffer, expected);
+
+				// Act:
+				OutputHashType result;
+				hashBuilder.reset();
+				hashBuilder.update(buffer);
+				hashBuilder.final(result);
+
+				// Assert:
+				EXPECT_EQ(expected, result);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, Sha512_ResetBuilderMatchesSingleCallVariant) {
+		AssertResetBuilderMatchesSingleCallVariant<Sha512_Builder>(Sha512_Traits::HashFunc);
+	}
+
+	SHA3_TRAITS_BASED_TEST(ResetBuilderMatchesSingleCallVariant) {
+		AssertResetBuilderMatchesSingleCallVariant<typename TTraits::HashBuilder>(TTraits::HashFunc);
+	}
+
+	// endregion
+
+	// region Sha3_256Multi
+
+	namespace {
+		std::vector<RawBuffer> ToRawBuffers(const std::vector<std::vector<uint8_t>>& buffers) {
+			std::vector<RawBuffer> rawBuffers;
+			for (const auto& buffer : buffers)
+				rawBuffers.push_back(buffer);
+
+			return rawBuffers;
+		}
+	}
+
+	TEST(TEST_CLASS, Sha3_256Multi_CanHashZeroBuffers) {
+		// Act + Assert: no exception
+		Sha3_256Multi(nullptr, 0, nullptr);
+	}
+
+	TEST(TEST_CLASS, Sha3_256Multi_MatchesSingleCallVariant) {
+		// Arrange: include an empty buffer
+		std::vector<std::vector<uint8_t>> buffers{ {} };
+		for (const auto& dataStr : Data_Sets_Long)
+			buffers.push_back(test::HexStringToVector(dataStr));
+
+		auto rawBuffers = ToRawBuffers(buffers);
+
+		// Act:
+		std::vector<Hash256> hashes(buffers.size());
+		Sha3_256Multi(rawBuffers.data(), rawBuffers.size(), hashes.data());
+
+		// Assert:
+		for (auto i = 0u; i < buffers.size(); ++i) {
+			Hash256 expectedHash;
+			Sha3_256(buffers[i], expectedHash);
+			EXPECT_EQ(expectedHash, hashes[i]) << "at index " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, Sha3_256Multi_CanOverwriteBuffersThatHaveAlreadyBeenHashed) {
+		// Arrange: hash consecutive pairs of hashes in place
+		auto hashes = test::GenerateRandomDataVector<Hash256>(8);
+		auto originalHashes = hashes;
+
+		std::vector<RawBuffer> rawBuffers;
+		for (auto i = 0u; i < hashes.size(); i += 2)
+			rawBuffers.push_back({ hashes[i].data(), 2 * Hash256::Size });
+
+		// Act:
+		Sha3_256Multi(rawBuffers.data(), rawBuffers.size(), hashes.data());
+
+		// Assert:
+		for (auto i = 0u; i < rawBuffers.size(); ++i) {
+			Hash256 expectedHash;
+			Sha3_256({ originalHashes[2 * i].data(), 2 * Hash256::Size }, expectedHash);
+			EXPECT_EQ(expectedHash, hashes[i]) << "at index " << i;
+		}
+	}
+
+	// endregion
 }}
@@ -288,6 +288,98 @@ namespace catapult { namespace crypto {
 
 	// endregion
 
+	// region final - parallel
+
+	namespace {
+		Hash256 CalculateMerkleHashParallel(
+				const Hashes& hashes,
+				size_t minParallelLeafCount,
+				size_t maxPartitions,
+				std::vector<size_t>& numPartitionsPerCall) {
+			// Arrange: process partitions in reverse order to ensure results are independent of processing order
+			MerkleHashParallelOptions options;
+			options.MinParallelLeafCount = minParallelLeafCount;
+			options.MaxPartitions = maxPartitions;
+			options.ProcessPartitions = [&numPartitionsPerCall](auto numPartitions, const auto& processPartition) {
+				numPartitionsPerCall.push_back(numPartitions);
+				for (auto i = numPartitions; i > 0; --i)
+					processPartition(i - 1);
+			};
+
+			MerkleHashBuilder builder;
+			for (const auto& hash : hashes)
+				builder.update(hash);
+
+			// Act:
+			Hash256 result;
+			builder.final(result, options);
+			return result;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelFinalDelegatesToSingleThreadedFinalBelowLeafThreshold) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(15);
+		std::vector<size_t> numPartitionsPerCall;
+
+		// Act:
+		auto result = CalculateMerkleHashParallel(seedHashes, 16, 4, numPartitionsPerCall);
+
+		// Assert:
+		EXPECT_EQ(CalculateMerkleResult<MerkleHashTraits>(seedHashes), result);
+		EXPECT_TRUE(numPartitionsPerCall.empty());
+	}
+
+	TEST(TEST_CLASS, ParallelFinalDelegatesToSingleThreadedFinalWhenSinglePartitionIsAllowed) {
+		// Arrange:
+		auto seedHashes = GenerateRandomHashes(15);
+		std::vector<size_t> numPartitionsPerCall;
+
+		// Act:
+		auto result = CalculateMerkleHashParallel(seedHashes, 0, 1, numPartitionsPerCall);
+
+		// Assert:
+		EXPECT_EQ(CalculateMerkleResult<MerkleHashTraits>(seedHashes), result);
+		EXPECT_TRUE(numPartitionsPerCall.empty());
+	}
+
+	TEST(TEST_CLASS, ParallelFinalSplitsLeavesIntoAtMostMaxPartitions) {
+		// Arrange:
+		std::vector<std::pair<size_t, size_t>> expectedNumPartitionsPairs{
+			{ 2, 2 }, { 4, 4 }, { 5, 3 }, { 8, 4 }, { 9, 3 }, { 16, 4 }, { 17, 3 }, { 100, 4 }
+		};
+
+		for (const auto& pair : expectedNumPartitionsPairs) {
+			std::vector<size_t> numPartitionsPerCall;
+
+			// Act:
+			CalculateMerkleHashParallel(GenerateRandomHashes(pair.first), 0, 4, numPartitionsPerCall);
+
+			// Assert:
+			EXPECT_EQ(std::vector<size_t>{ pair.second }, numPartitionsPerCall) << "for " << pair.first << " leaves";
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelFinalProducesSameMerkleHashAsSingleThreadedFinal) {
+		for (auto numHashes : { 0u, 1u, 2u, 3u, 5u, 8u, 13u, 31u, 32u, 33u, 64u, 100u, 257u }) {
+			// Arrange:
+			auto seedHashes = GenerateRandomHashes(numHashes);
+			auto expectedResult = CalculateMerkleResult<MerkleHashTraits>(seedHashes);
+
+			for (auto maxPartitions : { 2u, 3u, 4u, 7u, 8u, 16u }) {
+				std::vector<size_t> numPartitionsPerCall;
+
+				// Act:
+				auto result = CalculateMerkleHashParallel(seedHashes, 0, maxPartitions, numPartitionsPerCall);
+
+				// Assert:
+				EXPECT_EQ(expectedResult, result) << "for " << numHashes << " leaves and " << maxPartitions << " partitions";
+			}
+		}
+	}
+
+	// endregion
+
 	// region treeSize
 
 	TEST(TEST_CLASS, TreeSizeReturnsExpectedValue) {
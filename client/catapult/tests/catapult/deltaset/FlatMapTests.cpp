@@ -0,0 +1,513 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/deltaset/FlatMap.h"
+#include "tests/catapult/deltaset/test/BaseSetDeltaTests.h"
+#include "tests/catapult/deltaset/test/BaseSetTests.h"
+#include <map>
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		template<typename TMutabilityTraits>
+		using FlatMapTraits = test::BaseSetTraits<TMutabilityTraits, test::FlatMapSetTraits<test::SetElementType<TMutabilityTraits>>>;
+
+		using FlatMapMutableTraits = FlatMapTraits<test::MutableElementValueTraits>;
+		using FlatMapImmutableTraits = FlatMapTraits<test::ImmutableElementValueTraits>;
+	}
+
+// base (mutable)
+DEFINE_MUTABLE_BASE_SET_TESTS_FOR(FlatMapMutable)
+
+// base (immutable)
+DEFINE_IMMUTABLE_BASE_SET_TESTS_FOR(FlatMapImmutable)
+
+// delta (mutable)
+DEFINE_MUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapMutable)
+
+// delta (immutable)
+DEFINE_IMMUTABLE_BASE_SET_DELTA_TESTS_FOR(FlatMapImmutable)
+
+#define TEST_CLASS FlatMapTests
+
+	// region test utils
+
+	namespace {
+		// hasher that maps all keys to a few hashes in order to force long probe sequences
+		struct CollidingHasher {
+			size_t operator()(uint32_t key) const {
+				return key % 3;
+			}
+		};
+
+		using TestMap = FlatMap<uint32_t, std::string>;
+		using CollidingTestMap = FlatMap<uint32_t, std::string, CollidingHasher>;
+
+		template<typename TMap>
+		void InsertRange(TMap& map, uint32_t begin, uint32_t end) {
+			for (auto i = begin; i < end; ++i)
+				map.emplace(i, std::to_string(i));
+		}
+
+		template<typename TMap>
+		std::map<uint32_t, std::string> ToOrderedMap(const TMap& map) {
+			return std::map<uint32_t, std::string>(map.cbegin(), map.cend());
+		}
+
+		std::map<uint32_t, std::string> CreateExpectedMap(std::initializer_list<uint32_t> keys) {
+			std::map<uint32_t, std::string> expectedMap;
+			for (auto key : keys)
+				expectedMap.emplace(key, std::to_string(key));
+
+			return expectedMap;
+		}
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyMap) {
+		// Act:
+		TestMap map;
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(0u, map.size());
+		EXPECT_EQ(map.cend(), map.cbegin());
+		EXPECT_EQ(0u, map.count(1));
+	}
+
+	TEST(TEST_CLASS, CanCopyConstructMap) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		auto copy = map;
+		copy.erase(4);
+
+		// Assert:
+		EXPECT_EQ(10u, map.size());
+		EXPECT_EQ(9u, copy.size());
+		EXPECT_EQ(1u, map.count(4));
+		EXPECT_EQ(0u, copy.count(4));
+	}
+
+	TEST(TEST_CLASS, CanMoveConstructMap) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+		const auto* pValue = &map.find(4)->second;
+
+		// Act:
+		auto movedMap = std::move(map);
+
+		// Assert:
+		EXPECT_EQ(10u, movedMap.size());
+		EXPECT_EQ(pValue, &movedMap.find(4)->second);
+	}
+
+	TEST(TEST_CLASS, MoveOperationsDoNotThrow) {
+		EXPECT_TRUE(std::is_nothrow_move_constructible_v<TestMap>);
+		EXPECT_TRUE(std::is_nothrow_move_assignable_v<TestMap>);
+	}
+
+	// endregion
+
+	// region insert / emplace
+
+	TEST(TEST_CLASS, CanInsertElements) {
+		// Arrange:
+		TestMap map;
+
+		// Act:
+		auto result1 = map.insert(std::make_pair(5u, std::string("five")));
+		auto result2 = map.emplace(7u, "seven");
+
+		// Assert:
+		EXPECT_TRUE(result1.second);
+		EXPECT_TRUE(result2.second);
+		EXPECT_EQ(2u, map.size());
+		EXPECT_EQ("five", result1.first->second);
+		EXPECT_EQ("seven", result2.first->second);
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotReplaceExistingElement) {
+		// Arrange:
+		TestMap map;
+		auto originalIter = map.emplace(5u, "five").first;
+
+		// Act:
+		auto result = map.emplace(5u, "FIVE");
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(originalIter, result.first);
+		EXPECT_EQ(1u, map.size());
+		EXPECT_EQ("five", map.find(5)->second);
+	}
+
+	TEST(TEST_CLASS, CanInsertRange) {
+		// Arrange:
+		std::map<uint32_t, std::string> source{ { 1, "1" }, { 3, "3" }, { 9, "9" } };
+		TestMap map;
+
+		// Act:
+		map.insert(source.cbegin(), source.cend());
+
+		// Assert:
+		EXPECT_EQ(source, ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, ReferencesRemainValidWhenMapGrows) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 5);
+		auto* pValue = &map.find(3)->second;
+
+		// Act: force multiple rehashes and chunk allocations
+		InsertRange(map, 5, 1000);
+
+		// Assert:
+		EXPECT_EQ(1000u, map.size());
+		EXPECT_EQ(pValue, &map.find(3)->second);
+		EXPECT_EQ("3", *pValue);
+	}
+
+	namespace {
+		std::pair<TestMap::iterator, bool> EmplaceThrowing(TestMap& map, uint32_t key) {
+			// string construction throws when the requested length exceeds the maximum string length
+			auto length = std::string().max_size() + 1;
+			return map.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(length, 'x'));
+		}
+	}
+
+	TEST(TEST_CLASS, ThrowingEmplaceDoesNotModifyMap) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		EXPECT_THROW(EmplaceThrowing(map, 100), std::length_error);
+
+		// Assert:
+		EXPECT_EQ(10u, map.size());
+		EXPECT_EQ(0u, map.count(100));
+		EXPECT_EQ(CreateExpectedMap({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, ThrowingEmplaceDoesNotLeakFreeEntry) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+		const auto* pErasedValue = &map.find(7)->second;
+		map.erase(7);
+
+		// Act:
+		EXPECT_THROW(EmplaceThrowing(map, 100), std::length_error);
+		auto iter = map.emplace(100u, "100").first;
+
+		// Assert: erased entry is reused by the next successful emplace
+		EXPECT_EQ(pErasedValue, &iter->second);
+		EXPECT_EQ(10u, map.size());
+	}
+
+	TEST(TEST_CLASS, ThrowingEmplaceDoesNotLeakNewEntry) {
+		// Arrange:
+		TestMap expectedMap;
+		InsertRange(expectedMap, 0, 11);
+
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		EXPECT_THROW(EmplaceThrowing(map, 100), std::length_error);
+		map.emplace(10u, "10");
+
+		// Assert: next successful emplace uses the same entry as in a map without the throwing emplace
+		auto getEntryOffset = [](const auto& testMap) {
+			const auto* pLastValue = reinterpret_cast<const uint8_t*>(&testMap.find(10)->second);
+			return pLastValue - reinterpret_cast<const uint8_t*>(&testMap.find(9)->second);
+		};
+		EXPECT_EQ(getEntryOffset(expectedMap), getEntryOffset(map));
+		EXPECT_EQ(CreateExpectedMap({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }), ToOrderedMap(map));
+	}
+
+	// endregion
+
+	// region find
+
+	TEST(TEST_CLASS, CanFindAllElements) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 100);
+
+		// Act + Assert:
+		for (auto i = 0u; i < 100; ++i) {
+			auto iter = map.find(i);
+			ASSERT_NE(map.cend(), iter) << i;
+			EXPECT_EQ(std::to_string(i), iter->second) << i;
+		}
+
+		EXPECT_EQ(1u, map.count(17));
+		EXPECT_EQ(0u, map.count(100));
+	}
+
+	TEST(TEST_CLASS, SubscriptOperatorReturnsExistingValue) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		auto& value = map[4];
+		value = "four";
+
+		// Assert:
+		EXPECT_EQ(10u, map.size());
+		EXPECT_EQ("four", map.find(4)->second);
+	}
+
+	TEST(TEST_CLASS, SubscriptOperatorInsertsDefaultValueWhenKeyIsUnknown) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		auto& value = map[14];
+
+		// Assert:
+		EXPECT_EQ(11u, map.size());
+		EXPECT_EQ("", value);
+		EXPECT_EQ(&value, &map.find(14)->second);
+	}
+
+	TEST(TEST_CLASS, CanModifyElementThroughMutableIterator) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+
+		// Act:
+		map.find(4)->second = "four";
+
+		// Assert:
+		EXPECT_EQ("four", map.find(4)->second);
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseByKey) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 5);
+
+		// Act:
+		auto numErased1 = map.erase(2);
+		auto numErased2 = map.erase(2);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(CreateExpectedMap({ 0, 1, 3, 4 }), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, CanEraseByIterator) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 5);
+
+		// Act:
+		auto iter = map.erase(map.find(2));
+
+		// Assert:
+		EXPECT_NE(map.cend(), iter);
+		EXPECT_EQ(CreateExpectedMap({ 0, 1, 3, 4 }), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElementsByIterator) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 50);
+
+		// Act:
+		for (auto iter = map.begin(); map.end() != iter;)
+			iter = map.erase(iter);
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.cend(), map.cbegin());
+	}
+
+	TEST(TEST_CLASS, EraseKeepsCollidingElementsReachable) {
+		// Arrange:
+		CollidingTestMap map;
+		InsertRange(map, 0, 60);
+
+		// Act:
+		for (auto i = 0u; i < 60; i += 2)
+			map.erase(i);
+
+		// Assert:
+		EXPECT_EQ(30u, map.size());
+		for (auto i = 0u; i < 60; ++i)
+			EXPECT_EQ(0 == i % 2 ? 0u : 1u, map.count(i)) << i;
+	}
+
+	TEST(TEST_CLASS, RandomInsertsAndErasesMatchOrderedMap) {
+		// Arrange:
+		CollidingTestMap map;
+		std::map<uint32_t, std::string> expectedMap;
+
+		// Act:
+		for (auto i = 0u; i < 5000; ++i) {
+			auto key = static_cast<uint32_t>(test::Random() % 200);
+			if (0 == test::Random() % 3) {
+				map.erase(key);
+				expectedMap.erase(key);
+			} else {
+				map.emplace(key, std::to_string(key));
+				expectedMap.emplace(key, std::to_string(key));
+			}
+		}
+
+		// Assert:
+		EXPECT_EQ(expectedMap.size(), map.size());
+		EXPECT_EQ(expectedMap, ToOrderedMap(map));
+		for (auto key = 0u; key < 200; ++key)
+			EXPECT_EQ(expectedMap.count(key), map.count(key)) << key;
+	}
+
+	TEST(TEST_CLASS, ErasedEntriesAreReused) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 10);
+		const auto* pErasedValue = &map.find(7)->second;
+		map.erase(7);
+
+		// Act:
+		auto iter = map.emplace(100u, "100").first;
+
+		// Assert:
+		EXPECT_EQ(pErasedValue, &iter->second);
+		EXPECT_EQ(10u, map.size());
+	}
+
+	TEST(TEST_CLASS, CanClearMap) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		map.clear();
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.cend(), map.cbegin());
+		EXPECT_EQ(0u, map.count(5));
+	}
+
+	TEST(TEST_CLASS, CanReuseMapAfterClear) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 100);
+		map.clear();
+
+		// Act:
+		InsertRange(map, 50, 60);
+
+		// Assert:
+		EXPECT_EQ(CreateExpectedMap({ 50, 51, 52, 53, 54, 55, 56, 57, 58, 59 }), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, ClearRetainsEntryStorageForReuse) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 3);
+		const auto* pFirstValue = &*map.find(0);
+		map.clear();
+
+		// Act:
+		auto iter = map.emplace(100u, "100").first;
+
+		// Assert: the first entry is reused
+		EXPECT_EQ(pFirstValue, &*iter);
+		EXPECT_EQ(1u, map.size());
+	}
+
+	// endregion
+
+	// region iteration
+
+	TEST(TEST_CLASS, CanIterateAllElements) {
+		// Arrange:
+		CollidingTestMap map;
+		InsertRange(map, 0, 5);
+		map.erase(1);
+		map.emplace(9u, "9");
+
+		// Act:
+		auto orderedMap = ToOrderedMap(map);
+
+		// Assert:
+		EXPECT_EQ(CreateExpectedMap({ 0, 2, 3, 4, 9 }), orderedMap);
+	}
+
+	TEST(TEST_CLASS, MutableIteratorIsConvertibleToConstIterator) {
+		// Arrange:
+		TestMap map;
+		InsertRange(map, 0, 5);
+
+		// Act:
+		TestMap::const_iterator iter = map.find(3);
+
+		// Assert:
+		EXPECT_EQ(3u, iter->first);
+		EXPECT_EQ(&*map.find(3), &*iter);
+	}
+
+	// endregion
+
+	// region equality
+
+	TEST(TEST_CLASS, EqualityOperatorsCompareElements) {
+		// Arrange:
+		TestMap map1;
+		InsertRange(map1, 0, 10);
+
+		TestMap map2;
+		InsertRange(map2, 0, 10);
+
+		auto map3 = map1;
+		map3.find(4)->second = "four";
+
+		auto map4 = map1;
+		map4.erase(4);
+
+		// Act + Assert:
+		EXPECT_EQ(map1, map2);
+		EXPECT_NE(map1, map3);
+		EXPECT_NE(map1, map4);
+	}
+
+	// endregion
+}}
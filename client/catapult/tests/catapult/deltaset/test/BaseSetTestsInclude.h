@@ -51,6 +51,11 @@ namespace catapult { namespace test {
 		std::unordered_map<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
 		TestElementToKeyConverter<TElement>>;
 
+	template<typename TElement>
+	using FlatMapSetTraits = deltaset::MapStorageTraits<
+		deltaset::FlatMap<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
+		TestElementToKeyConverter<TElement>>;
+
 	// endregion
 
 	// region IsMutable / IsMap
@@ -26,6 +26,8 @@
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <set>
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -84,6 +86,14 @@ namespace catapult { namespace disruptor {
 		AssertCannotCreateWithOptions([](auto& options) { options.DisruptorMaxMemorySize = utils::FileSize(); });
 	}
 
+	TEST(TEST_CLASS, CannotCreateDispatcherWithZeroMaxConsumerBatchSize) {
+		AssertCannotCreateWithOptions([](auto& options) { options.MaxConsumerBatchSize = 0; });
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithZeroLatencyWindowDuration) {
+		AssertCannotCreateWithOptions([](auto& options) { options.LatencyWindowDuration = utils::TimeSpan(); });
+	}
+
 	TEST(TEST_CLASS, CanCreateEmptyDispatcher) {
 		// Arrange:
 		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {});
@@ -249,6 +259,113 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region statistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyEmpty) {
+		// Arrange + Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Assert:
+		for (auto level = 0u; level < 2; ++level) {
+			EXPECT_EQ(0u, dispatcher.queueDepth(level)) << level;
+			EXPECT_EQ(0u, dispatcher.stageLatencies(level).count()) << level;
+		}
+
+		EXPECT_EQ(0u, dispatcher.elementLatencies().count());
+	}
+
+	TEST(TEST_CLASS, CannotRetrieveStatisticsForUnknownConsumer) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Act + Assert:
+		EXPECT_THROW(dispatcher.queueDepth(2), catapult_invalid_argument);
+		EXPECT_THROW(dispatcher.stageLatencies(2), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, QueueDepthReportsNumberOfElementsWaitingForEachConsumer) {
+		// Arrange: block the second consumer on the first element
+		std::atomic<size_t> numFirstConsumerCalls(0);
+		test::AutoSetFlag isSecondConsumerUnblocked;
+		auto pIsUnblocked = isSecondConsumerUnblocked.state();
+
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {
+			[&numFirstConsumerCalls](const auto&) {
+				++numFirstConsumerCalls;
+				return ConsumerResult::Continue();
+			},
+			[pIsUnblocked](const auto&) {
+				pIsUnblocked->wait();
+				return ConsumerResult::Continue();
+			},
+			CreateNoOpConsumer()
+		});
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(5));
+		WAIT_FOR_VALUE(5u, numFirstConsumerCalls);
+
+		// Assert: all elements are waiting for (or being processed by) the second consumer
+		EXPECT_EQ(0u, dispatcher.queueDepth(0));
+		EXPECT_EQ(5u, dispatcher.queueDepth(1));
+		EXPECT_EQ(0u, dispatcher.queueDepth(2));
+
+		// Act: unblock the second consumer
+		isSecondConsumerUnblocked.state()->set();
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		for (auto level = 0u; level < 3; ++level)
+			EXPECT_EQ(0u, dispatcher.queueDepth(level)) << level;
+	}
+
+	TEST(TEST_CLASS, LatenciesAreRecordedForEachConsumerAndElement) {
+		// Arrange: only the second consumer is slow
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, {
+			CreateNoOpConsumer(),
+			[](const auto&) {
+				test::Sleep(5);
+				return ConsumerResult::Continue();
+			}
+		});
+
+		// Act:
+		ProcessAll(dispatcher, test::PrepareRanges(3));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: one batch is processed per element because max batch size is one
+		EXPECT_EQ(3u, dispatcher.stageLatencies(0).count());
+		EXPECT_EQ(3u, dispatcher.stageLatencies(1).count());
+		EXPECT_LE(5'000u, dispatcher.stageLatencies(1).percentile(0));
+
+		// - all elements spent at least as long in the disruptor as in the slow consumer
+		EXPECT_EQ(3u, dispatcher.elementLatencies().count());
+		EXPECT_LE(5'000u, dispatcher.elementLatencies().percentile(0));
+		EXPECT_LE(15'000u, dispatcher.elementLatencies().max());
+	}
+
+	TEST(TEST_CLASS, LatenciesRecordedBeforePreviousWindowAreNotReported) {
+		// Arrange:
+		auto options = Test_Dispatcher_Options;
+		options.LatencyWindowDuration = utils::TimeSpan::FromMilliseconds(10);
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer() });
+
+		ProcessAll(dispatcher, test::PrepareRanges(3));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Act: wait until the window in which the latencies were recorded is neither the current nor the previous window
+		test::Sleep(30);
+
+		// Assert:
+		EXPECT_EQ(0u, dispatcher.stageLatencies(0).count());
+		EXPECT_EQ(0u, dispatcher.stageLatencies(0).max());
+		EXPECT_EQ(0u, dispatcher.elementLatencies().count());
+		EXPECT_EQ(0u, dispatcher.elementLatencies().max());
+		EXPECT_EQ(0u, dispatcher.elementLatencies().percentile(99));
+	}
+
+	// endregion
+
 	// region process + consume (no inspect)
 
 	namespace {
@@ -322,6 +439,54 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(expectedIds, ids);
 	}
 
+	TEST(TEST_CLASS, ProcessElementSupportsMultipleConcurrentProducers) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Elements_Per_Producer = 50u;
+		constexpr auto Num_Elements = Num_Producers * Num_Elements_Per_Producer;
+
+		std::atomic<size_t> numConsumerCalls(0);
+		std::atomic<size_t> numInspectorCalls(0);
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					[&numConsumerCalls](const auto&) {
+						++numConsumerCalls;
+						return ConsumerResult::Continue();
+					}
+				},
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// Act:
+		std::vector<std::vector<DisruptorElementId>> producerIds(Num_Producers);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.emplace_back([&dispatcher, &ids = producerIds[i]]() {
+				for (auto j = 0u; j < Num_Elements_Per_Producer; ++j)
+					ids.push_back(dispatcher.processElement(ConsumerInput(test::CreateBlockEntityRange(1))));
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		WAIT_FOR_VALUE(Num_Elements, numInspectorCalls);
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all elements were added with unique ids and processed
+		std::set<DisruptorElementId> allIds;
+		for (const auto& ids : producerIds)
+			allIds.insert(ids.cbegin(), ids.cend());
+
+		EXPECT_EQ(Num_Elements, allIds.size());
+		EXPECT_EQ(1u, *allIds.cbegin());
+		EXPECT_EQ(Num_Elements, *allIds.crbegin());
+
+		EXPECT_EQ(Num_Elements, dispatcher.numAddedElements());
+		EXPECT_EQ(Num_Elements, numConsumerCalls);
+		EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+	}
+
 	TEST(TEST_CLASS, ConsumerIsNotPassedEmptyInput) {
 		// Arrange:
 		std::vector<model::BlockRange> ranges;
@@ -473,6 +638,67 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	namespace {
+		void AssertCanConsumeAndInspectAllElementsWithWaitStrategy(DisruptorWaitStrategy waitStrategy) {
+			// Arrange:
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			CollectedHeights collectedHeights[2];
+			CollectedHeights inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+			EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+			EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+			EXPECT_EQ(expectedHeights, inspectedHeights.get());
+			EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Sleep) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(DisruptorWaitStrategy::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_BusySpin) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(DisruptorWaitStrategy::Busy_Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_SpinYield) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(DisruptorWaitStrategy::Spin_Yield);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Blocking) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(DisruptorWaitStrategy::Blocking);
+	}
+
+	TEST(TEST_CLASS, ShutdownWakesBlockedConsumers) {
+		// Arrange:
+		auto options = Test_Dispatcher_Options;
+		options.WaitStrategy = DisruptorWaitStrategy::Blocking;
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Act:
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
 	// endregion
 
 	// region element marking
@@ -549,6 +775,331 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region batch consumers
+
+	namespace {
+		class CollectedBatchSizes {
+		public:
+			size_t size() const {
+				return m_size;
+			}
+
+			const auto& get() const {
+				return m_batchSizes;
+			}
+
+		public:
+			void push_back(size_t batchSize) {
+				m_batchSizes.push_back(batchSize);
+				++m_size;
+			}
+
+		private:
+			std::atomic<size_t> m_size = 0;
+			std::vector<size_t> m_batchSizes;
+		};
+
+		auto CreateBatchConsumer(
+				CollectedHeights& heightsCollector,
+				CollectedBatchSizes& batchSizesCollector,
+				const predicate<const Heights&>& shouldAbort) {
+			return DisruptorBatchConsumer([&heightsCollector, &batchSizesCollector, shouldAbort](const auto& inputs) {
+				batchSizesCollector.push_back(inputs.size());
+
+				std::vector<ConsumerResult> results;
+				for (auto* pInput : inputs) {
+					auto heights = BlockElementVectorToHeights(pInput->blocks());
+					heightsCollector.push_back(heights);
+					results.push_back(shouldAbort(heights) ? ConsumerResult::Abort() : ConsumerResult::Continue());
+				}
+
+				return results;
+			});
+		}
+
+		auto CreateBatchConsumer(CollectedHeights& heightsCollector, CollectedBatchSizes& batchSizesCollector) {
+			return CreateBatchConsumer(heightsCollector, batchSizesCollector, [](const auto&) { return false; });
+		}
+
+		auto CreateBatchOptions(size_t maxConsumerBatchSize) {
+			auto options = Test_Dispatcher_Options;
+			options.MaxConsumerBatchSize = maxConsumerBatchSize;
+			return options;
+		}
+
+		auto PrepareRangesWithSequentialHeights(size_t count) {
+			auto ranges = test::PrepareRanges(count);
+			auto height = 0u;
+			for (auto& range : ranges)
+				range.begin()->Height = Height(++height);
+
+			return ranges;
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithBatchConsumers) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(10);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights[2];
+		CollectedBatchSizes collectedBatchSizes[2];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{
+					CreateBatchConsumer(collectedHeights[0], collectedBatchSizes[0]),
+					CreateBatchConsumer(collectedHeights[1], collectedBatchSizes[1])
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(10u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(2u, dispatcher.size());
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+		EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+		EXPECT_EQ(expectedHeights, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>(10, CompletionStatus::Normal), inspectedStatuses);
+
+		for (const auto& batchSizes : collectedBatchSizes) {
+			for (auto batchSize : batchSizes.get()) {
+				EXPECT_LE(1u, batchSize);
+				EXPECT_GE(4u, batchSize);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BatchConsumerProcessesAllQueuedElementsAtOnce) {
+		// Arrange: block the first consumer until all elements have been queued
+		std::atomic_bool isBlocked(false);
+		std::atomic_bool shouldUnblock(false);
+		CollectedHeights collectedHeights;
+		CollectedBatchSizes collectedBatchSizes;
+		auto batchConsumer = CreateBatchConsumer(collectedHeights, collectedBatchSizes);
+
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{
+					DisruptorBatchConsumer([&isBlocked, &shouldUnblock, batchConsumer](const auto& inputs) {
+						isBlocked = true;
+						WAIT_FOR(shouldUnblock);
+						return batchConsumer(inputs);
+					})
+				},
+				[](const auto&, const auto&) {});
+
+		auto ranges = test::PrepareRanges(10);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		// Act: push a single element and wait for the consumer to block
+		dispatcher.processElement(ConsumerInput(std::move(ranges[0])));
+		WAIT_FOR(isBlocked);
+
+		// - push remaining elements
+		for (auto i = 1u; i < ranges.size(); ++i)
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+
+		// - unblock the consumer
+		shouldUnblock = true;
+		WAIT_FOR_VALUE_EXPR(10u, collectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: queued elements were processed in batches bounded by max batch size
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+		EXPECT_EQ(std::vector<size_t>({ 1, 4, 4, 1 }), collectedBatchSizes.get());
+	}
+
+	TEST(TEST_CLASS, MarkedElementsAreNotPassedToHigherBatchConsumers) {
+		// Arrange:
+		CollectedHeights collectedHeights;
+		CollectedBatchSizes collectedBatchSizes;
+		auto ranges = PrepareRangesWithSequentialHeights(5);
+		auto expectedHeights = test::Filter(GetExpectedHeights(ranges), [](const auto& heights) {
+			return 1 == heights[0].unwrap() % 2;
+		});
+
+		// Act:
+		auto batchConsumers = DisruptorBatchConsumersFromConsumers({ CreateSkipIfFirstBlockIsEvenConsumer() });
+		batchConsumers.push_back(CreateBatchConsumer(collectedHeights, collectedBatchSizes));
+		ConsumerDispatcher dispatcher(CreateBatchOptions(5), batchConsumers, [](const auto&, const auto&) {});
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(3u, collectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+	}
+
+	TEST(TEST_CLASS, BatchConsumerResultsAreAttributedToIndividualElements) {
+		// Arrange:
+		CollectedHeights collectedHeights;
+		CollectedBatchSizes collectedBatchSizes;
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = PrepareRangesWithSequentialHeights(5);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(5),
+				std::vector<DisruptorBatchConsumer>{
+					CreateBatchConsumer(collectedHeights, collectedBatchSizes, [](const auto& heights) {
+						return 0 == heights[0].unwrap() % 2;
+					})
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+		EXPECT_EQ(expectedHeights, inspectedHeights.get());
+
+		// - ranges have heights 1-5, where even heights should be aborted
+		auto expectedStatuses = std::vector<CompletionStatus>(5, CompletionStatus::Normal);
+		expectedStatuses[1] = CompletionStatus::Aborted;
+		expectedStatuses[3] = CompletionStatus::Aborted;
+		EXPECT_EQ(expectedStatuses, inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, BatchConsumerWithCoalescingDelayWaitsForFullBatch) {
+		// Arrange:
+		CollectedHeights collectedHeights;
+		CollectedBatchSizes collectedBatchSizes;
+		auto batchConsumer = CreateBatchConsumer(collectedHeights, collectedBatchSizes);
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{ DisruptorBatchConsumer(batchConsumer, utils::TimeSpan::FromMinutes(1)) },
+				[](const auto&, const auto&) {});
+
+		auto ranges = test::PrepareRanges(4);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		// Act: push a partial batch
+		for (auto i = 0u; i < 3; ++i)
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+
+		// Assert: the partial batch is not processed before the deadline
+		test::Pause();
+		EXPECT_EQ(0u, collectedBatchSizes.size());
+
+		// Act: complete the batch
+		dispatcher.processElement(ConsumerInput(std::move(ranges[3])));
+		WAIT_FOR_VALUE_EXPR(4u, collectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: the full batch was processed at once
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+		EXPECT_EQ(std::vector<size_t>({ 4 }), collectedBatchSizes.get());
+	}
+
+	TEST(TEST_CLASS, BatchConsumerWithCoalescingDelayProcessesPartialBatchAfterDeadline) {
+		// Arrange:
+		CollectedHeights collectedHeights;
+		CollectedBatchSizes collectedBatchSizes;
+		auto batchConsumer = CreateBatchConsumer(collectedHeights, collectedBatchSizes);
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{ DisruptorBatchConsumer(batchConsumer, utils::TimeSpan::FromMilliseconds(50)) },
+				[](const auto&, const auto&) {});
+
+		auto ranges = test::PrepareRanges(2);
+		auto expectedHeights = GetExpectedHeights(ranges);
+
+		// Act: push a partial batch
+		auto startTime = std::chrono::steady_clock::now();
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(2u, collectedHeights.size());
+		auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: the partial batch was processed at once after the deadline
+		EXPECT_LE(std::chrono::milliseconds(50), elapsedTime);
+		EXPECT_EQ(expectedHeights, collectedHeights.get());
+		EXPECT_EQ(std::vector<size_t>({ 2 }), collectedBatchSizes.get());
+	}
+
+	TEST(TEST_CLASS, BatchConsumerWithShortCoalescingDelayProcessesPartialBatchAtDeadline) {
+		// Arrange: use a coalescing delay that is shorter than the max wait duration of the waiters (10ms)
+		constexpr auto Num_Elements = 5u;
+		std::vector<std::chrono::steady_clock::time_point> dispatchTimes(Num_Elements);
+		std::atomic<size_t> numDispatched(0);
+
+		auto batchConsumer = [&dispatchTimes, &numDispatched](const auto& inputs) {
+			dispatchTimes[numDispatched] = std::chrono::steady_clock::now();
+			++numDispatched;
+			return std::vector<ConsumerResult>(inputs.size(), ConsumerResult::Continue());
+		};
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{ DisruptorBatchConsumer(batchConsumer, utils::TimeSpan::FromMilliseconds(2)) },
+				[](const auto&, const auto&) {});
+
+		// Act: push single elements one at a time so that each one is dispatched as a partial batch
+		auto ranges = test::PrepareRanges(Num_Elements);
+		auto minElapsedTime = std::chrono::steady_clock::duration::max();
+		for (auto i = 0u; i < Num_Elements; ++i) {
+			auto startTime = std::chrono::steady_clock::now();
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+			WAIT_FOR_VALUE_EXPR(i + 1, numDispatched.load());
+
+			minElapsedTime = std::min(minElapsedTime, dispatchTimes[i] - startTime);
+		}
+
+		// Assert: elements were dispatched after the deadline but before the max wait duration
+		// (use the minimum to tolerate scheduling delays)
+		EXPECT_LE(std::chrono::milliseconds(2), minElapsedTime);
+		EXPECT_GT(std::chrono::milliseconds(10), minElapsedTime);
+	}
+
+	TEST(TEST_CLASS, LatenciesAreRecordedForEachBatch) {
+		// Arrange:
+		std::atomic_bool isBlocked(false);
+		std::atomic_bool shouldUnblock(false);
+		ConsumerDispatcher dispatcher(
+				CreateBatchOptions(4),
+				std::vector<DisruptorBatchConsumer>{
+					DisruptorBatchConsumer([&isBlocked, &shouldUnblock](const auto& inputs) {
+						isBlocked = true;
+						WAIT_FOR(shouldUnblock);
+						return std::vector<ConsumerResult>(inputs.size(), ConsumerResult::Continue());
+					})
+				},
+				[](const auto&, const auto&) {});
+
+		// Act: push a single element and wait for the consumer to block
+		auto ranges = test::PrepareRanges(6);
+		dispatcher.processElement(ConsumerInput(std::move(ranges[0])));
+		WAIT_FOR(isBlocked);
+
+		// - push remaining elements and unblock the consumer
+		for (auto i = 1u; i < ranges.size(); ++i)
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+
+		shouldUnblock = true;
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: consumer latencies are recorded per batch ({ 1, 4, 1 }) and element latencies per element
+		EXPECT_EQ(3u, dispatcher.stageLatencies(0).count());
+		EXPECT_EQ(6u, dispatcher.elementLatencies().count());
+	}
+
+	// endregion
+
 	// region consumer exception
 
 #ifdef __clang__
@@ -580,6 +1131,26 @@ namespace catapult { namespace disruptor {
 		}, "");
 	}
 
+	TEST(TEST_CLASS, BatchConsumerReturningWrongNumberOfResultsTerminates) {
+		ASSERT_DEATH({
+			// Arrange:
+			auto ranges = test::PrepareRanges(1);
+
+			ConsumerDispatcher dispatcher(
+					Test_Dispatcher_Options,
+					std::vector<DisruptorBatchConsumer>{
+						DisruptorBatchConsumer([](const auto&) {
+							return std::vector<ConsumerResult>(2);
+						})
+					},
+					[](const auto&, const auto&) {});
+
+			// Act:
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_EXPR(!dispatcher.isRunning());
+		}, "");
+	}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -49,4 +49,19 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(123u, consumer.level());
 		EXPECT_EQ(10u, consumer.position());
 	}
+
+	TEST(TEST_CLASS, CanAdvanceConsumerPositionByMultiplePositions) {
+		// Arrange:
+		auto level = 123u;
+		ConsumerEntry consumer(level);
+		consumer.advance();
+
+		// Act:
+		auto position = consumer.advance(9);
+
+		// Assert:
+		EXPECT_EQ(123u, consumer.level());
+		EXPECT_EQ(10u, position);
+		EXPECT_EQ(10u, consumer.position());
+	}
 }}
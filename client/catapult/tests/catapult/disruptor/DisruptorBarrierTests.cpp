@@ -46,4 +46,44 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, CanAdvanceBarrierByMultiplePositions) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		barrier.advance(7);
+
+		// Assert:
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(8u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CanTryAdvanceBarrierAtCurrentPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		auto result = barrier.tryAdvance(1);
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(2u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CannotTryAdvanceBarrierAtOtherPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		auto result1 = barrier.tryAdvance(0);
+		auto result2 = barrier.tryAdvance(2);
+
+		// Assert:
+		EXPECT_FALSE(result1);
+		EXPECT_FALSE(result2);
+		EXPECT_EQ(100u, barrier.level());
+		EXPECT_EQ(1u, barrier.position());
+	}
 }}
@@ -192,4 +192,109 @@ namespace catapult { namespace disruptor {
 			++i;
 		}
 	}
+
+	// region DisruptorBatchConsumer
+
+	TEST(TEST_CLASS, CanCreateBatchConsumerWithoutCoalescingDelay) {
+		// Arrange:
+		auto numCalls = 0u;
+		DisruptorBatchConsumer batchConsumer([&numCalls](const auto& inputs) {
+			++numCalls;
+			return std::vector<ConsumerResult>(inputs.size() + 1);
+		});
+
+		// Act:
+		auto results = batchConsumer({ nullptr, nullptr });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan(), batchConsumer.maxCoalescingDelay());
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(3u, results.size());
+	}
+
+	TEST(TEST_CLASS, CanCreateBatchConsumerWithCoalescingDelay) {
+		// Arrange:
+		auto numCalls = 0u;
+		DisruptorBatchConsumer batchConsumer([&numCalls](const auto& inputs) {
+			++numCalls;
+			return std::vector<ConsumerResult>(inputs.size() + 1);
+		}, utils::TimeSpan::FromMilliseconds(123));
+
+		// Act:
+		auto results = batchConsumer({ nullptr, nullptr });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan::FromMilliseconds(123), batchConsumer.maxCoalescingDelay());
+		EXPECT_EQ(1u, numCalls);
+		EXPECT_EQ(3u, results.size());
+	}
+
+	// endregion
+
+	// region DisruptorBatchConsumerFromConsumer / DisruptorBatchConsumersFromConsumers
+
+	TEST(TEST_CLASS, FromConsumer_DelegatesToConsumerForEachInputInBatch) {
+		// Arrange:
+		auto numCalls = 0u;
+		auto batchConsumer = DisruptorBatchConsumerFromConsumer([&numCalls](const auto&) {
+			++numCalls;
+			return ConsumerResult::Abort(numCalls, ConsumerResultSeverity::Neutral);
+		});
+
+		// Act:
+		auto input1 = CreateConsumerInputWithBlocks(1);
+		auto input2 = CreateConsumerInputWithBlocks(2);
+		auto results = batchConsumer({ &input1, &input2 });
+
+		// Assert:
+		EXPECT_EQ(utils::TimeSpan(), batchConsumer.maxCoalescingDelay());
+		EXPECT_EQ(2u, numCalls);
+		ASSERT_EQ(2u, results.size());
+		test::AssertAborted(results[0], 1, ConsumerResultSeverity::Neutral);
+		test::AssertAborted(results[1], 2, ConsumerResultSeverity::Neutral);
+	}
+
+	TEST(TEST_CLASS, FromConsumers_CanMapZeroConsumers) {
+		// Act:
+		auto batchConsumers = DisruptorBatchConsumersFromConsumers({});
+
+		// Assert:
+		EXPECT_TRUE(batchConsumers.empty());
+	}
+
+	TEST(TEST_CLASS, FromConsumers_DelegatesToConsumerForEachInputInBatch) {
+		// Arrange: create a consumer that aborts inputs containing two blocks
+		std::vector<const ConsumerInput*> consumedInputs;
+		std::vector<DisruptorConsumer> consumers{
+			[&consumedInputs](const auto& input) {
+				consumedInputs.push_back(&input);
+				return 2 == input.blocks().size()
+						? ConsumerResult::Abort(7, ConsumerResultSeverity::Failure)
+						: ConsumerResult::Continue();
+			}
+		};
+
+		// Act: perform the mapping
+		auto batchConsumers = DisruptorBatchConsumersFromConsumers(consumers);
+		ASSERT_EQ(1u, batchConsumers.size());
+
+		// - invoke with a batch of inputs
+		std::vector<ConsumerInput> inputs;
+		for (auto numBlocks : { 1u, 2u, 3u })
+			inputs.push_back(CreateConsumerInputWithBlocks(numBlocks));
+
+		auto results = batchConsumers[0]({ &inputs[0], &inputs[1], &inputs[2] });
+
+		// Assert: the consumer was called once for each input (in order) and all results were returned
+		ASSERT_EQ(3u, consumedInputs.size());
+		for (auto i = 0u; i < inputs.size(); ++i)
+			EXPECT_EQ(&inputs[i], consumedInputs[i]) << "input at " << i;
+
+		ASSERT_EQ(3u, results.size());
+		test::AssertContinued(results[0]);
+		test::AssertAborted(results[1], 7, ConsumerResultSeverity::Failure);
+		test::AssertContinued(results[2]);
+	}
+
+	// endregion
 }}
@@ -81,6 +81,7 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(static_cast<uint64_t>(-1), element.id());
 		EXPECT_FALSE(element.isSkipped());
 		test::AssertContinued(element.completionResult());
+		EXPECT_EQ(DisruptorElement::Clock::time_point(), element.creationTime());
 	}
 
 	ENTITY_TRAITS_BASED_TEST(CanCreateDisruptorElementAroundSingleEntity) {
@@ -91,6 +92,18 @@ namespace catapult { namespace disruptor {
 		TTraits::AssertDisruptorElementCreation(3);
 	}
 
+	TEST(TEST_CLASS, DisruptorElementCreationTimeIsSetDuringConstruction) {
+		// Arrange:
+		auto startTime = DisruptorElement::Clock::now();
+
+		// Act:
+		DisruptorElement element(ConsumerInput(), 21, EmptyProcessingCompleteFunc);
+
+		// Assert:
+		EXPECT_LE(startTime, element.creationTime());
+		EXPECT_GE(DisruptorElement::Clock::now(), element.creationTime());
+	}
+
 	TEST(TEST_CLASS, CanMarkDisruptorElementAsSkipped) {
 		// Arrange:
 		DisruptorElement element;
@@ -106,6 +119,55 @@ namespace catapult { namespace disruptor {
 		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
 	}
 
+	TEST(TEST_CLASS, CanMoveConstructDisruptorElement) {
+		// Arrange:
+		DisruptorElement original(ConsumerInput(), 21, EmptyProcessingCompleteFunc);
+		original.markSkipped(7, CreateConsumerResult(9, 8));
+		auto creationTime = original.creationTime();
+
+		// Act:
+		DisruptorElement element(std::move(original));
+
+		// Assert:
+		EXPECT_EQ(21u, element.id());
+		EXPECT_EQ(creationTime, element.creationTime());
+		EXPECT_TRUE(element.isSkipped());
+		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
+	}
+
+	TEST(TEST_CLASS, CanMoveAssignDisruptorElement) {
+		// Arrange:
+		DisruptorElement original(ConsumerInput(), 21, EmptyProcessingCompleteFunc);
+		original.markSkipped(7, CreateConsumerResult(9, 8));
+		auto creationTime = original.creationTime();
+
+		DisruptorElement element;
+
+		// Act:
+		const auto& result = (element = std::move(original));
+
+		// Assert:
+		EXPECT_EQ(&element, &result);
+		EXPECT_EQ(21u, element.id());
+		EXPECT_EQ(creationTime, element.creationTime());
+		EXPECT_TRUE(element.isSkipped());
+		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
+	}
+
+	TEST(TEST_CLASS, MoveAssignmentClearsSkipFlagWhenSourceIsNotSkipped) {
+		// Arrange:
+		DisruptorElement element;
+		element.markSkipped(7, CreateConsumerResult(9, 8));
+
+		// Act:
+		element = DisruptorElement(ConsumerInput(), 21, EmptyProcessingCompleteFunc);
+
+		// Assert:
+		EXPECT_EQ(21u, element.id());
+		EXPECT_FALSE(element.isSkipped());
+		test::AssertContinued(element.completionResult());
+	}
+
 	TEST(TEST_CLASS, CanOutputDisruptorElement) {
 		// Arrange:
 		auto pTransaction1 = test::GenerateRandomTransaction();
@@ -25,6 +25,8 @@
 #include "tests/test/nodeps/Waits.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <set>
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -187,6 +189,147 @@ namespace catapult { namespace disruptor {
 				});
 	}
 
+	// region tryClaim / publish
+
+	namespace {
+		ConsumerInput CreateBlockInput(Height height) {
+			auto pBlock = test::GenerateEmptyRandomBlock();
+			pBlock->Height = height;
+			return ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock)));
+		}
+	}
+
+	TEST(TEST_CLASS, TryClaimClaimsConsecutivePositionsWhenThereIsCapacity) {
+		// Arrange:
+		Disruptor disruptor(16);
+		std::vector<PositionType> capacityPositions;
+		std::vector<PositionType> claimedPositions;
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			PositionType position;
+			auto result = disruptor.tryClaim([&capacityPositions](auto cursor) {
+				capacityPositions.push_back(cursor);
+				return true;
+			}, position);
+
+			EXPECT_TRUE(result) << i;
+			claimedPositions.push_back(position);
+		}
+
+		// Assert: claiming does not publish anything
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), capacityPositions);
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), claimedPositions);
+		EXPECT_EQ(3u, disruptor.cursor());
+		EXPECT_EQ(0u, disruptor.size());
+		EXPECT_EQ(0u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, TryClaimDoesNotClaimPositionWhenThereIsNoCapacity) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PositionType position = 123;
+
+		// Act:
+		auto result = disruptor.tryClaim([](auto) { return false; }, position);
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(123u, position);
+		EXPECT_EQ(0u, disruptor.cursor());
+	}
+
+	TEST(TEST_CLASS, PublishStoresElementAndAdvancesBarrier) {
+		// Arrange:
+		Disruptor disruptor(16);
+		DisruptorBarrier barrier(0, 0);
+		PositionType position;
+		disruptor.tryClaim([](auto) { return true; }, position);
+
+		// Act:
+		auto id = disruptor.publish(position, CreateBlockInput(Height(7)), [](auto, auto) {}, barrier);
+
+		// Assert:
+		EXPECT_EQ(1u, id);
+		EXPECT_EQ(1u, disruptor.size());
+		EXPECT_EQ(1u, disruptor.added());
+		EXPECT_EQ(1u, barrier.position());
+
+		const auto& element = disruptor.elementAt(0);
+		EXPECT_EQ(1u, element.id());
+		EXPECT_EQ(Height(7), element.input().blocks()[0].Block.Height);
+	}
+
+	TEST(TEST_CLASS, PublishOutOfOrderOnlyAdvancesBarrierPastConsecutivelyPublishedPositions) {
+		// Arrange:
+		Disruptor disruptor(16);
+		DisruptorBarrier barrier(0, 0);
+		for (auto i = 0u; i < 4; ++i) {
+			PositionType position;
+			disruptor.tryClaim([](auto) { return true; }, position);
+		}
+
+		// Act + Assert: publishing positions after a gap does not advance the barrier
+		disruptor.publish(3, CreateBlockInput(Height(4)), [](auto, auto) {}, barrier);
+		disruptor.publish(1, CreateBlockInput(Height(2)), [](auto, auto) {}, barrier);
+		EXPECT_EQ(0u, barrier.position());
+
+		// - filling the first gap advances the barrier up to the second gap
+		disruptor.publish(0, CreateBlockInput(Height(1)), [](auto, auto) {}, barrier);
+		EXPECT_EQ(2u, barrier.position());
+
+		// - filling the second gap advances the barrier past all positions
+		disruptor.publish(2, CreateBlockInput(Height(3)), [](auto, auto) {}, barrier);
+		EXPECT_EQ(4u, barrier.position());
+
+		EXPECT_EQ(4u, disruptor.added());
+		for (auto i = 0u; i < 4; ++i) {
+			EXPECT_EQ(i + 1, disruptor.elementAt(i).id()) << i;
+			EXPECT_EQ(Height(i + 1), disruptor.elementAt(i).input().blocks()[0].Block.Height) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, MultipleProducersCanClaimAndPublishConcurrently) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Elements_Per_Producer = 100u;
+		Disruptor disruptor(Num_Producers * Num_Elements_Per_Producer);
+		DisruptorBarrier barrier(0, 0);
+
+		// Act:
+		std::vector<std::vector<DisruptorElementId>> producerIds(Num_Producers);
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.emplace_back([&disruptor, &barrier, &ids = producerIds[i]]() {
+				for (auto j = 0u; j < Num_Elements_Per_Producer; ++j) {
+					PositionType position;
+					disruptor.tryClaim([](auto) { return true; }, position);
+					ids.push_back(disruptor.publish(position, CreateBlockInput(Height(position + 1)), [](auto, auto) {}, barrier));
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert: all elements were published with unique ids matching their positions
+		std::set<DisruptorElementId> allIds;
+		for (const auto& ids : producerIds)
+			allIds.insert(ids.cbegin(), ids.cend());
+
+		constexpr auto Num_Elements = Num_Producers * Num_Elements_Per_Producer;
+		EXPECT_EQ(Num_Elements, allIds.size());
+		EXPECT_EQ(1u, *allIds.cbegin());
+		EXPECT_EQ(Num_Elements, *allIds.crbegin());
+
+		EXPECT_EQ(Num_Elements, disruptor.added());
+		EXPECT_EQ(Num_Elements, barrier.position());
+		for (auto i = 0u; i < Num_Elements; ++i)
+			EXPECT_EQ(Height(i + 1), disruptor.elementAt(i).input().blocks()[0].Block.Height) << i;
+	}
+
+	// endregion
+
 	TEST(TEST_CLASS, CanMarkElements) {
 		// Arrange:
 		Disruptor disruptor(16);
@@ -0,0 +1,184 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/DisruptorWaitStrategy.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS DisruptorWaitStrategyTests
+
+	namespace {
+		constexpr auto No_Deadline = std::chrono::steady_clock::time_point::max();
+	}
+
+	// region parsing
+
+	TEST(TEST_CLASS, CanParseValidStrategyValue) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("sleep", DisruptorWaitStrategy::Sleep);
+		assertSuccessfulParse("busy-spin", DisruptorWaitStrategy::Busy_Spin);
+		assertSuccessfulParse("spin-yield", DisruptorWaitStrategy::Spin_Yield);
+		assertSuccessfulParse("blocking", DisruptorWaitStrategy::Blocking);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidStrategyValue) {
+		test::AssertEnumParseFailure("spin", DisruptorWaitStrategy::Sleep, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	// endregion
+
+	// region waiter (all strategies)
+
+#define WAIT_STRATEGY_TRAITS_BASED_TEST(TEST_NAME) \
+	template<DisruptorWaitStrategy Strategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sleep) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DisruptorWaitStrategy::Sleep>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DisruptorWaitStrategy::Busy_Spin>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinYield) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DisruptorWaitStrategy::Spin_Yield>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Blocking) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DisruptorWaitStrategy::Blocking>(); } \
+	template<DisruptorWaitStrategy Strategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(CanCreateWaiter) {
+		// Act:
+		auto pWaiter = CreateDisruptorWaiter(Strategy, 3);
+
+		// Assert:
+		EXPECT_TRUE(!!pWaiter);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(WaitReturnsWhenReady) {
+		// Arrange:
+		auto pWaiter = CreateDisruptorWaiter(Strategy, 3);
+		auto numPredicateCalls = 0u;
+
+		// Act:
+		pWaiter->wait(1, No_Deadline, [&numPredicateCalls]() {
+			++numPredicateCalls;
+			return true;
+		});
+
+		// Assert:
+		EXPECT_EQ(1u, numPredicateCalls);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(WaitReturnsWhenNotReady) {
+		// Arrange:
+		auto pWaiter = CreateDisruptorWaiter(Strategy, 3);
+		auto numPredicateCalls = 0u;
+
+		// Act: wait is allowed to return early, so it should eventually return even when never ready
+		pWaiter->wait(1, No_Deadline, [&numPredicateCalls]() {
+			++numPredicateCalls;
+			return false;
+		});
+
+		// Assert:
+		EXPECT_LE(1u, numPredicateCalls);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(WaitReturnsWhenDeadlineHasPassed) {
+		// Arrange:
+		auto pWaiter = CreateDisruptorWaiter(Strategy, 3);
+		auto numPredicateCalls = 0u;
+
+		// Act: wait with an expired deadline should return without waiting for the (10ms) max wait duration
+		auto startTime = std::chrono::steady_clock::now();
+		pWaiter->wait(1, startTime, [&numPredicateCalls]() {
+			++numPredicateCalls;
+			return false;
+		});
+		auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+		// Assert:
+		EXPECT_LE(1u, numPredicateCalls);
+		EXPECT_GT(std::chrono::milliseconds(10), elapsedTime);
+	}
+
+	WAIT_STRATEGY_TRAITS_BASED_TEST(CanNotifyWithoutWaiters) {
+		// Arrange:
+		auto pWaiter = CreateDisruptorWaiter(Strategy, 3);
+
+		// Act + Assert: no exceptions
+		pWaiter->notify(0);
+		pWaiter->notify(2);
+		pWaiter->notifyAll();
+	}
+
+	// endregion
+
+	// region blocking waiter
+
+	namespace {
+		void AssertBlockingWaiterIsWokenByNotification(size_t notifyLevel, const consumer<DisruptorWaiter&, size_t>& notify) {
+			// Arrange:
+			auto pWaiter = CreateDisruptorWaiter(DisruptorWaitStrategy::Blocking, 3);
+			std::atomic_bool isReady(false);
+			std::atomic<size_t> numWaitsCompleted(0);
+			std::atomic_bool keepWaiting(true);
+
+			std::thread waitThread([&pWaiter, &isReady, &numWaitsCompleted, &keepWaiting]() {
+				while (keepWaiting) {
+					pWaiter->wait(1, No_Deadline, [&isReady]() { return isReady.load(); });
+					if (isReady)
+						++numWaitsCompleted;
+				}
+			});
+
+			// Act:
+			isReady = true;
+			notify(*pWaiter, notifyLevel);
+			WAIT_FOR_EXPR(0 < numWaitsCompleted);
+
+			keepWaiting = false;
+			waitThread.join();
+
+			// Assert:
+			EXPECT_LE(1u, numWaitsCompleted);
+		}
+	}
+
+	TEST(TEST_CLASS, BlockingWaiterIsWokenByNotifyAtSameLevel) {
+		AssertBlockingWaiterIsWokenByNotification(1, [](auto& waiter, auto level) { waiter.notify(level); });
+	}
+
+	TEST(TEST_CLASS, BlockingWaiterIsWokenByNotifyAll) {
+		AssertBlockingWaiterIsWokenByNotification(1, [](auto& waiter, auto) { waiter.notifyAll(); });
+	}
+
+	TEST(TEST_CLASS, BlockingWaiterEventuallyRechecksPredicateWithoutNotification) {
+		// Arrange: notify a different level, so the waiter is only woken by its timeout
+		AssertBlockingWaiterIsWokenByNotification(2, [](auto& waiter, auto level) { waiter.notify(level); });
+	}
+
+	// endregion
+}}
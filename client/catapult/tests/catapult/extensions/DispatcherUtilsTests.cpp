@@ -123,6 +123,68 @@ namespace catapult { namespace extensions {
 		isElementCallbackUnblocked.state()->set();
 	}
 
+	TEST(TEST_CLASS, CanAddDispatcherStatisticsCountersToLocator) {
+		// Arrange: create a dispatcher with three elements and block the second element
+		test::AutoSetFlag isExecutingBlockedElementCallback;
+		test::AutoSetFlag isElementCallbackUnblocked;
+		auto pIsExecuting = isExecutingBlockedElementCallback.state();
+		auto pIsUnblocked = isElementCallbackUnblocked.state();
+
+		auto pDispatcher = CreateDispatcher();
+		auto input1 = disruptor::ConsumerInput(test::CreateTransactionEntityRange(1));
+		auto input2 = disruptor::ConsumerInput(test::CreateTransactionEntityRange(1));
+		auto input3 = disruptor::ConsumerInput(test::CreateTransactionEntityRange(1));
+		pDispatcher->processElement(std::move(input1));
+		pDispatcher->processElement(std::move(input2), [pIsExecuting, pIsUnblocked](auto, const auto&) {
+			pIsExecuting->set();
+			pIsUnblocked->wait();
+		});
+		pDispatcher->processElement(std::move(input3));
+
+		// - wait until the blocked element callback is called
+		isExecutingBlockedElementCallback.state()->wait();
+
+		// - create a locator and register the service
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+		locator.registerRootedService("foo", pDispatcher);
+
+		// Act:
+		AddDispatcherStatisticsCounters(locator, "foo", "XYZ", pDispatcher->size());
+		std::unordered_map<std::string, size_t> counters;
+		for (const auto& counter : locator.counters())
+			counters[counter.id().name()] = counter.value();
+
+		// Assert: latency values are not deterministic
+		ASSERT_EQ(5u, counters.size());
+		EXPECT_LE(counters.at("XYZ LAT MED"), counters.at("XYZ LAT HIGH"));
+		EXPECT_LE(counters.at("XYZ LAT HIGH"), counters.at("XYZ LAT MAX"));
+
+		// - third element is waiting for the (only) consumer, which is blocked inspecting the second element
+		EXPECT_EQ(1u, counters.at("XYZ A DEPTH"));
+		EXPECT_LE(counters.at("XYZ A LAT"), counters.at("XYZ LAT MAX"));
+
+		// Cleanup:
+		isElementCallbackUnblocked.state()->set();
+	}
+
+	TEST(TEST_CLASS, CanAddDispatcherStatisticsCountersForAtMostTwentySixConsumers) {
+		// Arrange:
+		config::CatapultKeys keys;
+		ServiceLocator locator(keys);
+
+		// Act:
+		AddDispatcherStatisticsCounters(locator, "foo", "XYZ", 26);
+
+		// Assert:
+		ASSERT_EQ(3u + 2 * 26, locator.counters().size());
+		EXPECT_EQ("XYZ Z DEPTH", locator.counters()[3 + 2 * 25].id().name());
+		EXPECT_EQ("XYZ Z LAT", locator.counters()[3 + 2 * 25 + 1].id().name());
+
+		// Act + Assert:
+		EXPECT_THROW(AddDispatcherStatisticsCounters(locator, "foo", "XYZ", 27), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, CanCreateBatchTransactionTask) {
 		// Arrange:
 		auto pDispatcher = CreateDispatcher();
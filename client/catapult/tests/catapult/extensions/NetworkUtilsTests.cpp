@@ -21,6 +21,7 @@
 
 #include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/Results.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -95,6 +96,45 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region CreateSocketWorkingBufferPool
+
+	namespace {
+		auto CreateNodeConfiguration(utils::FileSize socketWorkingBufferPoolSize) {
+			auto config = config::NodeConfiguration::Uninitialized();
+			config.SocketWorkingBufferSize = utils::FileSize::FromBytes(512);
+			config.SocketWorkingBufferPoolSize = socketWorkingBufferPoolSize;
+			config.MaxPacketDataSize = utils::FileSize::FromKilobytes(12);
+			return config;
+		}
+	}
+
+	TEST(TEST_CLASS, CreateSocketWorkingBufferPoolReturnsNullptrWhenPoolingIsDisabled) {
+		// Arrange:
+		auto config = CreateNodeConfiguration(utils::FileSize());
+
+		// Act:
+		auto pPool = CreateSocketWorkingBufferPool(config);
+
+		// Assert:
+		EXPECT_FALSE(!!pPool);
+	}
+
+	TEST(TEST_CLASS, CreateSocketWorkingBufferPoolReturnsPoolWhenPoolingIsEnabled) {
+		// Arrange:
+		auto config = CreateNodeConfiguration(utils::FileSize::FromKilobytes(64));
+
+		// Act:
+		auto pPool = CreateSocketWorkingBufferPool(config);
+
+		// Assert: size classes should range from working buffer size (512B) to max packet data size + working buffer size (12.5KB)
+		ASSERT_TRUE(!!pPool);
+		EXPECT_EQ(6u, pPool->numSizeClasses());
+		EXPECT_EQ(512u, pPool->sizeClassCapacity(1));
+		EXPECT_EQ(16u * 1024, pPool->sizeClassCapacity(12 * 1024 + 512));
+	}
+
+	// endregion
+
 	// region GetConnectionSettings / UpdateAsyncTcpServerSettings
 
 	namespace {
@@ -121,9 +161,10 @@ namespace catapult { namespace extensions {
 	TEST(TEST_CLASS, CanExtractConnectionSettingsFromCatapultConfiguration) {
 		// Arrange:
 		auto config = CreateCatapultConfiguration();
+		auto pPool = std::make_shared<ionet::PacketBufferPool>(512, 1024, utils::FileSize::FromKilobytes(1));
 
 		// Act:
-		auto settings = GetConnectionSettings(config);
+		auto settings = GetConnectionSettings(config, pPool);
 
 		// Assert:
 		EXPECT_EQ(static_cast<model::NetworkIdentifier>(7), settings.NetworkIdentifier);
@@ -132,6 +173,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(11), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromBytes(512), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(987u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_EQ(pPool, settings.SocketWorkingBufferPool);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(12), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv6, settings.OutgoingProtocols);
 
@@ -146,13 +188,15 @@ namespace catapult { namespace extensions {
 		// Arrange:
 		auto config = CreateCatapultConfiguration();
 		auto settings = net::AsyncTcpServerSettings([](const auto&) {});
+		auto pPool = std::make_shared<ionet::PacketBufferPool>(512, 1024, utils::FileSize::FromKilobytes(1));
 
 		// Act:
-		UpdateAsyncTcpServerSettings(settings, config);
+		UpdateAsyncTcpServerSettings(settings, config, pPool);
 
 		// Assert:
 		EXPECT_EQ(512u, settings.PacketSocketOptions.WorkingBufferSize);
 		EXPECT_EQ(987u, settings.PacketSocketOptions.WorkingBufferSensitivity);
+		EXPECT_EQ(pPool, settings.PacketSocketOptions.BufferPool);
 		EXPECT_EQ(12u * 1024, settings.PacketSocketOptions.MaxPacketDataSize);
 
 		EXPECT_EQ(17u, settings.MaxActiveConnections);
@@ -264,7 +308,15 @@ namespace catapult { namespace extensions {
 				auto& serviceGroup = *m_pool.pushServiceGroup("server");
 				auto serviceId = ionet::ServiceIdentifier(123);
 				auto timeSupplier = test::CreateTimeSupplierFromMilliseconds({ 1 });
-				return BootServer(serviceGroup, test::GetLocalHostPort(), serviceId, config, timeSupplier, m_nodeSubscriber, m_acceptor);
+				return BootServer(
+						serviceGroup,
+						test::GetLocalHostPort(),
+						serviceId,
+						config,
+						nullptr,
+						timeSupplier,
+						m_nodeSubscriber,
+						m_acceptor);
 			}
 
 			auto boot() {
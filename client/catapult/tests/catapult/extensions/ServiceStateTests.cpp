@@ -25,6 +25,7 @@
 #include "catapult/extensions/PeersConnectionTasks.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/ionet/NodeContainer.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "catapult/thread/MultiServicePool.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
@@ -70,6 +71,7 @@ namespace catapult { namespace extensions {
 		std::vector<utils::DiagnosticCounter> counters;
 		auto pluginManager = test::CreatePluginManager(config.Blockchain);
 		thread::MultiServicePool pool("test", 1);
+		auto pSocketWorkingBufferPool = std::make_shared<ionet::PacketBufferPool>(1024, 4096, utils::FileSize::FromKilobytes(8));
 
 		// Act:
 		auto state = ServiceState(
@@ -86,7 +88,8 @@ namespace catapult { namespace extensions {
 				transactionStatusSubscriber,
 				counters,
 				pluginManager,
-				pool);
+				pool,
+				pSocketWorkingBufferPool);
 
 		// Assert:
 		// - check references
@@ -107,6 +110,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(&counters, &state.counters());
 		EXPECT_EQ(&pluginManager, &state.pluginManager());
 		EXPECT_EQ(&pool, &state.pool());
+		EXPECT_EQ(pSocketWorkingBufferPool, state.socketWorkingBufferPool());
 
 		// - check functions
 		EXPECT_EQ(Timestamp(111), state.timeSupplier()());
@@ -21,6 +21,7 @@
 
 #include "catapult/io/BlockElementSerializer.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/SerializerTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
@@ -300,6 +301,37 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region ReadBlockElementMetadata
+
+	TEST(TEST_CLASS, CanReadBlockElementMetadata) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto metadataBuffer = std::vector<uint8_t>(context.Buffer.cbegin() + context.pBlock->Size, context.Buffer.cend());
+		mocks::MockMemoryStream inputStream(metadataBuffer);
+
+		std::shared_ptr<const model::Block> pBlock = test::CopyEntity(*context.pBlock);
+		const auto* pBlockRaw = pBlock.get();
+
+		// Act:
+		auto pBlockElement = ReadBlockElementMetadata(pBlock, inputStream);
+		pBlock.reset();
+
+		// Assert: block is referenced (not copied) and kept alive by block element
+		EXPECT_EQ(pBlockRaw, &pBlockElement->Block);
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+		EXPECT_TRUE(inputStream.eof());
+	}
+
+	// endregion
+
 	// region Roundtrip
 
 	namespace {
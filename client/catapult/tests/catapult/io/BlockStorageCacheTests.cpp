@@ -487,6 +487,297 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region recent data caching
+
+	namespace {
+		constexpr uint32_t Caching_Chain_Size = 10;
+
+		// wraps a BlockStorage and counts all block loads
+		class LoadCountingBlockStorage : public BlockStorage {
+		public:
+			explicit LoadCountingBlockStorage(std::unique_ptr<BlockStorage>&& pStorage)
+					: m_pStorage(std::move(pStorage))
+					, m_numBlockLoads(0)
+					, m_numBlockElementLoads(0)
+					, m_numBlockStatementDataLoads(0)
+			{}
+
+		public:
+			size_t numBlockLoads() const {
+				return m_numBlockLoads;
+			}
+
+			size_t numBlockElementLoads() const {
+				return m_numBlockElementLoads;
+			}
+
+			size_t numBlockStatementDataLoads() const {
+				return m_numBlockStatementDataLoads;
+			}
+
+		public: // LightBlockStorage
+			Height chainHeight() const override {
+				return m_pStorage->chainHeight();
+			}
+
+			model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override {
+				return m_pStorage->loadHashesFrom(height, maxHashes);
+			}
+
+			void saveBlock(const model::BlockElement& blockElement) override {
+				m_pStorage->saveBlock(blockElement);
+			}
+
+			void dropBlocksAfter(Height height) override {
+				m_pStorage->dropBlocksAfter(height);
+			}
+
+		public: // BlockStorage
+			std::shared_ptr<const model::Block> loadBlock(Height height) const override {
+				++m_numBlockLoads;
+				return m_pStorage->loadBlock(height);
+			}
+
+			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
+				++m_numBlockElementLoads;
+				return m_pStorage->loadBlockElement(height);
+			}
+
+			std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override {
+				++m_numBlockStatementDataLoads;
+				return m_pStorage->loadBlockStatementData(height);
+			}
+
+		private:
+			std::unique_ptr<BlockStorage> m_pStorage;
+			mutable size_t m_numBlockLoads;
+			mutable size_t m_numBlockElementLoads;
+			mutable size_t m_numBlockStatementDataLoads;
+		};
+
+		class CachingTestContext {
+		public:
+			explicit CachingTestContext(utils::FileSize maxCacheSize) {
+				auto pStorage = std::make_unique<LoadCountingBlockStorage>(mocks::CreateMemoryBlockStorage(Caching_Chain_Size));
+				m_pStorage = pStorage.get();
+				m_pCache = std::make_unique<BlockStorageCache>(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), maxCacheSize);
+			}
+
+		public:
+			const LoadCountingBlockStorage& storage() const {
+				return *m_pStorage;
+			}
+
+			BlockStorageCache& cache() {
+				return *m_pCache;
+			}
+
+		private:
+			LoadCountingBlockStorage* m_pStorage;
+			std::unique_ptr<BlockStorageCache> m_pCache;
+		};
+
+		// all blocks generated by CreateMemoryBlockStorage (except nemesis) have same size
+		utils::FileSize GetCachedBlockElementSize() {
+			CachingTestContext context(utils::FileSize::FromMegabytes(1));
+			context.cache().view().loadBlockElement(Height(2));
+			return context.cache().statistics().Size;
+		}
+
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t expectedNumHits, uint64_t expectedNumMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Arrange:
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+
+		// Assert: only chain tip was loaded
+		EXPECT_EQ(1u, context.storage().numBlockElementLoads());
+		AssertStatistics(context.cache(), 0, 0);
+		EXPECT_EQ(utils::FileSize(), context.cache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, ChainTipIsAlwaysLoadedFromMemory) {
+		// Arrange: disable caching
+		CachingTestContext context((utils::FileSize()));
+
+		// Act:
+		auto pBlock = context.cache().view().loadBlock(Height(Caching_Chain_Size));
+		auto pBlockElement = context.cache().view().loadBlockElement(Height(Caching_Chain_Size));
+
+		// Assert: only initial load of chain tip went to storage
+		EXPECT_EQ(Height(Caching_Chain_Size), pBlock->Height);
+		EXPECT_EQ(Height(Caching_Chain_Size), pBlockElement->Block.Height);
+		EXPECT_EQ(0u, context.storage().numBlockLoads());
+		EXPECT_EQ(1u, context.storage().numBlockElementLoads());
+		AssertStatistics(context.cache(), 2, 0);
+	}
+
+	TEST(TEST_CLASS, LoadsAreDelegatedToStorageWhenCachingIsDisabled) {
+		// Arrange:
+		CachingTestContext context((utils::FileSize()));
+
+		// Act:
+		for (auto i = 0u; i < 2; ++i) {
+			context.cache().view().loadBlock(Height(5));
+			context.cache().view().loadBlockElement(Height(5));
+			context.cache().view().loadBlockStatementData(Height(5));
+		}
+
+		// Assert:
+		EXPECT_EQ(2u, context.storage().numBlockLoads());
+		EXPECT_EQ(1u + 2, context.storage().numBlockElementLoads());
+		EXPECT_EQ(2u, context.storage().numBlockStatementDataLoads());
+		AssertStatistics(context.cache(), 0, 6);
+		EXPECT_EQ(utils::FileSize(), context.cache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementCachesRecentBlockElements) {
+		// Arrange:
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto pBlockElement1 = context.cache().view().loadBlockElement(Height(5));
+		auto pBlockElement2 = context.cache().view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		EXPECT_EQ(1u + 1, context.storage().numBlockElementLoads());
+		AssertStatistics(context.cache(), 1, 1);
+		EXPECT_EQ(GetCachedBlockElementSize(), context.cache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadBlockCachesRecentBlockElements) {
+		// Arrange:
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto pBlock1 = context.cache().view().loadBlock(Height(5));
+		auto pBlock2 = context.cache().view().loadBlock(Height(5));
+		auto pBlockElement = context.cache().view().loadBlockElement(Height(5));
+
+		// Assert: block element is loaded once and shared by all loads
+		EXPECT_EQ(pBlock1.get(), pBlock2.get());
+		EXPECT_EQ(pBlock1.get(), &pBlockElement->Block);
+		EXPECT_EQ(0u, context.storage().numBlockLoads());
+		EXPECT_EQ(1u + 1, context.storage().numBlockElementLoads());
+		AssertStatistics(context.cache(), 2, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockStatementDataCachesRecentBlockStatementData) {
+		// Arrange:
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+
+		// Act:
+		auto statementData1 = context.cache().view().loadBlockStatementData(Height(5));
+		auto statementData2 = context.cache().view().loadBlockStatementData(Height(5));
+
+		// Assert:
+		EXPECT_EQ(statementData1, statementData2);
+		EXPECT_EQ(1u, context.storage().numBlockStatementDataLoads());
+		AssertStatistics(context.cache(), 1, 1);
+		EXPECT_LT(utils::FileSize(), context.cache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedDataIsEvictedWhenMaxSizeIsExceeded) {
+		// Arrange: allow two block elements to be cached
+		auto blockElementSize = GetCachedBlockElementSize();
+		CachingTestContext context(utils::FileSize::FromBytes(2 * blockElementSize.bytes()));
+
+		// - load blocks 2 and 3 and mark block 2 as most recently used
+		context.cache().view().loadBlockElement(Height(2));
+		context.cache().view().loadBlockElement(Height(3));
+		context.cache().view().loadBlockElement(Height(2));
+
+		// Act: load block 4, which should evict block 3
+		context.cache().view().loadBlockElement(Height(4));
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromBytes(2 * blockElementSize.bytes()), context.cache().statistics().Size);
+		AssertStatistics(context.cache(), 1, 3);
+
+		context.cache().view().loadBlockElement(Height(2));
+		context.cache().view().loadBlockElement(Height(4));
+		AssertStatistics(context.cache(), 3, 3);
+
+		context.cache().view().loadBlockElement(Height(3));
+		AssertStatistics(context.cache(), 3, 4);
+		EXPECT_EQ(1u + 4, context.storage().numBlockElementLoads());
+	}
+
+	TEST(TEST_CLASS, DataLargerThanMaxSizeIsNotCached) {
+		// Arrange:
+		CachingTestContext context(utils::FileSize::FromBytes(1));
+
+		// Act:
+		context.cache().view().loadBlockElement(Height(5));
+		context.cache().view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(1u + 2, context.storage().numBlockElementLoads());
+		AssertStatistics(context.cache(), 0, 2);
+		EXPECT_EQ(utils::FileSize(), context.cache().statistics().Size);
+	}
+
+	TEST(TEST_CLASS, CommitInvalidatesCachedDataAfterDropHeight) {
+		// Arrange:
+		auto blockElementSize = GetCachedBlockElementSize();
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+		for (auto height : { Height(5), Height(6), Height(7), Height(8) })
+			context.cache().view().loadBlockElement(height);
+
+		// Sanity:
+		EXPECT_EQ(utils::FileSize::FromBytes(4 * blockElementSize.bytes()), context.cache().statistics().Size);
+
+		// Act: drop blocks after 6 and save a new block at 7
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(7));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+		{
+			auto modifier = context.cache().modifier();
+			modifier.dropBlocksAfter(Height(6));
+			modifier.saveBlock(newBlockElement);
+			modifier.commit();
+		}
+
+		// Assert: cached data for blocks 7 and 8 was invalidated
+		EXPECT_EQ(utils::FileSize::FromBytes(2 * blockElementSize.bytes()), context.cache().statistics().Size);
+
+		// - new block (chain tip) is returned
+		test::AssertEqual(newBlockElement, *context.cache().view().loadBlockElement(Height(7)));
+
+		// - blocks 5 and 6 are still cached
+		auto numBlockElementLoads = context.storage().numBlockElementLoads();
+		context.cache().view().loadBlockElement(Height(5));
+		context.cache().view().loadBlockElement(Height(6));
+		EXPECT_EQ(numBlockElementLoads, context.storage().numBlockElementLoads());
+	}
+
+	TEST(TEST_CLASS, CommitWithoutDropDoesNotInvalidateCachedData) {
+		// Arrange:
+		auto blockElementSize = GetCachedBlockElementSize();
+		CachingTestContext context(utils::FileSize::FromMegabytes(1));
+		for (auto height : { Height(5), Height(6) })
+			context.cache().view().loadBlockElement(height);
+
+		// Act:
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(Caching_Chain_Size + 1));
+		{
+			auto modifier = context.cache().modifier();
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pNewBlock));
+			modifier.commit();
+		}
+
+		// Assert:
+		EXPECT_EQ(Height(Caching_Chain_Size + 1), context.cache().view().chainHeight());
+		EXPECT_EQ(utils::FileSize::FromBytes(2 * blockElementSize.bytes()), context.cache().statistics().Size);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
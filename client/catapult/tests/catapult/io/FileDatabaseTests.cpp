@@ -541,6 +541,128 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region payload view
+
+	namespace {
+		std::vector<uint8_t> ToVector(const FileDatabase::PayloadView& payloadView) {
+			return std::vector<uint8_t>(payloadView.pData.get(), payloadView.pData.get() + payloadView.Size);
+		}
+	}
+
+	READ_TEST(CanViewPayloadInFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView = context.database().payloadView(10 + Payload_Index);
+
+		// Assert:
+		EXPECT_EQ(payloads[Payload_Index], ToVector(payloadView));
+	}
+
+	TEST(TEST_CLASS, CannotViewPayloadInNonexistentFile) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(10), catapult_file_io_error);
+		EXPECT_EQ(0u, context.countDatabaseFiles());
+	}
+
+	TEST(TEST_CLASS, CannotViewUnwrittenPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanViewPayloadWrittenAfterFileWasMapped) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, { payloads[0] });
+		auto payloadView1 = context.database().payloadView(10);
+
+		// Act:
+		WriteAll(context.database(), 11, { payloads[1], payloads[2] });
+		auto payloadView2 = context.database().payloadView(11);
+		auto payloadView3 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payloadView1));
+		EXPECT_EQ(payloads[1], ToVector(payloadView2));
+		EXPECT_EQ(payloads[2], ToVector(payloadView3));
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsUnaffectedByRewriteOfPayload) {
+		// Arrange:
+		TestContext context;
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto payloadView1 = context.database().payloadView(11);
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Act: rewriting payload 11 truncates payload 12
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert: original views are unchanged
+		EXPECT_EQ(payloads[1], ToVector(payloadView1));
+		EXPECT_EQ(payloads[2], ToVector(payloadView2));
+
+		// - new views and file contents reflect rewrite
+		EXPECT_EQ(newPayload, ToVector(context.database().payloadView(11)));
+		EXPECT_THROW(context.database().payloadView(12), catapult_file_io_error);
+
+		auto contents = context.readAll(10);
+		EXPECT_EQ(Concatenate({ MakeHeader({ 40, 90, 0, 0, 0 }), payloads[0], newPayload }), contents);
+	}
+
+	TEST(TEST_CLASS, CanViewPayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView1 = context.database().payloadView(10);
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payloadView1));
+		EXPECT_EQ(payloads[2], ToVector(payloadView2));
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsUnaffectedByRewriteOfPayloadInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+		auto payloadView = context.database().payloadView(11);
+
+		// Act:
+		auto newPayload = test::GenerateRandomVector(7);
+		WriteAll(context.database(), 11, { newPayload });
+
+		// Assert:
+		EXPECT_EQ(payloads[1], ToVector(payloadView));
+		EXPECT_EQ(newPayload, ToVector(context.database().payloadView(11)));
+		EXPECT_EQ(newPayload, context.readAll(11));
+	}
+
+	// endregion
+
 	// region read + write across versioned directories
 
 	TEST(TEST_CLASS, CanWriteAcrossMultipleFilesInMultipleVersionedDirectories) {
@@ -824,4 +824,285 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region segmented queue
+
+	namespace {
+		constexpr auto Max_Segment_Size = utils::FileSize::FromBytes(100);
+
+		template<typename TTraits>
+		class SegmentedQueueTestContext : public BasicQueueTestContext<TTraits> {
+		public:
+			SegmentedQueueTestContext() : BasicQueueTestContext<TTraits>("q")
+			{}
+
+		public:
+			FileQueueWriter createWriter(utils::FileSize maxSegmentSize = Max_Segment_Size) {
+				return FileQueueWriter(
+						BasicQueueTestContext<TTraits>::directory().generic_string(),
+						TTraits::Index_Writer_Filename,
+						maxSegmentSize);
+			}
+
+			FileQueueReader createReader() {
+				return FileQueueReader(
+						BasicQueueTestContext<TTraits>::directory().generic_string(),
+						TTraits::Index_Reader_Filename,
+						TTraits::Index_Writer_Filename);
+			}
+
+			std::vector<uint64_t> readOffsets(const std::string& name) {
+				auto buffer = BasicQueueTestContext<TTraits>::readAll(name);
+				std::vector<uint64_t> offsets(buffer.size() / sizeof(uint64_t));
+				std::memcpy(static_cast<void*>(offsets.data()), buffer.data(), buffer.size());
+				return offsets;
+			}
+
+			void append(const std::string& name, const std::vector<uint8_t>& buffer) {
+				RawFile dataFile((BasicQueueTestContext<TTraits>::directory() / name).generic_string(), OpenMode::Read_Append);
+				dataFile.seek(dataFile.size());
+				dataFile.write(buffer);
+			}
+		};
+
+		void WriteMessages(FileQueueWriter& writer, const std::vector<std::vector<uint8_t>>& buffers) {
+			for (const auto& buffer : buffers) {
+				writer.write(buffer);
+				writer.flush();
+			}
+		}
+
+		std::vector<std::vector<uint8_t>> ReadAllMessages(FileQueueReader& reader) {
+			std::vector<std::vector<uint8_t>> buffers;
+			while (reader.tryReadNextMessage([&buffers](const auto& buffer) { buffers.push_back(buffer); }))
+			{}
+
+			return buffers;
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(SegmentedWriterCanWriteMultiplePayloadsToSingleSegment) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		auto writer = context.createWriter();
+		std::vector<std::vector<uint8_t>> buffers{
+			test::GenerateRandomVector(21),
+			test::GenerateRandomVector(40),
+			test::GenerateRandomVector(11)
+		};
+
+		// Act:
+		WriteMessages(writer, buffers);
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_TRUE(context.exists(TTraits::Index_Writer_Filename));
+		EXPECT_TRUE(context.exists("0000000000000000.log"));
+		EXPECT_TRUE(context.exists("0000000000000000.idx"));
+
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(Merge(buffers), context.readAll("0000000000000000.log"));
+		EXPECT_EQ(std::vector<uint64_t>({ 21, 61, 72 }), context.readOffsets("0000000000000000.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(SegmentedWriterStartsNewSegmentWhenMaxSegmentSizeIsReached) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		auto writer = context.createWriter();
+		std::vector<std::vector<uint8_t>> buffers{
+			test::GenerateRandomVector(60),
+			test::GenerateRandomVector(50),
+			test::GenerateRandomVector(11)
+		};
+
+		// Act:
+		WriteMessages(writer, buffers);
+
+		// Assert: a message is never split across segments
+		EXPECT_EQ(5u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(Merge({ buffers[0], buffers[1] }), context.readAll("0000000000000000.log"));
+		EXPECT_EQ(std::vector<uint64_t>({ 60, 110 }), context.readOffsets("0000000000000000.idx"));
+		EXPECT_EQ(buffers[2], context.readAll("0000000000000002.log"));
+		EXPECT_EQ(std::vector<uint64_t>({ 11 }), context.readOffsets("0000000000000002.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(SegmentedWriterDoesNotCommitMessageBeforeFlush) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		auto writer = context.createWriter();
+
+		// Act:
+		writer.write(test::GenerateRandomVector(21));
+
+		// Assert:
+		EXPECT_EQ(0u, context.readIndexWriterFile());
+		EXPECT_EQ(std::vector<uint64_t>(), context.readOffsets("0000000000000000.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(SegmentedWriterDiscardsUncommittedDataWhenReopened) {
+		// Arrange: simulate a crash after uncommitted data was written
+		SegmentedQueueTestContext<TTraits> context;
+		std::vector<std::vector<uint8_t>> buffers{
+			test::GenerateRandomVector(21),
+			test::GenerateRandomVector(30),
+			test::GenerateRandomVector(11)
+		};
+
+		{
+			auto writer = context.createWriter();
+			WriteMessages(writer, { buffers[0], buffers[1] });
+		}
+
+		context.append("0000000000000000.log", test::GenerateRandomVector(17));
+		context.append("0000000000000000.idx", test::GenerateRandomVector(sizeof(uint64_t)));
+		context.append("0000000000000005.log", test::GenerateRandomVector(17));
+		context.append("0000000000000005.idx", test::GenerateRandomVector(sizeof(uint64_t)));
+
+		// Act:
+		auto writer = context.createWriter();
+		WriteMessages(writer, { buffers[2] });
+
+		// Assert:
+		EXPECT_EQ(3u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_EQ(Merge(buffers), context.readAll("0000000000000000.log"));
+		EXPECT_EQ(std::vector<uint64_t>({ 21, 51, 62 }), context.readOffsets("0000000000000000.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(SegmentedWriterStartsNewSegmentAfterMessagesStoredInSeparateFiles) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		{
+			auto writer = context.createWriter();
+			WriteMessages(writer, { test::GenerateRandomVector(21) });
+		}
+
+		{
+			auto writer = context.createWriter(utils::FileSize());
+			WriteMessages(writer, { test::GenerateRandomVector(30) });
+		}
+
+		// Act:
+		auto writer = context.createWriter();
+		WriteMessages(writer, { test::GenerateRandomVector(11) });
+
+		// Assert:
+		EXPECT_EQ(6u, context.countFiles());
+		EXPECT_EQ(3u, context.readIndexWriterFile());
+		EXPECT_TRUE(context.exists("0000000000000001.dat"));
+		EXPECT_EQ(std::vector<uint64_t>({ 21 }), context.readOffsets("0000000000000000.idx"));
+		EXPECT_EQ(std::vector<uint64_t>({ 11 }), context.readOffsets("0000000000000002.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReaderCanReadMessagesFromMultipleSegments) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto i = 0u; i < 10; ++i)
+			buffers.push_back(test::GenerateRandomVector(25 + i));
+
+		auto writer = context.createWriter();
+		WriteMessages(writer, buffers);
+		auto reader = context.createReader();
+
+		// Act:
+		auto readBuffers = ReadAllMessages(reader);
+
+		// Assert: only the last (fully consumed) segment is retained
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(10u, context.readIndexReaderFile());
+		EXPECT_EQ(0u, reader.pending());
+
+		EXPECT_EQ(4u, context.countFiles());
+		EXPECT_TRUE(context.exists("0000000000000008.log"));
+		EXPECT_TRUE(context.exists("0000000000000008.idx"));
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReaderCanReadMessagesFromSegmentsAndSeparateFiles) {
+		// Arrange: write messages switching between formats
+		SegmentedQueueTestContext<TTraits> context;
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto i = 0u; i < 6; ++i)
+			buffers.push_back(test::GenerateRandomVector(25 + i));
+
+		for (auto i = 0u; i < buffers.size(); i += 2) {
+			auto writer = context.createWriter(0 == i % 4 ? utils::FileSize() : Max_Segment_Size);
+			WriteMessages(writer, { buffers[i], buffers[i + 1] });
+		}
+
+		auto reader = context.createReader();
+
+		// Act:
+		auto readBuffers = ReadAllMessages(reader);
+
+		// Assert:
+		EXPECT_EQ(buffers, readBuffers);
+		EXPECT_EQ(6u, context.readIndexReaderFile());
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReaderCanReadMessagesAppendedToSegmentAfterPreviousRead) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		std::vector<std::vector<uint8_t>> buffers{ test::GenerateRandomVector(21), test::GenerateRandomVector(22) };
+
+		auto writer = context.createWriter();
+		auto reader = context.createReader();
+		WriteMessages(writer, { buffers[0] });
+		auto readBuffers1 = ReadAllMessages(reader);
+
+		// Act:
+		WriteMessages(writer, { buffers[1] });
+		auto readBuffers2 = ReadAllMessages(reader);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>({ buffers[0] }), readBuffers1);
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>({ buffers[1] }), readBuffers2);
+		EXPECT_EQ(2u, context.readIndexReaderFile());
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReaderDoesNotConsumeSegmentMessageWhenPredicateReturnsFalse) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		auto buffer = test::GenerateRandomVector(21);
+
+		auto writer = context.createWriter();
+		WriteMessages(writer, { buffer });
+		auto reader = context.createReader();
+
+		// Act:
+		std::vector<uint8_t> readBuffer;
+		auto result = reader.tryReadNextMessageConditional([&readBuffer](const auto& messageBuffer) {
+			readBuffer = messageBuffer;
+			return false;
+		});
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_EQ(buffer, readBuffer);
+		EXPECT_EQ(0u, context.readIndexReaderFile());
+		EXPECT_EQ(1u, reader.pending());
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(ReaderCanSkipSegmentMessages) {
+		// Arrange:
+		SegmentedQueueTestContext<TTraits> context;
+		std::vector<std::vector<uint8_t>> buffers;
+		for (auto i = 0u; i < 5; ++i)
+			buffers.push_back(test::GenerateRandomVector(40 + i));
+
+		auto writer = context.createWriter();
+		WriteMessages(writer, buffers);
+		auto reader = context.createReader();
+
+		// Act:
+		reader.skip(3);
+		auto readBuffers = ReadAllMessages(reader);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::vector<uint8_t>>({ buffers[3], buffers[4] }), readBuffers);
+		EXPECT_EQ(5u, context.readIndexReaderFile());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,108 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		auto WriteRandomVectorToFile(const std::string& filePath, size_t size) {
+			auto inputData = test::GenerateRandomVector(size);
+			RawFile file(filePath, OpenMode::Read_Write);
+			file.write(inputData);
+			return inputData;
+		}
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 123);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Assert:
+		ASSERT_EQ(123u, mappedFile.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mappedFile.data(), inputData.size());
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard.name(), 0);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Assert:
+		EXPECT_EQ(0u, mappedFile.size());
+	}
+
+	TEST(TEST_CLASS, CannotMapNonexistentFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, MappingReflectsChangesToMappedRange) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard.name(), 123);
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Act:
+		auto inputData = test::GenerateRandomVector(123);
+		{
+			RawFile file(guard.name(), OpenMode::Read_Append);
+			file.write(inputData);
+		}
+
+		// Assert:
+		ASSERT_EQ(123u, mappedFile.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mappedFile.data(), inputData.size());
+	}
+
+	TEST(TEST_CLASS, MappingIsUnaffectedByFileGrowth) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard.name(), 123);
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Act:
+		{
+			RawFile file(guard.name(), OpenMode::Read_Append);
+			file.seek(file.size());
+			file.write(test::GenerateRandomVector(50));
+		}
+
+		// Assert:
+		ASSERT_EQ(123u, mappedFile.size());
+		EXPECT_EQ_MEMORY(inputData.data(), mappedFile.data(), inputData.size());
+	}
+}}
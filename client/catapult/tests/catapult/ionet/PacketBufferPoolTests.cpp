@@ -0,0 +1,275 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketBufferPool.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketBufferPoolTests
+
+	namespace {
+		constexpr size_t Min_Buffer_Size = 1024;
+		constexpr size_t Max_Buffer_Size = 6 * 1024;
+
+		PacketBufferPool CreatePool(utils::FileSize maxPoolSize = utils::FileSize::FromKilobytes(64)) {
+			return PacketBufferPool(Min_Buffer_Size, Max_Buffer_Size, maxPoolSize);
+		}
+
+		void AssertStatistics(
+				const PacketBufferPool& pool,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses,
+				size_t expectedNumBuffers,
+				size_t expectedSize) {
+			auto statistics = pool.statistics();
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+			EXPECT_EQ(expectedNumBuffers, statistics.NumBuffers);
+			EXPECT_EQ(utils::FileSize::FromBytes(expectedSize), statistics.Size);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreatePool) {
+		// Act:
+		auto pool = CreatePool();
+
+		// Assert: 1K, 2K, 4K, 8K
+		EXPECT_EQ(4u, pool.numSizeClasses());
+		AssertStatistics(pool, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanCreatePoolWithSingleSizeClass) {
+		// Act:
+		auto pool = PacketBufferPool(Min_Buffer_Size, Min_Buffer_Size, utils::FileSize::FromKilobytes(64));
+
+		// Assert:
+		EXPECT_EQ(1u, pool.numSizeClasses());
+	}
+
+	TEST(TEST_CLASS, CannotCreatePoolWithInvalidBufferSizes) {
+		EXPECT_THROW(PacketBufferPool(0, Max_Buffer_Size, utils::FileSize::FromKilobytes(64)), catapult_invalid_argument);
+		EXPECT_THROW(PacketBufferPool(Max_Buffer_Size, Min_Buffer_Size, utils::FileSize::FromKilobytes(64)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region sizeClassCapacity
+
+	TEST(TEST_CLASS, SizeClassCapacityReturnsCapacityOfSmallestFittingSizeClass) {
+		// Arrange:
+		auto pool = CreatePool();
+
+		// Act + Assert:
+		EXPECT_EQ(1024u, pool.sizeClassCapacity(0));
+		EXPECT_EQ(1024u, pool.sizeClassCapacity(1));
+		EXPECT_EQ(1024u, pool.sizeClassCapacity(1024));
+		EXPECT_EQ(2048u, pool.sizeClassCapacity(1025));
+		EXPECT_EQ(4096u, pool.sizeClassCapacity(3000));
+		EXPECT_EQ(8192u, pool.sizeClassCapacity(8192));
+	}
+
+	TEST(TEST_CLASS, SizeClassCapacityReturnsSizeWhenLargerThanAllSizeClasses) {
+		// Arrange:
+		auto pool = CreatePool();
+
+		// Act + Assert:
+		EXPECT_EQ(8193u, pool.sizeClassCapacity(8193));
+		EXPECT_EQ(20000u, pool.sizeClassCapacity(20000));
+	}
+
+	// endregion
+
+	// region acquire
+
+	TEST(TEST_CLASS, AcquireAllocatesBufferWhenPoolIsEmpty) {
+		// Arrange:
+		auto pool = CreatePool();
+
+		// Act:
+		auto buffer = pool.acquire(1500);
+
+		// Assert:
+		EXPECT_TRUE(buffer.empty());
+		EXPECT_EQ(2048u, buffer.capacity());
+		AssertStatistics(pool, 0, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AcquireAllocatesExactBufferWhenLargerThanAllSizeClasses) {
+		// Arrange:
+		auto pool = CreatePool();
+
+		// Act:
+		auto buffer = pool.acquire(10000);
+
+		// Assert:
+		EXPECT_TRUE(buffer.empty());
+		EXPECT_EQ(10000u, buffer.capacity());
+		AssertStatistics(pool, 0, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AcquireReusesReleasedBufferFromMatchingSizeClass) {
+		// Arrange:
+		auto pool = CreatePool();
+		auto buffer1 = pool.acquire(1500);
+		buffer1.resize(100);
+		const auto* pBuffer1Data = buffer1.data();
+		pool.release(std::move(buffer1));
+
+		// Act:
+		auto buffer2 = pool.acquire(2000);
+
+		// Assert: released buffer was cleared before being reused
+		EXPECT_EQ(pBuffer1Data, buffer2.data());
+		EXPECT_TRUE(buffer2.empty());
+		EXPECT_EQ(2048u, buffer2.capacity());
+		AssertStatistics(pool, 1, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AcquireDoesNotReuseReleasedBufferFromOtherSizeClass) {
+		// Arrange:
+		auto pool = CreatePool();
+		pool.release(pool.acquire(1500));
+
+		// Act:
+		auto buffer1 = pool.acquire(1000);
+		auto buffer2 = pool.acquire(3000);
+
+		// Assert:
+		EXPECT_EQ(1024u, buffer1.capacity());
+		EXPECT_EQ(4096u, buffer2.capacity());
+		AssertStatistics(pool, 0, 3, 1, 2048);
+	}
+
+	// endregion
+
+	// region release
+
+	TEST(TEST_CLASS, ReleaseRetainsBuffersInSizeClasses) {
+		// Arrange:
+		auto pool = CreatePool();
+		auto buffer1 = pool.acquire(1000);
+		auto buffer2 = pool.acquire(2000);
+		auto buffer3 = pool.acquire(2000);
+
+		// Act:
+		pool.release(std::move(buffer1));
+		pool.release(std::move(buffer2));
+		pool.release(std::move(buffer3));
+
+		// Assert:
+		AssertStatistics(pool, 0, 3, 3, 1024 + 2 * 2048);
+	}
+
+	TEST(TEST_CLASS, ReleasePlacesBufferInLargestSizeClassItCanSatisfy) {
+		// Arrange:
+		auto pool = CreatePool();
+		ByteBuffer buffer;
+		buffer.reserve(3000);
+
+		// Act:
+		pool.release(std::move(buffer));
+
+		// Assert: buffer is too small for 4K class so it can only be acquired for 2K requests
+		EXPECT_EQ(4096u, pool.acquire(2500).capacity());
+		EXPECT_EQ(3000u, pool.acquire(2000).capacity());
+		AssertStatistics(pool, 1, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReleasePlacesBufferLargerThanAllSizeClassesInLargestSizeClass) {
+		// Arrange:
+		auto pool = CreatePool();
+		pool.release(pool.acquire(10000));
+
+		// Act:
+		auto buffer = pool.acquire(5000);
+
+		// Assert:
+		EXPECT_EQ(10000u, buffer.capacity());
+		AssertStatistics(pool, 1, 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReleaseDiscardsBufferSmallerThanSmallestSizeClass) {
+		// Arrange:
+		auto pool = CreatePool();
+		ByteBuffer buffer;
+		buffer.reserve(Min_Buffer_Size - 1);
+
+		// Act:
+		pool.release(std::move(buffer));
+
+		// Assert:
+		AssertStatistics(pool, 0, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, ReleaseDiscardsBufferWhenPoolIsFull) {
+		// Arrange:
+		auto pool = CreatePool(utils::FileSize::FromKilobytes(3));
+		auto buffer1 = pool.acquire(2000);
+		auto buffer2 = pool.acquire(1000);
+		auto buffer3 = pool.acquire(1000);
+
+		// Act:
+		pool.release(std::move(buffer1));
+		pool.release(std::move(buffer2));
+		pool.release(std::move(buffer3));
+
+		// Assert: third buffer would exceed the max pool size
+		AssertStatistics(pool, 0, 3, 2, 3 * 1024);
+	}
+
+	// endregion
+
+	// region thread safety
+
+	TEST(TEST_CLASS, CanAcquireAndReleaseBuffersFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Iterations = 1000u;
+		auto pool = CreatePool();
+		auto numThreads = test::GetNumDefaultPoolThreads();
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.emplace_back([&pool, i]() {
+				for (auto j = 0u; j < Num_Iterations; ++j) {
+					auto buffer = pool.acquire((i + j) % Max_Buffer_Size);
+					buffer.push_back(static_cast<uint8_t>(j));
+					pool.release(std::move(buffer));
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert: each acquisition was served from the pool or allocated
+		auto statistics = pool.statistics();
+		EXPECT_EQ(numThreads * Num_Iterations, statistics.NumHits + statistics.NumMisses);
+		EXPECT_GE(numThreads * pool.numSizeClasses(), statistics.NumBuffers);
+		EXPECT_LT(0u, statistics.NumBuffers);
+	}
+
+	// endregion
+}}
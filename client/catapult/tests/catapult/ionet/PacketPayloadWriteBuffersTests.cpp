@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketPayloadWriteBuffers.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketPayloadWriteBuffersTests
+
+	namespace {
+		constexpr auto Max_Coalesced_Buffer_Size = 100u;
+
+		PacketPayload CreatePayload(std::initializer_list<size_t> bufferSizes) {
+			PacketPayloadBuilder builder(PacketType::Push_Block);
+			for (auto bufferSize : bufferSizes)
+				builder.appendValues(test::GenerateRandomVector(bufferSize));
+
+			return builder.build();
+		}
+
+		std::vector<uint8_t> Concatenate(const std::vector<RawBuffer>& buffers) {
+			std::vector<uint8_t> result;
+			for (const auto& buffer : buffers)
+				result.insert(result.end(), buffer.pData, buffer.pData + buffer.Size);
+
+			return result;
+		}
+
+		std::vector<uint8_t> SerializePayload(const PacketPayload& payload) {
+			const auto* pHeaderData = reinterpret_cast<const uint8_t*>(&payload.header());
+			auto result = std::vector<uint8_t>(pHeaderData, pHeaderData + sizeof(PacketHeader));
+			auto dataBuffer = Concatenate(payload.buffers());
+			result.insert(result.end(), dataBuffer.cbegin(), dataBuffer.cend());
+			return result;
+		}
+
+		std::vector<size_t> GetBufferSizes(const std::vector<RawBuffer>& buffers) {
+			std::vector<size_t> bufferSizes;
+			for (const auto& buffer : buffers)
+				bufferSizes.push_back(buffer.Size);
+
+			return bufferSizes;
+		}
+	}
+
+	TEST(TEST_CLASS, HeaderOnlyPayloadIsWrittenAsSingleBuffer) {
+		// Arrange:
+		auto payload = PacketPayload(PacketType::Push_Block);
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(payload, Max_Coalesced_Buffer_Size);
+
+		// Assert:
+		ASSERT_EQ(1u, writeBuffers.buffers().size());
+		EXPECT_EQ(SerializePayload(payload), Concatenate(writeBuffers.buffers()));
+		EXPECT_EQ(sizeof(PacketHeader), writeBuffers.numCoalescedBytes());
+	}
+
+	TEST(TEST_CLASS, SmallBuffersAreCoalescedWithHeader) {
+		// Arrange:
+		auto payload = CreatePayload({ 10, 20, 30 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(payload, Max_Coalesced_Buffer_Size);
+
+		// Assert:
+		EXPECT_EQ(std::vector<size_t>({ sizeof(PacketHeader) + 60 }), GetBufferSizes(writeBuffers.buffers()));
+		EXPECT_EQ(SerializePayload(payload), Concatenate(writeBuffers.buffers()));
+		EXPECT_EQ(sizeof(PacketHeader) + 60, writeBuffers.numCoalescedBytes());
+	}
+
+	TEST(TEST_CLASS, CoalescedBuffersDoNotExceedMaxSize) {
+		// Arrange:
+		auto payload = CreatePayload({ 50, 50, 30, 70, 99 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(payload, Max_Coalesced_Buffer_Size);
+
+		// Assert:
+		auto expectedBufferSizes = std::vector<size_t>({ sizeof(PacketHeader) + 50, 80, 70, 99 });
+		EXPECT_EQ(expectedBufferSizes, GetBufferSizes(writeBuffers.buffers()));
+		EXPECT_EQ(SerializePayload(payload), Concatenate(writeBuffers.buffers()));
+		EXPECT_EQ(sizeof(PacketHeader) + 299, writeBuffers.numCoalescedBytes());
+	}
+
+	TEST(TEST_CLASS, LargeBuffersAreReferencedDirectly) {
+		// Arrange:
+		auto payload = CreatePayload({ 10, 100, 20, 30, 150, 40 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(payload, Max_Coalesced_Buffer_Size);
+
+		// Assert:
+		const auto& buffers = writeBuffers.buffers();
+		auto expectedBufferSizes = std::vector<size_t>({ sizeof(PacketHeader) + 10, 100, 50, 150, 40 });
+		EXPECT_EQ(expectedBufferSizes, GetBufferSizes(buffers));
+		EXPECT_EQ(SerializePayload(payload), Concatenate(buffers));
+		EXPECT_EQ(sizeof(PacketHeader) + 100, writeBuffers.numCoalescedBytes());
+
+		ASSERT_EQ(5u, buffers.size());
+		EXPECT_EQ(payload.buffers()[1].pData, buffers[1].pData);
+		EXPECT_EQ(payload.buffers()[4].pData, buffers[3].pData);
+	}
+
+	TEST(TEST_CLASS, BuffersAreValidAfterPayloadIsDestroyed) {
+		// Arrange:
+		auto pPayload = std::make_unique<PacketPayload>(CreatePayload({ 10, 150, 40 }));
+		auto expectedData = SerializePayload(*pPayload);
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(*pPayload, Max_Coalesced_Buffer_Size);
+		pPayload.reset();
+
+		// Assert:
+		EXPECT_EQ(expectedData, Concatenate(writeBuffers.buffers()));
+	}
+
+	TEST(TEST_CLASS, DefaultMaxCoalescedBufferSizeIsMaxSslRecordSize) {
+		// Arrange:
+		auto payload = CreatePayload({ 10 * 1024, 6 * 1024, 16 * 1024 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(payload);
+
+		// Assert:
+		auto expectedBufferSizes = std::vector<size_t>({ sizeof(PacketHeader) + 10 * 1024, 6 * 1024, 16 * 1024 });
+		EXPECT_EQ(expectedBufferSizes, GetBufferSizes(writeBuffers.buffers()));
+		EXPECT_EQ(SerializePayload(payload), Concatenate(writeBuffers.buffers()));
+	}
+}}
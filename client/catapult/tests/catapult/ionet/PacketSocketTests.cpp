@@ -23,6 +23,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -122,6 +123,48 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	namespace {
+		void AssertWriteSuccessMultiBufferPayload(const std::vector<size_t>& bufferSizes) {
+			// Arrange: set up payloads
+			PacketPayloadBuilder builder(PacketType::Push_Block);
+			ByteBuffer packetData;
+			for (auto bufferSize : bufferSizes) {
+				auto buffer = test::GenerateRandomVector(bufferSize);
+				builder.appendValues(buffer);
+				packetData.insert(packetData.end(), buffer.cbegin(), buffer.cend());
+			}
+
+			auto payload = builder.build();
+
+			const auto* pHeaderData = reinterpret_cast<const uint8_t*>(&payload.header());
+			auto packetBytes = ByteBuffer(pHeaderData, pHeaderData + sizeof(PacketHeader));
+			packetBytes.insert(packetBytes.end(), packetData.cbegin(), packetData.cend());
+
+			// Sanity:
+			EXPECT_EQ(packetBytes.size(), payload.header().Size);
+			EXPECT_EQ(bufferSizes.size(), payload.buffers().size());
+
+			// Assert:
+			AssertWriteSuccess(payload, packetBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		AssertWriteSuccessMultiBufferPayload({ 50, 1, 20 * 1024, 300, 16 * 1024 - 1, 16 * 1024, 8, 100 * 1024, 40 });
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayloadRequiringMultipleWrites) {
+		// Arrange: alternate large (directly referenced) and small (coalesced) buffers to force more than Max_Buffers_Per_Write buffers
+		std::vector<size_t> bufferSizes;
+		for (auto i = 0u; i < 1100; ++i) {
+			bufferSizes.push_back(16 * 1024);
+			bufferSizes.push_back(1 + i % 10);
+		}
+
+		// Assert:
+		AssertWriteSuccessMultiBufferPayload(bufferSizes);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/ionet/WorkingBuffer.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace ionet {
@@ -326,4 +327,121 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region buffer pool
+
+	namespace {
+		WorkingBuffer CreatePooledWorkingBuffer(const std::shared_ptr<PacketBufferPool>& pPool, size_t sensitivity = 10) {
+			PacketSocketOptions options;
+			options.WorkingBufferSize = Default_Capacity;
+			options.WorkingBufferSensitivity = sensitivity;
+			options.MaxPacketDataSize = 15 * 1024;
+			options.BufferPool = pPool;
+			return WorkingBuffer(options);
+		}
+
+		std::shared_ptr<PacketBufferPool> CreateBufferPool() {
+			return std::make_shared<PacketBufferPool>(Default_Capacity, 16 * 1024, utils::FileSize::FromKilobytes(64));
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateWorkingBufferWithBufferPool) {
+		// Arrange:
+		auto pPool = CreateBufferPool();
+
+		// Act:
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+
+		// Assert:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+
+		auto statistics = pPool->statistics();
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(1u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.NumBuffers);
+	}
+
+	TEST(TEST_CLASS, DestroyingWorkingBufferReturnsMemoryToBufferPool) {
+		// Arrange:
+		auto pPool = CreateBufferPool();
+		const uint8_t* pBufferData;
+		{
+			auto buffer = CreatePooledWorkingBuffer(pPool);
+			pBufferData = buffer.data();
+		}
+
+		// Sanity:
+		EXPECT_EQ(1u, pPool->statistics().NumBuffers);
+
+		// Act:
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+
+		// Assert: memory of first buffer was reused
+		EXPECT_EQ(pBufferData, buffer.data());
+		EXPECT_EQ(Default_Capacity, buffer.capacity());
+
+		auto statistics = pPool->statistics();
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(1u, statistics.NumMisses);
+		EXPECT_EQ(0u, statistics.NumBuffers);
+	}
+
+	TEST(TEST_CLASS, BufferExpandsToFitIncreasingDataSizesWithBufferPool) {
+		// Arrange:
+		auto pPool = CreateBufferPool();
+		auto buffer = CreatePooledWorkingBuffer(pPool);
+
+		// Act: keep appending to the working buffer without committing
+		std::vector<uint8_t> allData;
+		for (auto i = 0u; i < 3; ++i) {
+			auto appendBuffer = AppendRandomBuffer<Default_Capacity>(buffer);
+			allData.insert(allData.end(), appendBuffer.cbegin(), appendBuffer.cend());
+		}
+
+		// Assert: capacity is always grown to a size class with room for another full append
+		EXPECT_EQ(Default_Capacity * 3, buffer.size());
+		EXPECT_EQ(Default_Capacity * 4, buffer.capacity());
+		AssertEqual(allData, buffer);
+
+		// - replaced (smaller) buffers were returned to the pool
+		auto statistics = pPool->statistics();
+		EXPECT_EQ(0u, statistics.NumHits);
+		EXPECT_EQ(3u, statistics.NumMisses);
+		EXPECT_EQ(2u, statistics.NumBuffers);
+		EXPECT_EQ(utils::FileSize::FromBytes(Default_Capacity * 3), statistics.Size);
+	}
+
+	TEST(TEST_CLASS, BufferIsShrunkToReclaimMemoryWithBufferPool) {
+		// Arrange: create a working buffer with sensitivity 5
+		auto pPool = CreateBufferPool();
+		auto buffer = CreatePooledWorkingBuffer(pPool, 5);
+
+		// - append and consume a large packet (append is done in three chunks)
+		AppendAndConsumeRandomData(buffer, 3);
+
+		// Sanity:
+		EXPECT_EQ(0u, buffer.size());
+		EXPECT_EQ(Default_Capacity * 4, buffer.capacity());
+
+		// Act: append small data
+		std::vector<uint8_t> allData;
+		for (auto i = 0u; i < 12; ++i) {
+			auto appendBuffer = AppendRandomBuffer<10>(buffer);
+			allData.insert(allData.end(), appendBuffer.cbegin(), appendBuffer.cend());
+		}
+
+		// Assert: capacity is reduced to the smallest size class that can hold a full append and the large buffer is returned to the pool
+		EXPECT_EQ(120u, buffer.size());
+		EXPECT_EQ(Default_Capacity * 2, buffer.capacity());
+		AssertEqual(allData, buffer);
+
+		auto statistics = pPool->statistics();
+		EXPECT_EQ(1u, statistics.NumHits);
+		EXPECT_EQ(3u, statistics.NumMisses);
+		EXPECT_EQ(2u, statistics.NumBuffers);
+		EXPECT_EQ(utils::FileSize::FromBytes(Default_Capacity * 5), statistics.Size);
+	}
+
+	// endregion
 }}
@@ -436,5 +436,37 @@ namespace catapult { namespace model {
 		EXPECT_NE(transactionElement.EntityHash, transactionElement.MerkleComponentHash);
 	}
 
+	TEST(TEST_CLASS, UpdateHashes_ReusedHashBuilderProducesSameHashesAsFreshHashBuilder) {
+		// Arrange:
+		auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+				mocks::OffsetRange{ 6, 10 },
+				std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 }, { 12, 20 } });
+		auto registry = TransactionRegistry();
+		registry.registerPlugin(std::move(pPlugin));
+
+		auto transactions = test::GenerateRandomTransactions(5);
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		// - partially use the builder before passing it to UpdateHashes
+		crypto::Sha3_256_Builder hashBuilder;
+		hashBuilder.update(test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		std::vector<TransactionElement> transactionElements;
+		for (const auto& pTransaction : transactions) {
+			transactionElements.emplace_back(*pTransaction);
+			UpdateHashes(registry, generationHashSeed, transactionElements.back(), hashBuilder);
+		}
+
+		// Assert:
+		for (auto i = 0u; i < transactions.size(); ++i) {
+			auto expectedTransactionElement = TransactionElement(*transactions[i]);
+			UpdateHashes(registry, generationHashSeed, expectedTransactionElement);
+
+			EXPECT_EQ(expectedTransactionElement.EntityHash, transactionElements[i].EntityHash) << "at index " << i;
+			EXPECT_EQ(expectedTransactionElement.MerkleComponentHash, transactionElements[i].MerkleComponentHash) << "at index " << i;
+		}
+	}
+
 	// endregion
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/net/ConnectionSettings.h"
+#include "catapult/ionet/PacketBufferPool.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace net {
@@ -36,6 +37,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(10), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_FALSE(!!settings.SocketWorkingBufferPool);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv4, settings.OutgoingProtocols);
 
@@ -49,6 +51,7 @@ namespace catapult { namespace net {
 		settings.Timeout = utils::TimeSpan::FromSeconds(987);
 		settings.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(54);
 		settings.SocketWorkingBufferSensitivity = 123;
+		settings.SocketWorkingBufferPool = std::make_shared<ionet::PacketBufferPool>(1024, 4096, utils::FileSize::FromKilobytes(8));
 		settings.MaxPacketDataSize = utils::FileSize::FromMegabytes(2);
 		settings.OutgoingProtocols = ionet::IpProtocol::IPv6;
 
@@ -59,6 +62,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(987), options.AcceptHandshakeTimeout);
 		EXPECT_EQ(54u * 1024, options.WorkingBufferSize);
 		EXPECT_EQ(123u, options.WorkingBufferSensitivity);
+		EXPECT_EQ(settings.SocketWorkingBufferPool, options.BufferPool);
 		EXPECT_EQ(2u * 1024 * 1024, options.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv6, options.OutgoingProtocols);
 	}
@@ -246,4 +246,76 @@ namespace catapult { namespace observers {
 	}
 
 	// endregion
+
+	// region profiling
+
+	namespace {
+		std::map<std::string, uint64_t> GetExecutionCounts(const utils::ExecutionProfiler& profiler) {
+			std::map<std::string, uint64_t> executionCounts;
+			for (const auto* pStatistics : profiler.statistics())
+				executionCounts.emplace(pStatistics->name(), pStatistics->count());
+
+			return executionCounts;
+		}
+	}
+
+	TEST(TEST_CLASS, ProfilerRecordsExecutionsOfMatchingObservers) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		utils::ExecutionProfiler profiler;
+		DemuxObserverBuilder builder(profiler);
+
+		cache::CatapultCache cache({});
+		auto cacheDelta = cache.createDelta();
+		auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Commit);
+
+		builder
+			.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+			.add(CreateBreadcrumbObserver(breadcrumbs, "zEtA"));
+		auto pObserver = builder.build();
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+		test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+
+		// Assert: observers are still named and invoked as before
+		EXPECT_EQ(Breadcrumbs({ "alpha", "OMEGA", "zEtA" }), pObserver->names());
+		EXPECT_EQ(Breadcrumbs({ "alpha", "zEtA", "alpha", "zEtA" }), breadcrumbs);
+
+		// - only executions of matching observers are recorded
+		std::map<std::string, uint64_t> expectedExecutionCounts{ { "OMEGA", 0 }, { "alpha", 2 }, { "zEtA", 2 } };
+		EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(profiler));
+		EXPECT_EQ(4u, profiler.totalCount());
+	}
+
+	TEST(TEST_CLASS, ProfilerAggregatesExecutionsOfSameNamedObserversAcrossBuilders) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		utils::ExecutionProfiler profiler;
+		DemuxObserverBuilder builder1(profiler);
+		DemuxObserverBuilder builder2(profiler);
+
+		cache::CatapultCache cache({});
+		auto cacheDelta = cache.createDelta();
+		auto context = test::CreateObserverContext(cacheDelta, Height(123), NotifyMode::Rollback);
+
+		builder1.add(CreateBreadcrumbObserver(breadcrumbs, "alpha"));
+		builder2.add(CreateBreadcrumbObserver(breadcrumbs, "alpha")).add(CreateBreadcrumbObserver(breadcrumbs, "beta"));
+		auto pObserver1 = builder1.build();
+		auto pObserver2 = builder2.build();
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		test::ObserveNotification<model::Notification>(*pObserver1, notification, context);
+		test::ObserveNotification<model::Notification>(*pObserver2, notification, context);
+
+		// Assert:
+		std::map<std::string, uint64_t> expectedExecutionCounts{ { "alpha", 2 }, { "beta", 1 } };
+		EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(profiler));
+		EXPECT_EQ(3u, profiler.totalCount());
+	}
+
+	// endregion
 }}
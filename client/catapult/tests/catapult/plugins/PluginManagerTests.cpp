@@ -100,6 +100,41 @@ namespace catapult { namespace plugins {
 		assertCacheConfiguration(manager.cacheConfig("bar"), "abc/bar");
 	}
 
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithColumnConfigurations) {
+		// Arrange:
+		auto storageConfig = StorageConfiguration();
+		storageConfig.PreferCacheDatabase = true;
+		storageConfig.CacheDatabaseDirectory = "abc";
+
+		auto& columns = storageConfig.CacheDatabaseConfig.Columns;
+		columns["foo.default"].BloomFilterBitsPerKey = 10;
+		columns["foo.key_lookup"].BloomFilterBitsPerKey = 12;
+		columns["bar.default"].BloomFilterBitsPerKey = 14;
+		columns["foobar.default"].BloomFilterBitsPerKey = 16;
+		columns["foo."].BloomFilterBitsPerKey = 18;
+
+		// Act:
+		PluginManager manager(
+				model::BlockchainConfiguration::Uninitialized(),
+				storageConfig,
+				config::UserConfiguration::Uninitialized(),
+				config::InflationConfiguration::Uninitialized());
+
+		auto fooColumns = manager.cacheConfig("foo").CacheDatabaseConfig.Columns;
+		auto barColumns = manager.cacheConfig("bar").CacheDatabaseConfig.Columns;
+		auto bazColumns = manager.cacheConfig("baz").CacheDatabaseConfig.Columns;
+
+		// Assert: only column configurations matching cache name are forwarded and they are keyed by column name
+		ASSERT_EQ(2u, fooColumns.size());
+		EXPECT_EQ(10u, fooColumns.at("default").BloomFilterBitsPerKey);
+		EXPECT_EQ(12u, fooColumns.at("key_lookup").BloomFilterBitsPerKey);
+
+		ASSERT_EQ(1u, barColumns.size());
+		EXPECT_EQ(14u, barColumns.at("default").BloomFilterBitsPerKey);
+
+		EXPECT_TRUE(bazColumns.empty());
+	}
+
 	// endregion
 
 	// region tx plugins
@@ -513,6 +548,67 @@ namespace catapult { namespace plugins {
 
 	// endregion
 
+	// region profiling
+
+	namespace {
+		std::map<std::string, uint64_t> GetExecutionCounts(const utils::ExecutionProfiler& profiler) {
+			std::map<std::string, uint64_t> executionCounts;
+			for (const auto* pStatistics : profiler.statistics())
+				executionCounts.emplace(pStatistics->name(), pStatistics->count());
+
+			return executionCounts;
+		}
+	}
+
+	TEST(TEST_CLASS, NotificationProfilingIsDisabledByDefault) {
+		// Act:
+		auto manager = test::CreatePluginManager();
+
+		// Assert:
+		EXPECT_FALSE(!!manager.validatorProfiler());
+		EXPECT_FALSE(!!manager.observerProfiler());
+	}
+
+	TEST(TEST_CLASS, CanEnableNotificationProfilingOfValidators) {
+		// Arrange:
+		auto manager = test::CreatePluginManager();
+		manager.addStatelessValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatelessValidator("alpha"));
+		});
+		manager.addStatefulValidatorHook([](auto& builder) {
+			builder.add(CreateNamedStatefulValidator("beta"));
+		});
+
+		// Act:
+		manager.enableNotificationProfiling();
+		ValidateStateless(manager, false);
+		ValidateStateless(manager, true);
+		manager.createStatefulValidator();
+
+		// Assert: stateless and stateful validators share a profiler
+		ASSERT_TRUE(!!manager.validatorProfiler());
+		std::map<std::string, uint64_t> expectedExecutionCounts{ { "alpha", 2 }, { "beta", 0 } };
+		EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(*manager.validatorProfiler()));
+	}
+
+	TEST(TEST_CLASS, CanEnableNotificationProfilingOfObservers) {
+		// Arrange:
+		RunObserverTest([](auto& manager) {
+			// Act:
+			manager.enableNotificationProfiling();
+			manager.createObserver();
+
+			// Assert:
+			ASSERT_TRUE(!!manager.observerProfiler());
+			std::map<std::string, uint64_t> expectedExecutionCounts{
+				{ "alpha", 0 }, { "beta", 0 }, { "gamma", 0 }, { "omega", 0 }, { "zeta", 0 }
+			};
+			EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(*manager.observerProfiler()));
+		});
+	}
+
+	// endregion
+
 	// region resolvers
 
 	namespace {
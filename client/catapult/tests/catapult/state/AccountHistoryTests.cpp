@@ -119,6 +119,46 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region hasValueAfter
+
+	TEST(TEST_CLASS, HasValueAfterReturnsFalseWhenEmpty) {
+		// Arrange:
+		AccountHistory history;
+
+		// Act + Assert:
+		EXPECT_FALSE(history.hasValueAfter(Height(0)));
+	}
+
+	HISTORY_VALUE_TEST(HasValueAfterReturnsCorrectValueWhenNotEmpty) {
+		// Arrange:
+		AccountHistory history;
+		history.add(Height(11), TTraits::ToValue(12));
+		history.add(Height(22), TTraits::ToValue(98));
+
+		// Act + Assert:
+		EXPECT_TRUE(history.hasValueAfter(Height(0)));
+		EXPECT_TRUE(history.hasValueAfter(Height(21)));
+
+		EXPECT_FALSE(history.hasValueAfter(Height(22)));
+		EXPECT_FALSE(history.hasValueAfter(Height(99)));
+	}
+
+	TEST(TEST_CLASS, HasValueAfterReturnsCorrectValueWhenNotEmpty_HeterogenousValues) {
+		// Arrange:
+		AccountHistory history;
+		history.add(Height(11), Amount(12));
+		history.add(Height(22), Key{ { 98 } });
+		history.add(Height(33), VotingPublicKeysTraits::ToValue(67));
+
+		// Act + Assert:
+		EXPECT_TRUE(history.hasValueAfter(Height(21)));
+		EXPECT_TRUE(history.hasValueAfter(Height(32)));
+
+		EXPECT_FALSE(history.hasValueAfter(Height(33)));
+	}
+
+	// endregion
+
 	// region add
 
 	HISTORY_VALUE_TEST(CanAddSingleValue) {
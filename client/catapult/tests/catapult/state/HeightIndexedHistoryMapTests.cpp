@@ -75,6 +75,36 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region hasValueAfter
+
+	TEST(TEST_CLASS, HasValueAfterReturnsFalseWhenEmpty) {
+		// Arrange:
+		HistoryMap history;
+
+		// Act + Assert:
+		EXPECT_FALSE(history.hasValueAfter(Height(0)));
+		EXPECT_FALSE(history.hasValueAfter(Height(10)));
+	}
+
+	TEST(TEST_CLASS, HasValueAfterReturnsCorrectValueWhenNotEmpty) {
+		// Arrange:
+		HistoryMap history;
+		history.add(Height(11), Timestamp(12));
+		history.add(Height(22), Timestamp(98));
+		history.add(Height(33), Timestamp(67));
+
+		// Act + Assert:
+		EXPECT_TRUE(history.hasValueAfter(Height(0)));
+		EXPECT_TRUE(history.hasValueAfter(Height(11)));
+		EXPECT_TRUE(history.hasValueAfter(Height(32)));
+
+		EXPECT_FALSE(history.hasValueAfter(Height(33)));
+		EXPECT_FALSE(history.hasValueAfter(Height(34)));
+		EXPECT_FALSE(history.hasValueAfter(Height(99)));
+	}
+
+	// endregion
+
 	// region anyOf
 
 	TEST(TEST_CLASS, AnyOfReturnsFalseWhenEmpty) {
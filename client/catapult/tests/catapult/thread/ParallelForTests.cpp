@@ -324,6 +324,41 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region ParallelForPartitionIndexes
+
+	TEST(TEST_CLASS, CanProcessZeroPartitionIndexes) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+
+		// Act:
+		std::atomic<size_t> numCallbacks(0);
+		auto result = ParallelForPartitionIndexes(pPool->ioContext(), 0, [&numCallbacks](auto) {
+			++numCallbacks;
+		}).get();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(0u, numCallbacks);
+	}
+
+	TEST(TEST_CLASS, CanProcessEachPartitionIndexOnce) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool();
+		auto numPartitions = pPool->numWorkerThreads() * 3 + 1;
+
+		// Act: each partition index is only written by a single callback
+		std::vector<uint32_t> partitionCounters(numPartitions, 0);
+		auto result = ParallelForPartitionIndexes(pPool->ioContext(), numPartitions, [&partitionCounters](auto partitionIndex) {
+			++partitionCounters[partitionIndex];
+		}).get();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		EXPECT_EQ(std::vector<uint32_t>(numPartitions, 1), partitionCounters);
+	}
+
+	// endregion
+
 	// region ParallelFor[Partition] distributed
 
 	namespace {
@@ -0,0 +1,163 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ExecutionProfiler.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ExecutionProfilerTests
+
+	// region ExecutionStatistics
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyEmpty) {
+		// Act:
+		ExecutionStatistics statistics("alpha");
+
+		// Assert:
+		EXPECT_EQ("alpha", statistics.name());
+		EXPECT_EQ(0u, statistics.count());
+		EXPECT_EQ(0u, statistics.totalElapsed());
+		EXPECT_EQ(0u, statistics.latencies().max());
+	}
+
+	TEST(TEST_CLASS, StatisticsCanRecordExecutions) {
+		// Arrange:
+		ExecutionStatistics statistics("alpha");
+
+		// Act:
+		statistics.record(5);
+		statistics.record(3);
+		statistics.record(7);
+
+		// Assert:
+		EXPECT_EQ(3u, statistics.count());
+		EXPECT_EQ(15u, statistics.totalElapsed());
+		EXPECT_EQ(3u, statistics.latencies().count());
+		EXPECT_EQ(5u, statistics.latencies().percentile(50));
+		EXPECT_EQ(7u, statistics.latencies().max());
+	}
+
+	// endregion
+
+	// region ExecutionProfiler
+
+	TEST(TEST_CLASS, ProfilerIsInitiallyEmpty) {
+		// Act:
+		ExecutionProfiler profiler;
+
+		// Assert:
+		EXPECT_TRUE(profiler.statistics().empty());
+		EXPECT_EQ(0u, profiler.totalCount());
+		EXPECT_EQ(0u, profiler.totalElapsed());
+	}
+
+	TEST(TEST_CLASS, ProfilerAddsStatisticsForUnknownNames) {
+		// Arrange:
+		ExecutionProfiler profiler;
+
+		// Act:
+		auto& statistics1 = profiler.statistics("beta");
+		auto& statistics2 = profiler.statistics("alpha");
+
+		// Assert:
+		EXPECT_EQ("beta", statistics1.name());
+		EXPECT_EQ("alpha", statistics2.name());
+
+		auto allStatistics = profiler.statistics();
+		ASSERT_EQ(2u, allStatistics.size());
+		EXPECT_EQ(&statistics2, allStatistics[0]);
+		EXPECT_EQ(&statistics1, allStatistics[1]);
+	}
+
+	TEST(TEST_CLASS, ProfilerReusesStatisticsForKnownNames) {
+		// Arrange:
+		ExecutionProfiler profiler;
+		auto& statistics1 = profiler.statistics("alpha");
+
+		// Act:
+		auto& statistics2 = profiler.statistics("alpha");
+
+		// Assert:
+		EXPECT_EQ(&statistics1, &statistics2);
+		EXPECT_EQ(1u, profiler.statistics().size());
+	}
+
+	TEST(TEST_CLASS, ProfilerTotalsAreAggregatedAcrossAllStatistics) {
+		// Arrange:
+		ExecutionProfiler profiler;
+		profiler.statistics("alpha").record(5);
+		profiler.statistics("beta").record(3);
+		profiler.statistics("alpha").record(11);
+
+		// Act + Assert:
+		EXPECT_EQ(3u, profiler.totalCount());
+		EXPECT_EQ(19u, profiler.totalElapsed());
+	}
+
+	// endregion
+
+	// region ExecutionTimer
+
+	TEST(TEST_CLASS, TimerRecordsElapsedTimeWhenDestroyed) {
+		// Arrange:
+		ExecutionStatistics statistics("alpha");
+
+		// Act:
+		{
+			ExecutionTimer timer(statistics);
+			test::Sleep(2);
+
+			// Sanity: nothing is recorded while the timer is alive
+			EXPECT_EQ(0u, statistics.count());
+		}
+
+		// Assert:
+		EXPECT_EQ(1u, statistics.count());
+		EXPECT_LE(2'000'000u, statistics.totalElapsed());
+	}
+
+	TEST(TEST_CLASS, TimersCanRecordConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Executions_Per_Thread = 1000u;
+		ExecutionProfiler profiler;
+
+		// Act:
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.spawn([&profiler]() {
+				auto& statistics = profiler.statistics("alpha");
+				for (auto j = 0u; j < Num_Executions_Per_Thread; ++j)
+					ExecutionTimer timer(statistics);
+			});
+		}
+
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Executions_Per_Thread, profiler.totalCount());
+		EXPECT_EQ(1u, profiler.statistics().size());
+	}
+
+	// endregion
+}}
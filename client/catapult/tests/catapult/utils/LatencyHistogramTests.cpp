@@ -0,0 +1,254 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/LatencyHistogram.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS LatencyHistogramTests
+
+	// region bucket mapping
+
+	TEST(TEST_CLASS, SmallValuesAreMappedToExactBuckets) {
+		for (auto i = 0u; i < LatencyHistogram::Num_Sub_Buckets; ++i) {
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(i)) << i;
+			EXPECT_EQ(i, LatencyHistogram::BucketUpperBound(i)) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, LargerValuesAreMappedToSubBuckets) {
+		// Assert: [8, 16) has width 1, [16, 32) has width 2, [32, 64) has width 4
+		EXPECT_EQ(8u, LatencyHistogram::BucketIndex(8));
+		EXPECT_EQ(15u, LatencyHistogram::BucketIndex(15));
+		EXPECT_EQ(16u, LatencyHistogram::BucketIndex(16));
+		EXPECT_EQ(16u, LatencyHistogram::BucketIndex(17));
+		EXPECT_EQ(17u, LatencyHistogram::BucketIndex(18));
+		EXPECT_EQ(23u, LatencyHistogram::BucketIndex(31));
+		EXPECT_EQ(24u, LatencyHistogram::BucketIndex(32));
+		EXPECT_EQ(24u, LatencyHistogram::BucketIndex(35));
+		EXPECT_EQ(25u, LatencyHistogram::BucketIndex(36));
+	}
+
+	TEST(TEST_CLASS, BucketUpperBoundIsHighestValueInBucket) {
+		EXPECT_EQ(15u, LatencyHistogram::BucketUpperBound(15));
+		EXPECT_EQ(17u, LatencyHistogram::BucketUpperBound(16));
+		EXPECT_EQ(31u, LatencyHistogram::BucketUpperBound(23));
+		EXPECT_EQ(35u, LatencyHistogram::BucketUpperBound(24));
+		EXPECT_EQ(39u, LatencyHistogram::BucketUpperBound(25));
+	}
+
+	TEST(TEST_CLASS, MaxValueIsMappedToLastBucket) {
+		// Act:
+		auto bucketIndex = LatencyHistogram::BucketIndex(std::numeric_limits<uint64_t>::max());
+
+		// Assert:
+		EXPECT_EQ(LatencyHistogram::Num_Buckets - 1, bucketIndex);
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), LatencyHistogram::BucketUpperBound(bucketIndex));
+	}
+
+	TEST(TEST_CLASS, BucketsAreContiguousAndBoundedByRelativePrecision) {
+		for (auto i = 1u; i < LatencyHistogram::Num_Buckets; ++i) {
+			auto lowerBound = LatencyHistogram::BucketUpperBound(i - 1) + 1;
+			auto upperBound = LatencyHistogram::BucketUpperBound(i);
+
+			// Assert: each value in the bucket maps to the bucket
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(lowerBound)) << i;
+			EXPECT_EQ(i, LatencyHistogram::BucketIndex(upperBound)) << i;
+
+			// - bucket width is no larger than 1 / Num_Sub_Buckets of its lower bound
+			if (i >= LatencyHistogram::Num_Sub_Buckets)
+				EXPECT_LE(upperBound - lowerBound + 1, lowerBound / LatencyHistogram::Num_Sub_Buckets) << i;
+		}
+	}
+
+	// endregion
+
+	// region record / percentile
+
+	TEST(TEST_CLASS, HistogramIsInitiallyEmpty) {
+		// Act:
+		LatencyHistogram histogram;
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(50));
+		EXPECT_EQ(0u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanRecordSingleValue) {
+		// Arrange:
+		LatencyHistogram histogram;
+
+		// Act:
+		histogram.record(1234);
+
+		// Assert: percentile is capped by max
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(1234u, histogram.max());
+		EXPECT_EQ(1234u, histogram.percentile(0));
+		EXPECT_EQ(1234u, histogram.percentile(50));
+		EXPECT_EQ(1234u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanCalculatePercentilesOfExactValues) {
+		// Arrange: record each value in [1, 100] once in reverse order
+		LatencyHistogram histogram;
+		for (auto i = 100u; i > 0; --i)
+			histogram.record(i);
+
+		// Assert: percentiles are the highest values equivalent to the exact percentiles
+		EXPECT_EQ(100u, histogram.count());
+		EXPECT_EQ(100u, histogram.max());
+		EXPECT_EQ(1u, histogram.percentile(0));
+		EXPECT_EQ(1u, histogram.percentile(1));
+		EXPECT_EQ(7u, histogram.percentile(7));
+		EXPECT_EQ(51u, histogram.percentile(50)); // [48, 52)
+		EXPECT_EQ(95u, histogram.percentile(90)); // [88, 96)
+		EXPECT_EQ(100u, histogram.percentile(99)); // [96, 104) capped by max
+		EXPECT_EQ(100u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, PercentileIsNotSkewedByOutliers) {
+		// Arrange:
+		LatencyHistogram histogram;
+		for (auto i = 0u; i < 99; ++i)
+			histogram.record(10);
+
+		histogram.record(1'000'000);
+
+		// Assert:
+		EXPECT_EQ(100u, histogram.count());
+		EXPECT_EQ(1'000'000u, histogram.max());
+		EXPECT_EQ(10u, histogram.percentile(50));
+		EXPECT_EQ(10u, histogram.percentile(99));
+		EXPECT_EQ(1'000'000u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CannotCalculateInvalidPercentile) {
+		// Arrange:
+		LatencyHistogram histogram;
+		histogram.record(10);
+
+		// Act + Assert:
+		EXPECT_THROW(histogram.percentile(101), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Values_Per_Thread = 10'000u;
+		LatencyHistogram histogram;
+
+		// Act:
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.spawn([&histogram, i]() {
+				for (auto j = 0u; j < Num_Values_Per_Thread; ++j)
+					histogram.record(i * Num_Values_Per_Thread + j);
+			});
+		}
+
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread, histogram.count());
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread - 1, histogram.max());
+	}
+
+	// endregion
+
+	// region merge / reset
+
+	TEST(TEST_CLASS, CanMergeHistograms) {
+		// Arrange:
+		LatencyHistogram histogram1;
+		LatencyHistogram histogram2;
+		for (auto i = 1u; i <= 50; ++i) {
+			histogram1.record(i);
+			histogram2.record(i + 50);
+		}
+
+		// Act:
+		histogram1.merge(histogram2);
+
+		// Assert: merged histogram is equivalent to one with each value in [1, 100] recorded once
+		EXPECT_EQ(100u, histogram1.count());
+		EXPECT_EQ(100u, histogram1.max());
+		EXPECT_EQ(1u, histogram1.percentile(0));
+		EXPECT_EQ(51u, histogram1.percentile(50));
+		EXPECT_EQ(100u, histogram1.percentile(100));
+
+		// - source histogram is unchanged
+		EXPECT_EQ(50u, histogram2.count());
+		EXPECT_EQ(100u, histogram2.max());
+	}
+
+	TEST(TEST_CLASS, MergePreservesLargerMax) {
+		// Arrange:
+		LatencyHistogram histogram1;
+		LatencyHistogram histogram2;
+		histogram1.record(1000);
+		histogram2.record(10);
+
+		// Act:
+		histogram1.merge(histogram2);
+
+		// Assert:
+		EXPECT_EQ(2u, histogram1.count());
+		EXPECT_EQ(1000u, histogram1.max());
+	}
+
+	TEST(TEST_CLASS, CanResetHistogram) {
+		// Arrange:
+		LatencyHistogram histogram;
+		for (auto i = 1u; i <= 100; ++i)
+			histogram.record(i);
+
+		// Act:
+		histogram.reset();
+
+		// Assert:
+		EXPECT_EQ(0u, histogram.count());
+		EXPECT_EQ(0u, histogram.max());
+		EXPECT_EQ(0u, histogram.percentile(50));
+		EXPECT_EQ(0u, histogram.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesAfterReset) {
+		// Arrange:
+		LatencyHistogram histogram;
+		histogram.record(1000);
+		histogram.reset();
+
+		// Act:
+		histogram.record(10);
+
+		// Assert:
+		EXPECT_EQ(1u, histogram.count());
+		EXPECT_EQ(10u, histogram.max());
+		EXPECT_EQ(10u, histogram.percentile(100));
+	}
+
+	// endregion
+}}
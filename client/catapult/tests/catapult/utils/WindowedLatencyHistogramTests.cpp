@@ -0,0 +1,230 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/WindowedLatencyHistogram.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS WindowedLatencyHistogramTests
+
+	namespace {
+		constexpr auto Window_Duration = TimeSpan::FromMilliseconds(100);
+
+		using Clock = WindowedLatencyHistogram::Clock;
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_startTime(Clock::now())
+					, m_elapsedMillis(0)
+					, m_histogram(Window_Duration, [this]() { return m_startTime + std::chrono::milliseconds(m_elapsedMillis); })
+			{}
+
+		public:
+			WindowedLatencyHistogram& histogram() {
+				return m_histogram;
+			}
+
+		public:
+			Clock::time_point timeAt(int64_t elapsedMillis) const {
+				return m_startTime + std::chrono::milliseconds(elapsedMillis);
+			}
+
+			void setElapsedMillis(int64_t elapsedMillis) {
+				m_elapsedMillis = elapsedMillis;
+			}
+
+		private:
+			Clock::time_point m_startTime;
+			int64_t m_elapsedMillis;
+			WindowedLatencyHistogram m_histogram;
+		};
+
+		void AssertEmpty(const WindowedLatencyHistogram& histogram) {
+			EXPECT_EQ(0u, histogram.count());
+			EXPECT_EQ(0u, histogram.max());
+			EXPECT_EQ(0u, histogram.percentile(50));
+			EXPECT_EQ(0u, histogram.percentile(100));
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateHistogramWithZeroWindowDuration) {
+		EXPECT_THROW(WindowedLatencyHistogram(TimeSpan::FromMilliseconds(0)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, HistogramIsInitiallyEmpty) {
+		// Act:
+		TestContext context;
+
+		// Assert:
+		AssertEmpty(context.histogram());
+	}
+
+	// endregion
+
+	// region record / percentile
+
+	TEST(TEST_CLASS, CanRecordValuesInSingleWindow) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		for (auto i = 100u; i > 0; --i)
+			context.histogram().record(i);
+
+		// Assert:
+		EXPECT_EQ(100u, context.histogram().count());
+		EXPECT_EQ(100u, context.histogram().max());
+		EXPECT_EQ(1u, context.histogram().percentile(0));
+		EXPECT_EQ(51u, context.histogram().percentile(50));
+		EXPECT_EQ(100u, context.histogram().percentile(100));
+	}
+
+	TEST(TEST_CLASS, ValuesInCurrentAndPreviousWindowsAreReported) {
+		// Arrange:
+		TestContext context;
+
+		// Act: record values in two adjacent windows
+		context.setElapsedMillis(50);
+		context.histogram().record(1000);
+
+		context.setElapsedMillis(150);
+		context.histogram().record(10);
+		context.histogram().record(20);
+
+		// Assert:
+		EXPECT_EQ(3u, context.histogram().count());
+		EXPECT_EQ(1000u, context.histogram().max());
+		EXPECT_EQ(10u, context.histogram().percentile(0));
+		EXPECT_EQ(1000u, context.histogram().percentile(100));
+	}
+
+	TEST(TEST_CLASS, ValuesBeforePreviousWindowAreNotReported) {
+		// Arrange:
+		TestContext context;
+		context.setElapsedMillis(50);
+		context.histogram().record(1000);
+
+		context.setElapsedMillis(150);
+		context.histogram().record(10);
+
+		// Act: advance to the window after the one in which 10 was recorded
+		context.setElapsedMillis(250);
+
+		// Assert: only the value recorded in the previous window is reported
+		EXPECT_EQ(1u, context.histogram().count());
+		EXPECT_EQ(10u, context.histogram().max());
+		EXPECT_EQ(10u, context.histogram().percentile(50));
+	}
+
+	TEST(TEST_CLASS, OldValuesAreNotReportedEvenWhenNoNewValuesAreRecorded) {
+		// Arrange:
+		TestContext context;
+		context.histogram().record(1000);
+
+		// Act:
+		context.setElapsedMillis(200);
+
+		// Assert:
+		AssertEmpty(context.histogram());
+	}
+
+	TEST(TEST_CLASS, OldValuesDoNotAffectValuesRecordedInReusedWindow) {
+		// Arrange:
+		TestContext context;
+		context.histogram().record(1000);
+
+		// Act: record in a window that reuses the storage of the first window
+		context.setElapsedMillis(250);
+		context.histogram().record(10);
+
+		// Assert:
+		EXPECT_EQ(1u, context.histogram().count());
+		EXPECT_EQ(10u, context.histogram().max());
+		EXPECT_EQ(10u, context.histogram().percentile(100));
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesAtExplicitTimes) {
+		// Arrange:
+		TestContext context;
+		context.setElapsedMillis(250);
+
+		// Act: record values in the previous and current windows without changing the current time
+		context.histogram().record(1000, context.timeAt(150));
+		context.histogram().record(10, context.timeAt(250));
+
+		// Assert:
+		EXPECT_EQ(2u, context.histogram().count());
+		EXPECT_EQ(1000u, context.histogram().max());
+		EXPECT_EQ(10u, context.histogram().percentile(0));
+	}
+
+	TEST(TEST_CLASS, ValuesRecordedInWindowOlderThanReusedWindowAreDropped) {
+		// Arrange:
+		TestContext context;
+		context.setElapsedMillis(250);
+		context.histogram().record(10);
+
+		// Act: record a value in a window that shares storage with the current window
+		context.histogram().record(1000, context.timeAt(50));
+
+		// Assert:
+		EXPECT_EQ(1u, context.histogram().count());
+		EXPECT_EQ(10u, context.histogram().max());
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesConcurrently) {
+		// Arrange:
+		constexpr auto Num_Threads = 4u;
+		constexpr auto Num_Values_Per_Thread = 10'000u;
+		TestContext context;
+
+		// Act: record all values in the first window, which does not need to be claimed
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.spawn([&context, i]() {
+				for (auto j = 0u; j < Num_Values_Per_Thread; ++j)
+					context.histogram().record(i * Num_Values_Per_Thread + j);
+			});
+		}
+
+		threads.join();
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread, context.histogram().count());
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread - 1, context.histogram().max());
+	}
+
+	TEST(TEST_CLASS, CannotCalculateInvalidPercentile) {
+		// Arrange:
+		TestContext context;
+		context.histogram().record(10);
+
+		// Act + Assert:
+		EXPECT_THROW(context.histogram().percentile(101), catapult_invalid_argument);
+	}
+
+	// endregion
+}}
@@ -251,4 +251,72 @@ namespace catapult { namespace validators {
 	}
 
 	// endregion
+
+	// region profiling
+
+	namespace {
+		std::map<std::string, uint64_t> GetExecutionCounts(const utils::ExecutionProfiler& profiler) {
+			std::map<std::string, uint64_t> executionCounts;
+			for (const auto* pStatistics : profiler.statistics())
+				executionCounts.emplace(pStatistics->name(), pStatistics->count());
+
+			return executionCounts;
+		}
+	}
+
+	TEST(TEST_CLASS, ProfilerRecordsExecutionsOfMatchingValidators) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		utils::ExecutionProfiler profiler;
+		stateful::DemuxValidatorBuilder builder(profiler);
+
+		auto cache = test::CreateEmptyCatapultCache();
+
+		builder
+			.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "alpha"))
+			.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "OMEGA"))
+			.add(CreateBreadcrumbValidator(breadcrumbs, "zEtA"));
+		auto pValidator = builder.build([](auto) { return false; });
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		test::ValidateNotification<model::Notification>(*pValidator, notification, cache);
+		test::ValidateNotification<model::Notification>(*pValidator, notification, cache);
+
+		// Assert: validators are still named and invoked as before
+		EXPECT_EQ(Breadcrumbs({ "alpha", "OMEGA", "zEtA" }), pValidator->names());
+		EXPECT_EQ(Breadcrumbs({ "alpha", "zEtA", "alpha", "zEtA" }), breadcrumbs);
+
+		// - only executions of matching validators are recorded
+		std::map<std::string, uint64_t> expectedExecutionCounts{ { "OMEGA", 0 }, { "alpha", 2 }, { "zEtA", 2 } };
+		EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(profiler));
+		EXPECT_EQ(4u, profiler.totalCount());
+	}
+
+	TEST(TEST_CLASS, ProfilerAggregatesExecutionsOfSameNamedValidatorsAcrossBuilders) {
+		// Arrange:
+		Breadcrumbs breadcrumbs;
+		utils::ExecutionProfiler profiler;
+		stateful::DemuxValidatorBuilder builder1(profiler);
+		stateful::DemuxValidatorBuilder builder2(profiler);
+
+		auto cache = test::CreateEmptyCatapultCache();
+
+		builder1.add(CreateBreadcrumbValidator(breadcrumbs, "alpha"));
+		builder2.add(CreateBreadcrumbValidator(breadcrumbs, "alpha")).add(CreateBreadcrumbValidator(breadcrumbs, "beta"));
+		auto pValidator1 = builder1.build([](auto) { return false; });
+		auto pValidator2 = builder2.build([](auto) { return false; });
+
+		// Act:
+		auto notification = model::AccountPublicKeyNotification(Key());
+		test::ValidateNotification<model::Notification>(*pValidator1, notification, cache);
+		test::ValidateNotification<model::Notification>(*pValidator2, notification, cache);
+
+		// Assert:
+		std::map<std::string, uint64_t> expectedExecutionCounts{ { "alpha", 2 }, { "beta", 1 } };
+		EXPECT_EQ(expectedExecutionCounts, GetExecutionCounts(profiler));
+		EXPECT_EQ(3u, profiler.totalCount());
+	}
+
+	// endregion
 }}
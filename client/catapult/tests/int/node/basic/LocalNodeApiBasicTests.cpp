@@ -73,6 +73,12 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "TX ELEM TOT")) << "service local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE MEM")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLKCACHE HIT")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLKCACHE MISS")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLKCACHE MEM")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "SOCKPOOL HIT")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "SOCKPOOL MISS")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "SOCKPOOL MEM")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TOT CONF TXES")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
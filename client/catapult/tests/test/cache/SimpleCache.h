@@ -425,6 +425,7 @@ namespace catapult { namespace test {
 				SimpleCacheViewMode mode = SimpleCacheViewMode::Iterable)
 				: m_pFlag(pFlag)
 				, m_mode(mode)
+				, m_numSyncs(0)
 		{}
 
 	public:
@@ -454,10 +455,22 @@ namespace catapult { namespace test {
 			m_state.Id = delta.id();
 		}
 
+		/// Waits until all committed changes have been synced to the underlying storage.
+		void sync() {
+			++m_numSyncs;
+		}
+
+	public:
+		/// Gets the number of times sync was called.
+		size_t numSyncs() const {
+			return m_numSyncs;
+		}
+
 	private:
 		std::shared_ptr<const AutoSetFlag::State> m_pFlag;
 		SimpleCacheViewMode m_mode;
 		SimpleCacheState m_state;
+		size_t m_numSyncs;
 	};
 
 	/// Synchronized cache composed of simple data.
@@ -486,6 +499,12 @@ namespace catapult { namespace test {
 				: BaseType(BasicSimpleCacheExtension<TViewExtension, TDeltaExtension>(flag.state())) {
 			CATAPULT_LOG(debug) << "created SimpleCache with auto set flag (" << &flag << ") with state " << flag.state()->isSet();
 		}
+
+	public:
+		/// Gets the number of times sync was called.
+		size_t numSyncs() const {
+			return this->cache().numSyncs();
+		}
 	};
 
 	using BasicSimpleCache = BasicSimpleCacheExtension<SimpleCacheDefaultViewExtension, SimpleCacheDefaultDeltaExtension>;
@@ -122,6 +122,11 @@ namespace catapult { namespace test {
 			CATAPULT_THROW_RUNTIME_ERROR("commit is not supported");
 		}
 
+		[[noreturn]]
+		void sync() override {
+			CATAPULT_THROW_RUNTIME_ERROR("sync is not supported");
+		}
+
 	public:
 		[[noreturn]]
 		const void* get() const override {
@@ -68,6 +68,7 @@ namespace catapult { namespace test {
 			config.SyncTimeout = utils::TimeSpan::FromSeconds(10);
 
 			config.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(4);
+			config.SocketWorkingBufferPoolSize = utils::FileSize::FromMegabytes(1);
 			config.MaxPacketDataSize = utils::FileSize::FromMegabytes(100);
 
 			config.BlockDisruptorSlotCount = 4 * 1024;
@@ -75,6 +76,7 @@ namespace catapult { namespace test {
 
 			config.TransactionDisruptorSlotCount = 16 * 1024;
 			config.TransactionDisruptorMaxMemorySize = utils::FileSize::FromMegabytes(100);
+			config.TransactionDisruptorMaxBatchSize = 32;
 
 			config.MaxTrackedNodes = 5'000;
 
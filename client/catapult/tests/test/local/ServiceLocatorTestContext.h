@@ -79,7 +79,8 @@ namespace catapult { namespace test {
 						m_transactionStatusSubscriber,
 						m_counters,
 						m_pluginManager,
-						m_pool)
+						m_pool,
+						nullptr)
 		{}
 
 	public:
@@ -14,6 +14,7 @@ SKIP_FILES = (
 
 NAMESPACES_FALSEPOSITIVES = (
 	# multiple namespaces (specialization)
+	re.compile(r'src.catapult.deltaset.FlatMap.h'),  # (catapult::utils::traits)
 	re.compile(r'src.catapult.utils.Logging.cpp'),  # (boost::log)
 	re.compile(r'tests.catapult.deltaset.ConditionalContainerTests.cpp'),  # (catapult::test)
 	re.compile(r'tests.TestHarness.h'),  # (std)
@@ -123,6 +124,7 @@ CORE_FIRSTINCLUDES = {
 	'tests/catapult/deltaset/SetVirtualizedTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
 	'tests/catapult/deltaset/UnorderedMapTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
 	'tests/catapult/deltaset/UnorderedTests.cpp': 'tests/catapult/deltaset/test/BaseSetDeltaTests.h',
+	'tests/catapult/io/FileBlockStorageMemoryMappedTests.cpp': 'catapult/io/FileBlockStorage.h',
 	'tests/catapult/thread/FutureSharedStateTests.cpp': 'catapult/thread/detail/FutureSharedState.h',
 	'tests/catapult/utils/CatapultExceptionTests.cpp': 'catapult/exceptions.h',
 	'tests/catapult/utils/CatapultTypesTests.cpp': 'catapult/types.h',